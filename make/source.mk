@@ -44,7 +44,11 @@ COMMON_SRC = \
             fc/tasks.c \
             fc/runtime_config.c \
             interface/msp.c \
+            interface/msp_batch.c \
             interface/msp_box.c \
+            interface/msp_dataflash.c \
+            interface/msp_setting.c \
+            interface/msp_subscription.c \
             interface/tramp_protocol.c \
             interface/smartaudio_protocol.c \
             io/beeper.c \
@@ -79,9 +83,11 @@ COMMON_SRC = \
             flight/position.c \
             flight/failsafe.c \
             flight/gps_rescue.c \
+            flight/gain_schedule.c \
             flight/imu.c \
             flight/mixer.c \
             flight/mixer_tricopter.c \
+            flight/thrust_linearization.c \
             flight/pid.c \
             flight/servos.c \
             flight/servos_tricopter.c \
@@ -114,7 +120,10 @@ COMMON_SRC = \
             sensors/gyroanalyse.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
+            blackbox/blackbox_burst.c \
+            blackbox/blackbox_columnar.c \
             blackbox/blackbox_encoding.c \
+            blackbox/blackbox_framing.c \
             blackbox/blackbox_io.c \
             cms/cms.c \
             cms/cms_menu_blackbox.c \
@@ -220,9 +229,11 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             fc/rc.c \
             fc/rc_controls.c \
             fc/runtime_config.c \
+            flight/gain_schedule.c \
             flight/imu.c \
             flight/mixer.c \
             flight/pid.c \
+            flight/thrust_linearization.c \
             rx/ibus.c \
             rx/rx.c \
             rx/rx_spi.c \
@@ -279,6 +290,8 @@ SIZE_OPTIMISED_SRC := $(SIZE_OPTIMISED_SRC) \
             config/config_eeprom.c \
             config/feature.c \
             config/config_streamer.c \
+            config/config_transfer.c \
+            config/config_snapshot.c \
             i2c_bst.c \
             interface/cli.c \
             interface/settings.c \
@@ -348,6 +361,7 @@ SRC += \
             drivers/flash_m25p16.c \
             drivers/flash_w25m.c \
             io/flashfs.c \
+            io/flashfs_log.c \
             pg/flash.c \
             $(MSC_SRC)
 endif
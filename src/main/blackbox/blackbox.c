@@ -28,6 +28,8 @@
 #ifdef USE_BLACKBOX
 
 #include "blackbox.h"
+#include "blackbox_burst.h"
+#include "blackbox_columnar.h"
 #include "blackbox_encoding.h"
 #include "blackbox_fielddefs.h"
 #include "blackbox_io.h"
@@ -59,6 +61,7 @@
 #include "fc/runtime_config.h"
 
 #include "flight/failsafe.h"
+#include "flight/gain_schedule.h"
 #include "flight/mixer.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
@@ -84,13 +87,20 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 5);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .p_ratio = 32,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .record_acc = 1,
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .format = BLACKBOX_FORMAT_INTERLEAVED,
+    .burst_ms = 0,
+    .burst_pretrigger = 25,
+    .burst_on_event = 0,
+    .fields_disabled_mask = 0,
+    .field_rate = { BLACKBOX_FIELD_RATE_1 },
+    .serial_framing = 0,
 );
 
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
@@ -100,6 +110,7 @@ PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
 #define PREDICT(x) CONCAT(FLIGHT_LOG_FIELD_PREDICTOR_, x)
 #define ENCODING(x) CONCAT(FLIGHT_LOG_FIELD_ENCODING_, x)
 #define CONDITION(x) CONCAT(FLIGHT_LOG_FIELD_CONDITION_, x)
+#define GROUP(x) CONCAT(BLACKBOX_FIELD_GROUP_, x)
 #define UNSIGNED FLIGHT_LOG_FIELD_UNSIGNED
 #define SIGNED FLIGHT_LOG_FIELD_SIGNED
 
@@ -113,7 +124,8 @@ static const char* const blackboxFieldHeaderNames[] = {
     "predictor",
     "encoding",
     "predictor",
-    "encoding"
+    "encoding",
+    "rate"
 };
 
 /* All field definition structs should look like this (but with longer arrs): */
@@ -126,7 +138,8 @@ typedef struct blackboxFieldDefinition_s {
     uint8_t arr[1];
 } blackboxFieldDefinition_t;
 
-#define BLACKBOX_DELTA_FIELD_HEADER_COUNT       ARRAYLEN(blackboxFieldHeaderNames)
+#define BLACKBOX_RATED_FIELD_HEADER_COUNT       ARRAYLEN(blackboxFieldHeaderNames)
+#define BLACKBOX_DELTA_FIELD_HEADER_COUNT       (BLACKBOX_RATED_FIELD_HEADER_COUNT - 1)
 #define BLACKBOX_SIMPLE_FIELD_HEADER_COUNT      (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)
 #define BLACKBOX_CONDITIONAL_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)
 
@@ -159,6 +172,7 @@ typedef struct blackboxDeltaFieldDefinition_s {
     uint8_t Ppredict;
     uint8_t Pencode;
     uint8_t condition; // Decide whether this field should appear in the log
+    uint8_t group; // blackboxFieldGroup_e, for the field mask and the P-frame rate
 } blackboxDeltaFieldDefinition_t;
 
 /**
@@ -169,69 +183,74 @@ typedef struct blackboxDeltaFieldDefinition_s {
  */
 static const blackboxDeltaFieldDefinition_t blackboxMainFields[] = {
     /* loopIteration doesn't appear in P frames since it always increments */
-    {"loopIteration",-1, UNSIGNED, .Ipredict = PREDICT(0),     .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(INC),           .Pencode = FLIGHT_LOG_FIELD_ENCODING_NULL, CONDITION(ALWAYS)},
+    {"loopIteration",-1, UNSIGNED, .Ipredict = PREDICT(0),     .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(INC),           .Pencode = FLIGHT_LOG_FIELD_ENCODING_NULL, CONDITION(ALWAYS), GROUP(FRAME)},
     /* Time advances pretty steadily so the P-frame prediction is a straight line */
-    {"time",       -1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(STRAIGHT_LINE), .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisP",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisP",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisP",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
+    {"time",       -1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(STRAIGHT_LINE), .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(FRAME)},
+    {"axisP",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisP",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisP",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(PIDS)},
     /* I terms get special packed encoding in P frames: */
-    {"axisI",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
-    {"axisI",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
-    {"axisI",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS)},
-    {"axisD",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_0)},
-    {"axisD",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_1)},
-    {"axisD",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_2)},
-    {"axisF",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisF",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"axisF",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
+    {"axisI",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisI",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisI",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG2_3S32), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisD",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_0), GROUP(PIDS)},
+    {"axisD",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_1), GROUP(PIDS)},
+    {"axisD",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(NONZERO_PID_D_2), GROUP(PIDS)},
+    {"axisF",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisF",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(PIDS)},
+    {"axisF",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(PIDS)},
     /* rcCommands are encoded together as a group in P-frames: */
-    {"rcCommand",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"rcCommand",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
-    {"rcCommand",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"rcCommand",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS), GROUP(RC)},
+    {"rcCommand",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS), GROUP(RC)},
+    {"rcCommand",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS), GROUP(RC)},
     /* Throttle is always in the range [minthrottle..maxthrottle]: */
-    {"rcCommand",   3, UNSIGNED, .Ipredict = PREDICT(MINTHROTTLE), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS)},
+    {"rcCommand",   3, UNSIGNED, .Ipredict = PREDICT(MINTHROTTLE), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_4S16), CONDITION(ALWAYS), GROUP(RC)},
+    /* active gain schedule multipliers in percent, they change slowly so they are packed like the RC commands */
+    {"gainSchedule", 0, UNSIGNED, .Ipredict = PREDICT(0),      .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(GAIN_SCHEDULE), GROUP(GAIN_SCHEDULE)},
+    {"gainSchedule", 1, UNSIGNED, .Ipredict = PREDICT(0),      .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(GAIN_SCHEDULE), GROUP(GAIN_SCHEDULE)},
+    {"gainSchedule", 2, UNSIGNED, .Ipredict = PREDICT(0),      .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(GAIN_SCHEDULE), GROUP(GAIN_SCHEDULE)},
+    {"gainSchedule", 3, UNSIGNED, .Ipredict = PREDICT(0),      .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_4S16), CONDITION(GAIN_SCHEDULE), GROUP(GAIN_SCHEDULE)},
 
-    {"vbatLatest",    -1, UNSIGNED, .Ipredict = PREDICT(VBATREF),  .Iencode = ENCODING(NEG_14BIT),   .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_VBAT},
-    {"amperageLatest",-1, SIGNED,   .Ipredict = PREDICT(0),        .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC},
+    {"vbatLatest",    -1, UNSIGNED, .Ipredict = PREDICT(VBATREF),  .Iencode = ENCODING(NEG_14BIT),   .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_VBAT, GROUP(BATTERY)},
+    {"amperageLatest",-1, SIGNED,   .Ipredict = PREDICT(0),        .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),  .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC, GROUP(BATTERY)},
 
 #ifdef USE_MAG
-    {"magADC",      0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_MAG},
-    {"magADC",      1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_MAG},
-    {"magADC",      2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_MAG},
+    {"magADC",      0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_MAG, GROUP(MAG)},
+    {"magADC",      1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_MAG, GROUP(MAG)},
+    {"magADC",      2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_MAG, GROUP(MAG)},
 #endif
 #ifdef USE_BARO
-    {"BaroAlt",    -1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_BARO},
+    {"BaroAlt",    -1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_BARO, GROUP(ALTITUDE)},
 #endif
 #ifdef USE_RANGEFINDER
-    {"surfaceRaw",   -1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER},
+    {"surfaceRaw",   -1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER, GROUP(ALTITUDE)},
 #endif
-    {"rssi",       -1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_RSSI},
+    {"rssi",       -1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(TAG8_8SVB), FLIGHT_LOG_FIELD_CONDITION_RSSI, GROUP(RSSI)},
 
     /* Gyros and accelerometers base their P-predictions on the average of the previous 2 frames to reduce noise impact */
-    {"gyroADC",     0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"gyroADC",     1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"gyroADC",     2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS)},
-    {"accSmooth",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC},
-    {"accSmooth",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC},
-    {"accSmooth",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC},
-    {"debug",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG},
-    {"debug",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG},
-    {"debug",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG},
-    {"debug",       3, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"gyroADC",     0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(GYRO)},
+    {"gyroADC",     1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(GYRO)},
+    {"gyroADC",     2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(ALWAYS), GROUP(GYRO)},
+    {"accSmooth",   0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC, GROUP(ACC)},
+    {"accSmooth",   1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC, GROUP(ACC)},
+    {"accSmooth",   2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_ACC, GROUP(ACC)},
+    {"debug",       0, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG, GROUP(DEBUG)},
+    {"debug",       1, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG, GROUP(DEBUG)},
+    {"debug",       2, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG, GROUP(DEBUG)},
+    {"debug",       3, SIGNED,   .Ipredict = PREDICT(0),       .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), FLIGHT_LOG_FIELD_CONDITION_DEBUG, GROUP(DEBUG)},
     /* Motors only rarely drops under minthrottle (when stick falls below mincommand), so predict minthrottle for it and use *unsigned* encoding (which is large for negative numbers but more compact for positive ones): */
-    {"motor",       0, UNSIGNED, .Ipredict = PREDICT(MINMOTOR), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(AVERAGE_2), .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_1)},
+    {"motor",       0, UNSIGNED, .Ipredict = PREDICT(MINMOTOR), .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(AVERAGE_2), .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_1), GROUP(MOTORS)},
     /* Subsequent motors base their I-frame values on the first one, P-frame values on the average of last two frames: */
-    {"motor",       1, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_2)},
-    {"motor",       2, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_3)},
-    {"motor",       3, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_4)},
-    {"motor",       4, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_5)},
-    {"motor",       5, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_6)},
-    {"motor",       6, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_7)},
-    {"motor",       7, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_8)},
+    {"motor",       1, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_2), GROUP(MOTORS)},
+    {"motor",       2, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_3), GROUP(MOTORS)},
+    {"motor",       3, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_4), GROUP(MOTORS)},
+    {"motor",       4, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_5), GROUP(MOTORS)},
+    {"motor",       5, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_6), GROUP(MOTORS)},
+    {"motor",       6, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_7), GROUP(MOTORS)},
+    {"motor",       7, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_8), GROUP(MOTORS)},
 
     /* Tricopter tail servo */
-    {"servo",       5, UNSIGNED, .Ipredict = PREDICT(1500),    .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(TRICOPTER)}
+    {"servo",       5, UNSIGNED, .Ipredict = PREDICT(1500),    .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(TRICOPTER), GROUP(MOTORS)}
 };
 
 #ifdef USE_GPS
@@ -263,24 +282,18 @@ static const blackboxSimpleFieldDefinition_t blackboxSlowFields[] = {
     {"rxFlightChannelsValid", -1, UNSIGNED, PREDICT(0),      ENCODING(TAG2_3S32)}
 };
 
-typedef enum BlackboxState {
-    BLACKBOX_STATE_DISABLED = 0,
-    BLACKBOX_STATE_STOPPED,
-    BLACKBOX_STATE_PREPARE_LOG_FILE,
-    BLACKBOX_STATE_SEND_HEADER,
-    BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER,
-    BLACKBOX_STATE_SEND_GPS_H_HEADER,
-    BLACKBOX_STATE_SEND_GPS_G_HEADER,
-    BLACKBOX_STATE_SEND_SLOW_HEADER,
-    BLACKBOX_STATE_SEND_SYSINFO,
-    BLACKBOX_STATE_PAUSED,
-    BLACKBOX_STATE_RUNNING,
-    BLACKBOX_STATE_SHUTTING_DOWN,
-    BLACKBOX_STATE_START_ERASE,
-    BLACKBOX_STATE_ERASING,
-    BLACKBOX_STATE_ERASED
-} BlackboxState;
+#ifdef USE_BLACKBOX_BURST
+// Raw gyro burst frame, the samples announced by the gyro burst event
+static const blackboxSimpleFieldDefinition_t blackboxBurstFields[] = {
+    {"timeDelta",             -1, UNSIGNED, PREDICT(0),        ENCODING(UNSIGNED_VB)},
+    {"gyroRaw",                0, SIGNED,   PREDICT(PREVIOUS), ENCODING(SIGNED_VB)},
+    {"gyroRaw",                1, SIGNED,   PREDICT(PREVIOUS), ENCODING(SIGNED_VB)},
+    {"gyroRaw",                2, SIGNED,   PREDICT(PREVIOUS), ENCODING(SIGNED_VB)}
+};
 
+// The header names the gyro burst event by number
+STATIC_ASSERT(FLIGHT_LOG_EVENT_GYRO_BURST == 40, gyro_burst_event_header_out_of_date);
+#endif
 
 typedef struct blackboxMainState_s {
     uint32_t time;
@@ -291,6 +304,7 @@ typedef struct blackboxMainState_s {
     int32_t axisPID_F[XYZ_AXIS_COUNT];
 
     int16_t rcCommand[4];
+    int16_t gainSchedule[GAIN_SCHEDULE_TERM_COUNT];
     int16_t gyroADC[XYZ_AXIS_COUNT];
     int16_t accADC[XYZ_AXIS_COUNT];
     int16_t debug[DEBUG16_VALUE_COUNT];
@@ -330,7 +344,7 @@ typedef struct blackboxSlowState_s {
 //From rc_controls.c
 extern boxBitmask_t rcModeActivationMask;
 
-static BlackboxState blackboxState = BLACKBOX_STATE_DISABLED;
+STATIC_UNIT_TESTED BlackboxState blackboxState = BLACKBOX_STATE_DISABLED;
 
 static uint32_t blackboxLastArmingBeep = 0;
 static uint32_t blackboxLastFlightModeFlags = 0; // New event tracking of flight modes
@@ -362,6 +376,11 @@ STATIC_UNIT_TESTED int16_t blackboxIInterval = 0;
 // number of flight loop iterations before logging P-frame
 STATIC_UNIT_TESTED int16_t blackboxPInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSInterval = 0;
+// Sampled from the device every iteration, P-frames are thinned to 1/2^level while it is non-zero
+STATIC_UNIT_TESTED uint8_t blackboxBackpressureLevel;
+static uint8_t blackboxLoggedBackpressureLevel;
+// Chunks the device had dropped when the last frame was encoded
+static uint32_t blackboxLoggedDeviceDroppedFrames;
 STATIC_UNIT_TESTED int32_t blackboxSlowFrameIterationTimer;
 static bool blackboxLoggedAnyFrames;
 
@@ -381,6 +400,166 @@ static blackboxMainState_t blackboxHistoryRing[3];
 // These point into blackboxHistoryRing, use them to know where to store history of a given age (0, 1 or 2 generations old)
 static blackboxMainState_t* blackboxHistory[3];
 
+/*
+ * The PID loop only snapshots the main state into this single-producer/single-consumer queue; the predictors and
+ * the encoding run later in the blackbox task. When the queue is full the incoming snapshot is dropped (never one
+ * the encoder may be reading) and the next snapshot that fits is logged as an I-frame behind a LOGGING_RESUME event,
+ * so the decoder sees the gap as intentional.
+ */
+#ifndef BLACKBOX_FRAME_QUEUE_SIZE
+#define BLACKBOX_FRAME_QUEUE_SIZE 16 // must be a power of 2
+#endif
+
+STATIC_ASSERT((BLACKBOX_FRAME_QUEUE_SIZE & (BLACKBOX_FRAME_QUEUE_SIZE - 1)) == 0, blackbox_frame_queue_size_not_power_of_2);
+
+typedef struct blackboxQueuedFrame_s {
+    blackboxMainState_t state;
+    uint32_t iteration;
+    bool intraframe;
+    bool resync;         // frames were dropped before this one
+    bool gpsHomeDue;
+    uint8_t backpressureLevel;
+} blackboxQueuedFrame_t;
+
+static blackboxQueuedFrame_t blackboxFrameQueue[BLACKBOX_FRAME_QUEUE_SIZE];
+static volatile uint8_t blackboxFrameQueueHead; // only written by the PID loop
+static volatile uint8_t blackboxFrameQueueTail; // only written by the encoder
+STATIC_UNIT_TESTED uint32_t blackboxDroppedFrameCount;
+static bool blackboxFrameDropped;
+static bool blackboxGpsHomeFrameDue;
+
+/*
+ * Events are queued the same way by whichever task logs them, and written by the encoder ahead of the first frame
+ * queued after them.
+ */
+#ifndef BLACKBOX_EVENT_QUEUE_SIZE
+#define BLACKBOX_EVENT_QUEUE_SIZE 4 // must be a power of 2
+#endif
+
+STATIC_ASSERT((BLACKBOX_EVENT_QUEUE_SIZE & (BLACKBOX_EVENT_QUEUE_SIZE - 1)) == 0, blackbox_event_queue_size_not_power_of_2);
+
+typedef struct blackboxQueuedEvent_s {
+    flightLogEvent_t event;
+    uint8_t frameIndex;  // blackboxFrameQueueHead when the event was logged
+} blackboxQueuedEvent_t;
+
+static blackboxQueuedEvent_t blackboxEventQueue[BLACKBOX_EVENT_QUEUE_SIZE];
+static volatile uint8_t blackboxEventQueueHead;
+static volatile uint8_t blackboxEventQueueTail;
+STATIC_UNIT_TESTED uint32_t blackboxDroppedEventCount;
+
+STATIC_UNIT_TESTED void blackboxEncodeQueuedFrames(void);
+static bool blackboxEncodeQueueEmpty(void);
+
+#if defined(USE_BLACKBOX_COLUMNAR) || defined(USE_BLACKBOX_BURST)
+/*
+ * RAM for the columnar blocks and the gyro burst ring is taken from the workspace when logging starts, sized for the
+ * fields the log carries and for the burst window, so a feature that is not in use takes none of it.
+ *
+ * The default holds a 512 sample burst window, or a columnar log of 16 fields. A columnar log of every field takes
+ * about 12KB, targets with the RAM to spare define a larger BLACKBOX_WORKSPACE_SIZE.
+ */
+#ifndef BLACKBOX_WORKSPACE_SIZE
+#define BLACKBOX_WORKSPACE_SIZE 4096
+#endif
+
+static uint32_t blackboxWorkspace[BLACKBOX_WORKSPACE_SIZE / sizeof(uint32_t)];
+STATIC_UNIT_TESTED uint16_t blackboxWorkspaceUsed; // words
+
+// Returns NULL if what is left of the workspace is too small
+static void *blackboxWorkspaceAlloc(size_t size)
+{
+    const size_t words = (size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    if (words > ARRAYLEN(blackboxWorkspace) - blackboxWorkspaceUsed) {
+        return NULL;
+    }
+
+    void *ptr = &blackboxWorkspace[blackboxWorkspaceUsed];
+    blackboxWorkspaceUsed += words;
+    return ptr;
+}
+
+#ifdef USE_BLACKBOX_BURST
+static size_t blackboxWorkspaceFree(void)
+{
+    return (ARRAYLEN(blackboxWorkspace) - blackboxWorkspaceUsed) * sizeof(uint32_t);
+}
+#endif
+#endif
+
+#ifdef USE_BLACKBOX_COLUMNAR
+// Cached when logging starts, since the header must agree with the data
+static bool blackboxColumnar;
+static blackboxColumnarBlock_t blackboxColumnarBlocks[2];
+static uint8_t blackboxColumnarFillIndex;
+static blackboxColumnarEncoder_t blackboxColumnarEncoder;
+static bool blackboxColumnarEncoding;
+static uint8_t blackboxColumnarColumnsPerFrame;
+
+STATIC_ASSERT(ARRAYLEN(blackboxMainFields) <= BLACKBOX_COLUMNAR_MAX_COLUMNS, too_many_blackbox_columns);
+#endif
+
+/*
+ * The main frame is written as a sequence of items. The write plan lists the items each frame carries, so the encoder
+ * doesn't test the field conditions, the field mask and the field rates on every frame.
+ */
+typedef enum {
+    BLACKBOX_ITEM_PID_P = 0,
+    BLACKBOX_ITEM_PID_I,
+    BLACKBOX_ITEM_PID_D_ROLL,
+    BLACKBOX_ITEM_PID_D_PITCH,
+    BLACKBOX_ITEM_PID_D_YAW,
+    BLACKBOX_ITEM_PID_F,
+    BLACKBOX_ITEM_RC,
+    BLACKBOX_ITEM_GAIN_SCHEDULE,
+    BLACKBOX_ITEM_VBAT,
+    BLACKBOX_ITEM_AMPERAGE,
+    BLACKBOX_ITEM_MAG,
+    BLACKBOX_ITEM_BARO,
+    BLACKBOX_ITEM_RANGEFINDER,
+    BLACKBOX_ITEM_RSSI,
+    BLACKBOX_ITEM_GYRO,
+    BLACKBOX_ITEM_ACC,
+    BLACKBOX_ITEM_DEBUG,
+    BLACKBOX_ITEM_MOTORS,
+    BLACKBOX_ITEM_SERVO,
+    BLACKBOX_ITEM_COUNT
+} blackboxItem_e;
+
+#define ITEM(x) BIT(CONCAT(BLACKBOX_ITEM_, x))
+
+// Must agree with the conditions and groups of the matching fields in blackboxMainFields
+static const struct {
+    uint8_t condition;
+    uint8_t group;
+} blackboxItems[BLACKBOX_ITEM_COUNT] = {
+    [BLACKBOX_ITEM_PID_P]           = { CONDITION(ALWAYS),              GROUP(PIDS) },
+    [BLACKBOX_ITEM_PID_I]           = { CONDITION(ALWAYS),              GROUP(PIDS) },
+    [BLACKBOX_ITEM_PID_D_ROLL]      = { CONDITION(NONZERO_PID_D_0),     GROUP(PIDS) },
+    [BLACKBOX_ITEM_PID_D_PITCH]     = { CONDITION(NONZERO_PID_D_1),     GROUP(PIDS) },
+    [BLACKBOX_ITEM_PID_D_YAW]       = { CONDITION(NONZERO_PID_D_2),     GROUP(PIDS) },
+    [BLACKBOX_ITEM_PID_F]           = { CONDITION(ALWAYS),              GROUP(PIDS) },
+    [BLACKBOX_ITEM_RC]              = { CONDITION(ALWAYS),              GROUP(RC) },
+    [BLACKBOX_ITEM_GAIN_SCHEDULE]   = { CONDITION(GAIN_SCHEDULE),       GROUP(GAIN_SCHEDULE) },
+    [BLACKBOX_ITEM_VBAT]            = { CONDITION(VBAT),                GROUP(BATTERY) },
+    [BLACKBOX_ITEM_AMPERAGE]        = { CONDITION(AMPERAGE_ADC),        GROUP(BATTERY) },
+    [BLACKBOX_ITEM_MAG]             = { CONDITION(MAG),                 GROUP(MAG) },
+    [BLACKBOX_ITEM_BARO]            = { CONDITION(BARO),                GROUP(ALTITUDE) },
+    [BLACKBOX_ITEM_RANGEFINDER]     = { CONDITION(RANGEFINDER),         GROUP(ALTITUDE) },
+    [BLACKBOX_ITEM_RSSI]            = { CONDITION(RSSI),                GROUP(RSSI) },
+    [BLACKBOX_ITEM_GYRO]            = { CONDITION(ALWAYS),              GROUP(GYRO) },
+    [BLACKBOX_ITEM_ACC]             = { CONDITION(ACC),                 GROUP(ACC) },
+    [BLACKBOX_ITEM_DEBUG]           = { CONDITION(DEBUG),               GROUP(DEBUG) },
+    [BLACKBOX_ITEM_MOTORS]          = { CONDITION(AT_LEAST_MOTORS_1),   GROUP(MOTORS) },
+    [BLACKBOX_ITEM_SERVO]           = { CONDITION(TRICOPTER),           GROUP(MOTORS) },
+};
+
+// Items of an I-frame, and of the n-th P-frame after it (modulo the largest field rate divisor)
+static uint32_t blackboxIntraframePlan;
+static uint32_t blackboxInterframePlan[BLACKBOX_FIELD_RATE_DENOM_MAX];
+static uint8_t blackboxInterframeIndex;
+
 static bool blackboxModeActivationConditionPresent = false;
 
 /**
@@ -459,6 +638,9 @@ static bool testBlackboxConditionUncached(FlightLogFieldCondition condition)
     case FLIGHT_LOG_FIELD_CONDITION_DEBUG:
         return debugMode != DEBUG_NONE;
 
+    case FLIGHT_LOG_FIELD_CONDITION_GAIN_SCHEDULE:
+        return gainScheduleConfig()->enabled;
+
     case FLIGHT_LOG_FIELD_CONDITION_NEVER:
         return false;
 
@@ -482,6 +664,54 @@ static bool testBlackboxCondition(FlightLogFieldCondition condition)
     return (blackboxConditionCache & (1 << condition)) != 0;
 }
 
+static bool blackboxFieldGroupEnabled(uint8_t group)
+{
+    return group >= BLACKBOX_FIELD_GROUP_COUNT || !(blackboxConfig()->fields_disabled_mask & BIT(group));
+}
+
+/**
+ * Return the number of P-frames per write of the fields in the given group, a power of 2.
+ */
+static int blackboxFieldGroupRateDenom(uint8_t group)
+{
+#ifdef USE_BLACKBOX_COLUMNAR
+    // A columnar block holds every field of every frame, a value that doesn't change already costs next to nothing
+    if (blackboxColumnar) {
+        return 1;
+    }
+#endif
+    if (group >= BLACKBOX_FIELD_GROUP_COUNT) {
+        return 1;
+    }
+
+    return 1 << MIN(blackboxConfig()->field_rate[group], BLACKBOX_FIELD_RATE_COUNT - 1);
+}
+
+/*
+ * A P-frame n frames after the last I-frame carries a field if n is a multiple of the divisor of its group. Like the
+ * conditions, this must not change while logging since the header announces it.
+ */
+static void blackboxBuildWritePlan(void)
+{
+    blackboxIntraframePlan = 0;
+    for (int item = 0; item < BLACKBOX_ITEM_COUNT; item++) {
+        if (testBlackboxCondition(blackboxItems[item].condition) && blackboxFieldGroupEnabled(blackboxItems[item].group)) {
+            blackboxIntraframePlan |= BIT(item);
+        }
+    }
+
+    for (int frame = 0; frame < BLACKBOX_FIELD_RATE_DENOM_MAX; frame++) {
+        blackboxInterframePlan[frame] = 0;
+        for (int item = 0; item < BLACKBOX_ITEM_COUNT; item++) {
+            if ((blackboxIntraframePlan & BIT(item)) && frame % blackboxFieldGroupRateDenom(blackboxItems[item].group) == 0) {
+                blackboxInterframePlan[frame] |= BIT(item);
+            }
+        }
+    }
+
+    blackboxInterframeIndex = 0;
+}
+
 static void blackboxSetState(BlackboxState newState)
 {
     //Perform initial setup required for the new state
@@ -498,6 +728,7 @@ static void blackboxSetState(BlackboxState newState)
     case BLACKBOX_STATE_SEND_GPS_G_HEADER:
     case BLACKBOX_STATE_SEND_GPS_H_HEADER:
     case BLACKBOX_STATE_SEND_SLOW_HEADER:
+    case BLACKBOX_STATE_SEND_BURST_HEADER:
         xmitState.headerIndex = 0;
         xmitState.u.fieldIndex = -1;
         break;
@@ -507,8 +738,16 @@ static void blackboxSetState(BlackboxState newState)
     case BLACKBOX_STATE_RUNNING:
         blackboxSlowFrameIterationTimer = blackboxSInterval; //Force a slow frame to be written on the first iteration
         break;
+    case BLACKBOX_STATE_SEND_BURST:
+        xmitState.headerIndex = 0;
+        break;
     case BLACKBOX_STATE_SHUTTING_DOWN:
         xmitState.u.startTime = millis();
+        FALLTHROUGH;
+    case BLACKBOX_STATE_STOPPED:
+#ifdef USE_BLACKBOX_BURST
+        blackboxBurstStop();
+#endif
         break;
     default:
         ;
@@ -516,37 +755,53 @@ static void blackboxSetState(BlackboxState newState)
     blackboxState = newState;
 }
 
-static void writeIntraframe(void)
+static void writeIntraframe(uint32_t iteration)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
     blackboxWrite('I');
 
-    blackboxWriteUnsignedVB(blackboxIteration);
+    blackboxWriteUnsignedVB(iteration);
     blackboxWriteUnsignedVB(blackboxCurrent->time);
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
+    const uint32_t plan = blackboxIntraframePlan;
+
+    if (plan & ITEM(PID_P)) {
+        blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
+    }
+    if (plan & ITEM(PID_I)) {
+        blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
+    }
 
     // Don't bother writing the current D term if the corresponding PID setting is zero
     for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
-        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+        if (plan & BIT(BLACKBOX_ITEM_PID_D_ROLL + x)) {
             blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
         }
     }
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_F, XYZ_AXIS_COUNT);
+    if (plan & ITEM(PID_F)) {
+        blackboxWriteSignedVBArray(blackboxCurrent->axisPID_F, XYZ_AXIS_COUNT);
+    }
 
-    // Write roll, pitch and yaw first:
-    blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
+    if (plan & ITEM(RC)) {
+        // Write roll, pitch and yaw first:
+        blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
 
-    /*
-     * Write the throttle separately from the rest of the RC data so we can apply a predictor to it.
-     * Throttle lies in range [minthrottle..maxthrottle]:
-     */
-    blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE] - motorConfig()->minthrottle);
+        /*
+         * Write the throttle separately from the rest of the RC data so we can apply a predictor to it.
+         * Throttle lies in range [minthrottle..maxthrottle]:
+         */
+        blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE] - motorConfig()->minthrottle);
+    }
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+    if (plan & ITEM(GAIN_SCHEDULE)) {
+        for (int x = 0; x < GAIN_SCHEDULE_TERM_COUNT; x++) {
+            blackboxWriteUnsignedVB(blackboxCurrent->gainSchedule[x]);
+        }
+    }
+
+    if (plan & ITEM(VBAT)) {
         /*
          * Our voltage is expected to decrease over the course of the flight, so store our difference from
          * the reference:
@@ -556,52 +811,56 @@ static void writeIntraframe(void)
         blackboxWriteUnsignedVB((vbatReference - blackboxCurrent->vbatLatest) & 0x3FFF);
     }
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
+    if (plan & ITEM(AMPERAGE)) {
         // 12bit value directly from ADC
         blackboxWriteSignedVB(blackboxCurrent->amperageLatest);
     }
 
 #ifdef USE_MAG
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+    if (plan & ITEM(MAG)) {
         blackboxWriteSigned16VBArray(blackboxCurrent->magADC, XYZ_AXIS_COUNT);
     }
 #endif
 
 #ifdef USE_BARO
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+    if (plan & ITEM(BARO)) {
         blackboxWriteSignedVB(blackboxCurrent->BaroAlt);
     }
 #endif
 
 #ifdef USE_RANGEFINDER
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER)) {
+    if (plan & ITEM(RANGEFINDER)) {
         blackboxWriteSignedVB(blackboxCurrent->surfaceRaw);
     }
 #endif
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+    if (plan & ITEM(RSSI)) {
         blackboxWriteUnsignedVB(blackboxCurrent->rssi);
     }
 
-    blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
+    if (plan & ITEM(GYRO)) {
+        blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
+    }
+    if (plan & ITEM(ACC)) {
         blackboxWriteSigned16VBArray(blackboxCurrent->accADC, XYZ_AXIS_COUNT);
     }
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+    if (plan & ITEM(DEBUG)) {
         blackboxWriteSigned16VBArray(blackboxCurrent->debug, DEBUG16_VALUE_COUNT);
     }
 
-    //Motors can be below minimum output when disarmed, but that doesn't happen much
-    blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
+    if (plan & ITEM(MOTORS)) {
+        //Motors can be below minimum output when disarmed, but that doesn't happen much
+        blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
 
-    //Motors tend to be similar to each other so use the first motor's value as a predictor of the others
-    const int motorCount = getMotorCount();
-    for (int x = 1; x < motorCount; x++) {
-        blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+        //Motors tend to be similar to each other so use the first motor's value as a predictor of the others
+        const int motorCount = getMotorCount();
+        for (int x = 1; x < motorCount; x++) {
+            blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+        }
     }
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
+    if (plan & ITEM(SERVO)) {
         //Assume the tail spends most of its time around the center
         blackboxWriteSignedVB(blackboxCurrent->servo[5] - 1500);
     }
@@ -632,7 +891,78 @@ static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHist
     }
 }
 
-static void writeInterframe(void)
+/*
+ * A field left out of a P-frame repeats its previous value, here and in the decoder, so the predictors of the next
+ * frame that carries it work from the last value that was written.
+ */
+static void blackboxHoldSkippedItems(blackboxMainState_t *current, const blackboxMainState_t *last, uint32_t plan)
+{
+    const uint32_t skipped = blackboxIntraframePlan & ~plan;
+
+    if (!skipped) {
+        return;
+    }
+
+    if (skipped & ITEM(PID_P)) {
+        memcpy(current->axisPID_P, last->axisPID_P, sizeof(current->axisPID_P));
+    }
+    if (skipped & ITEM(PID_I)) {
+        memcpy(current->axisPID_I, last->axisPID_I, sizeof(current->axisPID_I));
+    }
+    if (skipped & (ITEM(PID_D_ROLL) | ITEM(PID_D_PITCH) | ITEM(PID_D_YAW))) {
+        memcpy(current->axisPID_D, last->axisPID_D, sizeof(current->axisPID_D));
+    }
+    if (skipped & ITEM(PID_F)) {
+        memcpy(current->axisPID_F, last->axisPID_F, sizeof(current->axisPID_F));
+    }
+    if (skipped & ITEM(RC)) {
+        memcpy(current->rcCommand, last->rcCommand, sizeof(current->rcCommand));
+    }
+    if (skipped & ITEM(GAIN_SCHEDULE)) {
+        memcpy(current->gainSchedule, last->gainSchedule, sizeof(current->gainSchedule));
+    }
+    if (skipped & ITEM(VBAT)) {
+        current->vbatLatest = last->vbatLatest;
+    }
+    if (skipped & ITEM(AMPERAGE)) {
+        current->amperageLatest = last->amperageLatest;
+    }
+#ifdef USE_MAG
+    if (skipped & ITEM(MAG)) {
+        memcpy(current->magADC, last->magADC, sizeof(current->magADC));
+    }
+#endif
+#ifdef USE_BARO
+    if (skipped & ITEM(BARO)) {
+        current->BaroAlt = last->BaroAlt;
+    }
+#endif
+#ifdef USE_RANGEFINDER
+    if (skipped & ITEM(RANGEFINDER)) {
+        current->surfaceRaw = last->surfaceRaw;
+    }
+#endif
+    if (skipped & ITEM(RSSI)) {
+        current->rssi = last->rssi;
+    }
+    if (skipped & ITEM(GYRO)) {
+        memcpy(current->gyroADC, last->gyroADC, sizeof(current->gyroADC));
+    }
+    if (skipped & ITEM(ACC)) {
+        memcpy(current->accADC, last->accADC, sizeof(current->accADC));
+    }
+    if (skipped & ITEM(DEBUG)) {
+        memcpy(current->debug, last->debug, sizeof(current->debug));
+    }
+    if (skipped & ITEM(MOTORS)) {
+        memcpy(current->motor, last->motor, sizeof(current->motor));
+    }
+    if (skipped & ITEM(SERVO)) {
+        current->servo[5] = last->servo[5];
+    }
+}
+
+static void writeInterframe(uint32_t plan)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
@@ -648,52 +978,67 @@ static void writeInterframe(void)
     blackboxWriteSignedVB((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
 
     int32_t deltas[8];
-    arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    if (plan & ITEM(PID_P)) {
+        arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
+        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    }
 
-    /*
-     * The PID I field changes very slowly, most of the time +-2, so use an encoding
-     * that can pack all three fields into one byte in that situation.
-     */
-    arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
-    blackboxWriteTag2_3S32(deltas);
+    if (plan & ITEM(PID_I)) {
+        /*
+         * The PID I field changes very slowly, most of the time +-2, so use an encoding
+         * that can pack all three fields into one byte in that situation.
+         */
+        arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
+        blackboxWriteTag2_3S32(deltas);
+    }
 
     /*
      * The PID D term is frequently set to zero for yaw, which makes the result from the calculation
      * always zero. So don't bother recording D results when PID D terms are zero.
      */
     for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
-        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+        if (plan & BIT(BLACKBOX_ITEM_PID_D_ROLL + x)) {
             blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
         }
     }
 
-    arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    if (plan & ITEM(PID_F)) {
+        arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
+        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    }
 
-    /*
-     * RC tends to stay the same or fairly small for many frames at a time, so use an encoding that
-     * can pack multiple values per byte:
-     */
-    for (int x = 0; x < 4; x++) {
-        deltas[x] = blackboxCurrent->rcCommand[x] - blackboxLast->rcCommand[x];
+    if (plan & ITEM(RC)) {
+        /*
+         * RC tends to stay the same or fairly small for many frames at a time, so use an encoding that
+         * can pack multiple values per byte:
+         */
+        for (int x = 0; x < 4; x++) {
+            deltas[x] = blackboxCurrent->rcCommand[x] - blackboxLast->rcCommand[x];
+        }
+
+        blackboxWriteTag8_4S16(deltas);
     }
 
-    blackboxWriteTag8_4S16(deltas);
+    if (plan & ITEM(GAIN_SCHEDULE)) {
+        for (int x = 0; x < GAIN_SCHEDULE_TERM_COUNT; x++) {
+            deltas[x] = blackboxCurrent->gainSchedule[x] - blackboxLast->gainSchedule[x];
+        }
+        blackboxWriteTag8_4S16(deltas);
+    }
 
     //Check for sensors that are updated periodically (so deltas are normally zero)
     int optionalFieldCount = 0;
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+    if (plan & ITEM(VBAT)) {
         deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->vbatLatest - blackboxLast->vbatLatest;
     }
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
+    if (plan & ITEM(AMPERAGE)) {
         deltas[optionalFieldCount++] = blackboxCurrent->amperageLatest - blackboxLast->amperageLatest;
     }
 
 #ifdef USE_MAG
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+    if (plan & ITEM(MAG)) {
         for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
             deltas[optionalFieldCount++] = blackboxCurrent->magADC[x] - blackboxLast->magADC[x];
         }
@@ -701,34 +1046,38 @@ static void writeInterframe(void)
 #endif
 
 #ifdef USE_BARO
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+    if (plan & ITEM(BARO)) {
         deltas[optionalFieldCount++] = blackboxCurrent->BaroAlt - blackboxLast->BaroAlt;
     }
 #endif
 
 #ifdef USE_RANGEFINDER
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER)) {
+    if (plan & ITEM(RANGEFINDER)) {
         deltas[optionalFieldCount++] = blackboxCurrent->surfaceRaw - blackboxLast->surfaceRaw;
     }
 #endif
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+    if (plan & ITEM(RSSI)) {
         deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
     }
 
     blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
 
     //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
+    if (plan & ITEM(GYRO)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC), XYZ_AXIS_COUNT);
+    }
+    if (plan & ITEM(ACC)) {
         blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
     }
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+    if (plan & ITEM(DEBUG)) {
         blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
     }
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+    if (plan & ITEM(MOTORS)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor), getMotorCount());
+    }
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
+    if (plan & ITEM(SERVO)) {
         blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
     }
 
@@ -740,12 +1089,213 @@ static void writeInterframe(void)
     blackboxLoggedAnyFrames = true;
 }
 
+#ifdef USE_BLACKBOX_COLUMNAR
+/*
+ * Fill 'values' with the main frame fields in the order of the field header, with the I-frame predictors applied.
+ * Must agree with writeIntraframe(). Returns the number of fields.
+ */
+static int loadColumnarFields(const blackboxMainState_t *state, uint32_t iteration, int32_t *values)
+{
+    const uint32_t plan = blackboxIntraframePlan;
+    int n = 0;
+
+    values[n++] = iteration;
+    values[n++] = state->time;
+
+    if (plan & ITEM(PID_P)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            values[n++] = state->axisPID_P[x];
+        }
+    }
+    if (plan & ITEM(PID_I)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            values[n++] = state->axisPID_I[x];
+        }
+    }
+    for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+        if (plan & BIT(BLACKBOX_ITEM_PID_D_ROLL + x)) {
+            values[n++] = state->axisPID_D[x];
+        }
+    }
+    if (plan & ITEM(PID_F)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            values[n++] = state->axisPID_F[x];
+        }
+    }
+
+    if (plan & ITEM(RC)) {
+        for (int x = 0; x < 3; x++) {
+            values[n++] = state->rcCommand[x];
+        }
+        values[n++] = state->rcCommand[THROTTLE] - motorConfig()->minthrottle;
+    }
+
+    if (plan & ITEM(GAIN_SCHEDULE)) {
+        for (int x = 0; x < GAIN_SCHEDULE_TERM_COUNT; x++) {
+            values[n++] = state->gainSchedule[x];
+        }
+    }
+
+    if (plan & ITEM(VBAT)) {
+        values[n++] = (vbatReference - state->vbatLatest) & 0x3FFF;
+    }
+
+    if (plan & ITEM(AMPERAGE)) {
+        values[n++] = state->amperageLatest;
+    }
+
+#ifdef USE_MAG
+    if (plan & ITEM(MAG)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            values[n++] = state->magADC[x];
+        }
+    }
+#endif
+
+#ifdef USE_BARO
+    if (plan & ITEM(BARO)) {
+        values[n++] = state->BaroAlt;
+    }
+#endif
+
+#ifdef USE_RANGEFINDER
+    if (plan & ITEM(RANGEFINDER)) {
+        values[n++] = state->surfaceRaw;
+    }
+#endif
+
+    if (plan & ITEM(RSSI)) {
+        values[n++] = state->rssi;
+    }
+
+    if (plan & ITEM(GYRO)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            values[n++] = state->gyroADC[x];
+        }
+    }
+    if (plan & ITEM(ACC)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            values[n++] = state->accADC[x];
+        }
+    }
+
+    if (plan & ITEM(DEBUG)) {
+        for (int x = 0; x < DEBUG16_VALUE_COUNT; x++) {
+            values[n++] = state->debug[x];
+        }
+    }
+
+    if (plan & ITEM(MOTORS)) {
+        values[n++] = state->motor[0] - motorOutputLow;
+        const int motorCount = getMotorCount();
+        for (int x = 1; x < motorCount; x++) {
+            values[n++] = state->motor[x] - state->motor[0];
+        }
+    }
+
+    if (plan & ITEM(SERVO)) {
+        values[n++] = state->servo[5] - 1500;
+    }
+
+    return n;
+}
+
+/*
+ * Take the blocks from the workspace when the log is columnar. A log with more fields than fit is written in the
+ * interleaved format instead.
+ */
+static void blackboxColumnarReset(void)
+{
+    int32_t values[BLACKBOX_COLUMNAR_MAX_COLUMNS];
+    const int columnCount = loadColumnarFields(blackboxHistory[0], 0, values);
+
+    blackboxColumnarFillIndex = 0;
+    blackboxColumnarEncoding = false;
+    // Nothing is left to flush from an earlier log
+    blackboxColumnarBlockReset(&blackboxColumnarBlocks[0]);
+
+    if (!blackboxColumnar) {
+        return;
+    }
+    for (int i = 0; i < 2; i++) {
+        blackboxColumnarColumn_t *columns = blackboxWorkspaceAlloc(columnCount * sizeof(blackboxColumnarColumn_t));
+        if (!columns) {
+            blackboxColumnar = false;
+            return;
+        }
+        blackboxColumnarBlockInit(&blackboxColumnarBlocks[i], columns, columnCount);
+    }
+    // Spread each block's encoding over the frames that fill the next one
+    blackboxColumnarColumnsPerFrame = (columnCount + BLACKBOX_COLUMNAR_BLOCK_FRAMES - 1) / BLACKBOX_COLUMNAR_BLOCK_FRAMES + 1;
+}
+
+/*
+ * A block's bytes must not be interleaved with other frames, so anything else that wants to write finishes the
+ * block in progress first.
+ */
+static void blackboxColumnarCompleteBlock(void)
+{
+    while (blackboxColumnarEncoding) {
+        blackboxColumnarEncoding = !blackboxColumnarEncodeColumn(&blackboxColumnarEncoder);
+    }
+}
+
+static void blackboxColumnarStartBlock(void)
+{
+    blackboxColumnarBlock_t *block = &blackboxColumnarBlocks[blackboxColumnarFillIndex];
+
+    // The encoder didn't keep up, finish the previous block now rather than lose it
+    blackboxColumnarCompleteBlock();
+
+    blackboxWrite('B');
+    blackboxColumnarEncodeBegin(&blackboxColumnarEncoder, block, blackboxWrite);
+    blackboxColumnarEncoding = true;
+
+    blackboxColumnarFillIndex ^= 1;
+    blackboxColumnarBlockReset(&blackboxColumnarBlocks[blackboxColumnarFillIndex]);
+}
+
+static void writeColumnarFrame(const blackboxMainState_t *state, uint32_t iteration)
+{
+    int32_t values[BLACKBOX_COLUMNAR_MAX_COLUMNS];
+
+    loadColumnarFields(state, iteration, values);
+
+    if (blackboxColumnarBlockAddFrame(&blackboxColumnarBlocks[blackboxColumnarFillIndex], values)) {
+        blackboxColumnarStartBlock();
+    }
+
+    for (int i = 0; i < blackboxColumnarColumnsPerFrame && blackboxColumnarEncoding; i++) {
+        blackboxColumnarEncoding = !blackboxColumnarEncodeColumn(&blackboxColumnarEncoder);
+    }
+
+    // GPS frames predict their time from the last main frame
+    blackboxHistory[1]->time = state->time;
+
+    blackboxLoggedAnyFrames = true;
+}
+
+// Write out everything logged so far, including a partially filled block
+static void blackboxColumnarFlush(void)
+{
+    blackboxColumnarCompleteBlock();
+    if (blackboxColumnarBlocks[blackboxColumnarFillIndex].frameCount > 0) {
+        blackboxColumnarStartBlock();
+        blackboxColumnarCompleteBlock();
+    }
+}
+#endif // USE_BLACKBOX_COLUMNAR
+
 /* Write the contents of the global "slowHistory" to the log as an "S" frame. Because this data is logged so
  * infrequently, delta updates are not reasonable, so we log independent frames. */
 static void writeSlowFrame(void)
 {
     int32_t values[3];
 
+#ifdef USE_BLACKBOX_COLUMNAR
+    blackboxColumnarCompleteBlock();
+#endif
+
     blackboxWrite('S');
 
     blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
@@ -832,12 +1382,15 @@ static void blackboxResetIterationTimers(void)
     blackboxIFrameIndex = 0;
     blackboxPFrameIndex = 0;
     blackboxSlowFrameIterationTimer = 0;
+    blackboxBackpressureLevel = 0;
+    blackboxLoggedBackpressureLevel = 0;
+    blackboxLoggedDeviceDroppedFrames = 0;
 }
 
 /**
  * Start Blackbox logging if it is not already running. Intended to be called upon arming.
  */
-static void blackboxStart(void)
+STATIC_UNIT_TESTED void blackboxStart(void)
 {
     blackboxValidateConfig();
 
@@ -852,6 +1405,13 @@ static void blackboxStart(void)
     blackboxHistory[1] = &blackboxHistoryRing[1];
     blackboxHistory[2] = &blackboxHistoryRing[2];
 
+    blackboxFrameQueueHead = 0;
+    blackboxFrameQueueTail = 0;
+    blackboxEventQueueHead = 0;
+    blackboxEventQueueTail = 0;
+    blackboxFrameDropped = false;
+    blackboxGpsHomeFrameDue = false;
+
     vbatReference = getBatteryVoltageLatest();
 
     //No need to clear the content of blackboxHistoryRing since our first frame will be an intra which overwrites it
@@ -863,6 +1423,25 @@ static void blackboxStart(void)
      */
     blackboxBuildConditionCache();
 
+    blackboxBuildWritePlan();
+
+#if defined(USE_BLACKBOX_COLUMNAR) || defined(USE_BLACKBOX_BURST)
+    blackboxWorkspaceUsed = 0;
+#endif
+
+#ifdef USE_BLACKBOX_COLUMNAR
+    // The columns follow the write plan
+    blackboxColumnar = blackboxConfig()->format == BLACKBOX_FORMAT_COLUMNAR;
+    blackboxColumnarReset();
+#endif
+
+#ifdef USE_BLACKBOX_BURST
+    // The ring gets what is left after the columnar blocks, the window is clipped to fit
+    const uint16_t burstSamples = MIN(blackboxBurstWindowSamples(blackboxConfig()->burst_ms, gyro.targetLooptime),
+        blackboxWorkspaceFree() / sizeof(blackboxBurstSample_t));
+    blackboxBurstStart(blackboxWorkspaceAlloc(burstSamples * sizeof(blackboxBurstSample_t)), burstSamples, blackboxConfig()->burst_pretrigger);
+#endif
+
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
 
     blackboxResetIterationTimers();
@@ -885,11 +1464,25 @@ void blackboxFinish(void)
     switch (blackboxState) {
     case BLACKBOX_STATE_DISABLED:
     case BLACKBOX_STATE_STOPPED:
+    case BLACKBOX_STATE_SEND_BURST:
     case BLACKBOX_STATE_SHUTTING_DOWN:
         // We're already stopped/shutting down
         break;
     case BLACKBOX_STATE_RUNNING:
     case BLACKBOX_STATE_PAUSED:
+#ifdef USE_BLACKBOX_BURST
+        if (blackboxBurstFreeze()) {
+            // Announce the capture and write it out ahead of the end of the log
+            flightLogEvent_gyroBurst_t eventData;
+            eventData.sampleCount = blackboxBurstSampleCount();
+            eventData.triggerIndex = blackboxBurstTriggerIndex();
+            eventData.trigger = blackboxBurstTriggerSource();
+            eventData.startTime = blackboxBurstStartTime();
+            blackboxLogEvent(FLIGHT_LOG_EVENT_GYRO_BURST, (flightLogEventData_t *)&eventData);
+            blackboxSetState(BLACKBOX_STATE_SEND_BURST);
+            break;
+        }
+#endif
         blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, NULL);
         FALLTHROUGH;
     default:
@@ -949,6 +1542,10 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
+#ifdef USE_BLACKBOX_COLUMNAR
+    blackboxColumnarCompleteBlock();
+#endif
+
     blackboxWrite('H');
 
     blackboxWriteSignedVB(GPS_home[0]);
@@ -961,6 +1558,10 @@ static void writeGPSHomeFrame(void)
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
+#ifdef USE_BLACKBOX_COLUMNAR
+    blackboxColumnarCompleteBlock();
+#endif
+
     blackboxWrite('G');
 
     /*
@@ -990,11 +1591,9 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
 /**
  * Fill the current state of the blackbox using values read from the flight controller
  */
-static void loadMainState(timeUs_t currentTimeUs)
+static void loadMainState(blackboxMainState_t *blackboxCurrent, timeUs_t currentTimeUs)
 {
 #ifndef UNIT_TEST
-    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
-
     blackboxCurrent->time = currentTimeUs;
 
     for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
@@ -1013,6 +1612,10 @@ static void loadMainState(timeUs_t currentTimeUs)
         blackboxCurrent->rcCommand[i] = rcCommand[i];
     }
 
+    for (int i = 0; i < GAIN_SCHEDULE_TERM_COUNT; i++) {
+        blackboxCurrent->gainSchedule[i] = lrintf(gainScheduleGetMultiplier(i) * 100);
+    }
+
     for (int i = 0; i < DEBUG16_VALUE_COUNT; i++) {
         blackboxCurrent->debug[i] = debug[i];
     }
@@ -1041,7 +1644,7 @@ static void loadMainState(timeUs_t currentTimeUs)
     blackboxCurrent->servo[5] = servo[5];
 #endif
 #else
-    UNUSED(currentTimeUs);
+    blackboxCurrent->time = currentTimeUs;
 #endif // UNIT_TEST
 }
 
@@ -1065,7 +1668,8 @@ static void loadMainState(timeUs_t currentTimeUs)
  * Returns true if there is still header left to transmit (so call again to continue transmission).
  */
 static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const void *fieldDefinitions,
-        const void *secondFieldDefinition, int fieldCount, const uint8_t *conditions, const uint8_t *secondCondition)
+        const void *secondFieldDefinition, int fieldCount, const uint8_t *conditions, const uint8_t *secondCondition,
+        const uint8_t *groups)
 {
     const blackboxFieldDefinition_t *def;
     unsigned int headerCount;
@@ -1073,7 +1677,10 @@ static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const v
     size_t definitionStride = (char*) secondFieldDefinition - (char*) fieldDefinitions;
     size_t conditionsStride = (char*) secondCondition - (char*) conditions;
 
-    if (deltaFrameChar) {
+    if (groups) {
+        // Fields in groups also announce how many P-frames they are written in
+        headerCount = BLACKBOX_RATED_FIELD_HEADER_COUNT;
+    } else if (deltaFrameChar) {
         headerCount = BLACKBOX_DELTA_FIELD_HEADER_COUNT;
     } else {
         headerCount = BLACKBOX_SIMPLE_FIELD_HEADER_COUNT;
@@ -1108,7 +1715,8 @@ static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const v
     for (; xmitState.u.fieldIndex < fieldCount; xmitState.u.fieldIndex++) {
         def = (const blackboxFieldDefinition_t*) ((const char*)fieldDefinitions + definitionStride * xmitState.u.fieldIndex);
 
-        if (!conditions || testBlackboxCondition(conditions[conditionsStride * xmitState.u.fieldIndex])) {
+        if ((!conditions || testBlackboxCondition(conditions[conditionsStride * xmitState.u.fieldIndex]))
+            && (!groups || blackboxFieldGroupEnabled(groups[conditionsStride * xmitState.u.fieldIndex]))) {
             // First (over)estimate the length of the string we want to print
 
             int32_t bytesToWrite = 1; // Leading comma
@@ -1143,6 +1751,8 @@ static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const v
                 if (def->fieldNameIndex != -1) {
                     blackboxPrintf("[%d]", def->fieldNameIndex);
                 }
+            } else if (xmitState.headerIndex == BLACKBOX_DELTA_FIELD_HEADER_COUNT) {
+                blackboxPrintf("%d", blackboxFieldGroupRateDenom(groups[conditionsStride * xmitState.u.fieldIndex]));
             } else {
                 //The other headers are integers
                 blackboxPrintf("%d", def->arr[xmitState.headerIndex - 1]);
@@ -1213,6 +1823,25 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("I interval", "%d",                      blackboxIInterval);
         BLACKBOX_PRINT_HEADER_LINE("P interval", "%d",                      blackboxPInterval);
         BLACKBOX_PRINT_HEADER_LINE("P ratio", "%d",                         blackboxConfig()->p_ratio);
+        BLACKBOX_PRINT_HEADER_LINE("fields_disabled_mask", "%d",            blackboxConfig()->fields_disabled_mask);
+#ifdef USE_BLACKBOX_COLUMNAR
+        BLACKBOX_PRINT_HEADER_LINE("Data format", "%s",                     blackboxColumnar ? "columnar" : "interleaved");
+        BLACKBOX_PRINT_HEADER_LINE("Block frames", "%d",                    BLACKBOX_COLUMNAR_BLOCK_FRAMES);
+#endif
+#ifdef USE_BLACKBOX_BURST
+        BLACKBOX_PRINT_HEADER_LINE("gyro_burst", "%d,%d,%d",                blackboxConfig()->burst_ms,
+                                                                            blackboxConfig()->burst_pretrigger,
+                                                                            blackboxConfig()->burst_on_event);
+        // The layout of the gyro burst event, in the style of the field definitions
+        BLACKBOX_PRINT_HEADER_LINE("Event 40 name", "%s",                   "sampleCount,triggerIndex,trigger,startTime");
+        BLACKBOX_PRINT_HEADER_LINE("Event 40 encoding", "%d,%d,%d,%d",      FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB,
+                                                                            FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB,
+                                                                            FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB,
+                                                                            FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB);
+#endif
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+        BLACKBOX_PRINT_HEADER_LINE("serial_framing", "%d",                  blackboxConfig()->serial_framing);
+#endif
         BLACKBOX_PRINT_HEADER_LINE("minthrottle", "%d",                     motorConfig()->minthrottle);
         BLACKBOX_PRINT_HEADER_LINE("maxthrottle", "%d",                     motorConfig()->maxthrottle);
         BLACKBOX_PRINT_HEADER_LINE("gyro_scale","0x%x",                     castFloatBytesToInt(1.0f));
@@ -1278,6 +1907,7 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("dterm_notch_cutoff", "%d",              currentPidProfile->dterm_notch_cutoff);
         BLACKBOX_PRINT_HEADER_LINE("iterm_windup", "%d",                    currentPidProfile->itermWindupPointPercent);
         BLACKBOX_PRINT_HEADER_LINE("vbat_pid_gain", "%d",                   currentPidProfile->vbatPidCompensation);
+        BLACKBOX_PRINT_HEADER_LINE("gain_schedule", "%d",                   gainScheduleConfig()->enabled);
         BLACKBOX_PRINT_HEADER_LINE("pidAtMinThrottle", "%d",                currentPidProfile->pidAtMinThrottle);
 
         // Betaflight PID controller parameters
@@ -1351,15 +1981,16 @@ static bool blackboxWriteSysinfo(void)
     return false;
 }
 
-/**
- * Write the given event to the log immediately
- */
-void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
+static void writeEvent(FlightLogEvent event, flightLogEventData_t *data)
 {
-    // Only allow events to be logged after headers have been written
-    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
-        return;
+#ifdef USE_BLACKBOX_COLUMNAR
+    // the burst frames and the end of the log follow everything logged before them
+    if (event == FLIGHT_LOG_EVENT_LOG_END || event == FLIGHT_LOG_EVENT_GYRO_BURST) {
+        blackboxColumnarFlush();
+    } else {
+        blackboxColumnarCompleteBlock();
     }
+#endif
 
     //Shared header for event frames
     blackboxWrite('E');
@@ -1387,6 +2018,16 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
         blackboxWriteUnsignedVB(data->loggingResume.logIteration);
         blackboxWriteUnsignedVB(data->loggingResume.currentTime);
         break;
+    case FLIGHT_LOG_EVENT_GYRO_BURST:
+        blackboxWriteUnsignedVB(data->gyroBurst.sampleCount);
+        blackboxWriteUnsignedVB(data->gyroBurst.triggerIndex);
+        blackboxWriteUnsignedVB(data->gyroBurst.trigger);
+        blackboxWriteUnsignedVB(data->gyroBurst.startTime);
+        break;
+    case FLIGHT_LOG_EVENT_BACKPRESSURE:
+        blackboxWrite(data->backpressure.level);
+        blackboxWriteUnsignedVB(data->backpressure.droppedFrames);
+        break;
     case FLIGHT_LOG_EVENT_LOG_END:
         blackboxWriteString("End of log");
         blackboxWrite(0);
@@ -1394,6 +2035,81 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
     }
 }
 
+/**
+ * Queue the given event for the blackbox task, which writes it behind any main frames queued before it
+ */
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
+{
+    // Only allow events to be logged after headers have been written
+    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
+        return;
+    }
+
+    const uint8_t head = blackboxEventQueueHead;
+    if ((uint8_t)(head - blackboxEventQueueTail) >= BLACKBOX_EVENT_QUEUE_SIZE) {
+        blackboxDroppedEventCount++;
+        return;
+    }
+
+    blackboxQueuedEvent_t *queued = &blackboxEventQueue[head & (BLACKBOX_EVENT_QUEUE_SIZE - 1)];
+    queued->event.event = event;
+    if (data) {
+        queued->event.data = *data;
+    }
+    queued->frameIndex = blackboxFrameQueueHead;
+
+    blackboxEventQueueHead = head + 1;
+}
+
+#ifdef USE_BLACKBOX_BURST
+static void blackboxCheckBurstTrigger(void)
+{
+    if (!blackboxBurstIsRecording()) {
+        return;
+    }
+
+    if (IS_RC_MODE_ACTIVE(BOXBLACKBOXBURST)) {
+        blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_SWITCH);
+    } else if (blackboxConfig()->burst_on_event) {
+        if (crashRecoveryModeActive()) {
+            blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_CRASH);
+        } else if (gyroOverflowDetected()) {
+            blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_GYRO_OVERFLOW);
+        }
+    }
+}
+
+/**
+ * Write as many of the captured raw gyro samples as the header budget allows, one 'R' frame per sample holding the
+ * time since the previous sample and the change in each axis. Returns true once all of them have been written.
+ */
+static bool blackboxWriteBurstFrames(void)
+{
+    // 'R', the time delta and three signed deltas of a 16 bit value
+    const int frameSizeMax = 1 + 3 + XYZ_AXIS_COUNT * 3;
+    const uint16_t sampleCount = blackboxBurstSampleCount();
+
+    while (xmitState.headerIndex < sampleCount && blackboxDeviceReserveBufferSpace(frameSizeMax) == BLACKBOX_RESERVE_SUCCESS) {
+        const blackboxBurstSample_t *sample = blackboxBurstGetSample(xmitState.headerIndex);
+        const blackboxBurstSample_t *previous = xmitState.headerIndex ? blackboxBurstGetSample(xmitState.headerIndex - 1) : NULL;
+        int32_t deltas[XYZ_AXIS_COUNT];
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            deltas[axis] = sample->gyroADCRaw[axis] - (previous ? previous->gyroADCRaw[axis] : 0);
+        }
+
+        blackboxWrite('R');
+        blackboxWriteUnsignedVB(sample->deltaUs);
+        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+
+        blackboxHeaderBudget -= frameSizeMax;
+        xmitState.headerIndex++;
+    }
+
+    return xmitState.headerIndex >= sampleCount;
+}
+#endif
+
 /* If an arming beep has played since it was last logged, write the time of the arming beep to the log as a synchronization point */
 static void blackboxCheckAndLogArmingBeep(void)
 {
@@ -1402,7 +2118,7 @@ static void blackboxCheckAndLogArmingBeep(void)
         blackboxLastArmingBeep = getArmingBeepTimeMicros();
         flightLogEvent_syncBeep_t eventData;
         eventData.time = blackboxLastArmingBeep;
-        blackboxLogEvent(FLIGHT_LOG_EVENT_SYNC_BEEP, (flightLogEventData_t *)&eventData);
+        writeEvent(FLIGHT_LOG_EVENT_SYNC_BEEP, (flightLogEventData_t *)&eventData);
     }
 }
 
@@ -1415,13 +2131,19 @@ static void blackboxCheckAndLogFlightMode(void)
         eventData.lastFlags = blackboxLastFlightModeFlags;
         memcpy(&blackboxLastFlightModeFlags, &rcModeActivationMask, sizeof(blackboxLastFlightModeFlags));
         memcpy(&eventData.flags, &rcModeActivationMask, sizeof(eventData.flags));
-        blackboxLogEvent(FLIGHT_LOG_EVENT_FLIGHTMODE, (flightLogEventData_t *)&eventData);
+        writeEvent(FLIGHT_LOG_EVENT_FLIGHTMODE, (flightLogEventData_t *)&eventData);
     }
 }
 
 STATIC_UNIT_TESTED bool blackboxShouldLogPFrame(void)
 {
-    return blackboxPFrameIndex == 0 && blackboxConfig()->p_ratio != 0;
+    if (blackboxPFrameIndex != 0 || blackboxConfig()->p_ratio == 0) {
+        return false;
+    }
+
+    // Under back-pressure only every 2^level-th P-frame slot is logged
+    const int pFrameSlot = blackboxPInterval ? blackboxLoopIndex / blackboxPInterval : blackboxLoopIndex;
+    return pFrameSlot % (1 << blackboxBackpressureLevel) == 0;
 }
 
 STATIC_UNIT_TESTED bool blackboxShouldLogIFrame(void)
@@ -1462,11 +2184,84 @@ STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void)
     }
 }
 
-// Called once every FC loop in order to log the current state
+// Called once every FC loop in order to snapshot the current state, the encoding is left to the blackbox task
 STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 {
+#ifdef USE_GPS
+    if (blackboxShouldLogGpsHomeFrame()) {
+        blackboxGpsHomeFrameDue = true;
+    }
+#endif
+
+    blackboxBackpressureLevel = blackboxDeviceBackpressureLevel();
+
     // Write a keyframe every blackboxIInterval frames so we can resynchronise upon missing frames
-    if (blackboxShouldLogIFrame()) {
+    const bool intraframe = blackboxShouldLogIFrame();
+    if (!intraframe && !blackboxShouldLogPFrame()) {
+        return;
+    }
+
+    const uint8_t head = blackboxFrameQueueHead;
+    if ((uint8_t)(head - blackboxFrameQueueTail) >= BLACKBOX_FRAME_QUEUE_SIZE) {
+        blackboxDroppedFrameCount++;
+        blackboxFrameDropped = true;
+        DEBUG_SET(DEBUG_BLACKBOX_QUEUE, 1, MIN(blackboxDroppedFrameCount, (uint32_t)INT16_MAX));
+        return;
+    }
+
+    blackboxQueuedFrame_t *frame = &blackboxFrameQueue[head & (BLACKBOX_FRAME_QUEUE_SIZE - 1)];
+    loadMainState(&frame->state, currentTimeUs);
+    frame->iteration = blackboxIteration;
+    frame->intraframe = intraframe;
+    frame->resync = blackboxFrameDropped;
+    frame->gpsHomeDue = blackboxGpsHomeFrameDue;
+    frame->backpressureLevel = blackboxBackpressureLevel;
+    blackboxFrameDropped = false;
+    blackboxGpsHomeFrameDue = false;
+
+    // Publish the snapshot only once it is complete
+    blackboxFrameQueueHead = head + 1;
+
+    DEBUG_SET(DEBUG_BLACKBOX_QUEUE, 0, (uint8_t)(blackboxFrameQueueHead - blackboxFrameQueueTail));
+}
+
+static void blackboxEncodeQueuedFrame(const blackboxQueuedFrame_t *frame)
+{
+    if (frame->backpressureLevel != blackboxLoggedBackpressureLevel) {
+        // Tell the decoder the P-frame spacing changes from this frame on
+        flightLogEvent_backpressure_t backpressure;
+
+        backpressure.level = frame->backpressureLevel;
+        backpressure.droppedFrames = blackboxDeviceDroppedFrames();
+        blackboxLoggedBackpressureLevel = frame->backpressureLevel;
+
+        writeEvent(FLIGHT_LOG_EVENT_BACKPRESSURE, (flightLogEventData_t *) &backpressure);
+    }
+
+    // A chunk the device dropped may have held the frames this one is predicted from, so start again from an I-frame
+    const uint32_t deviceDroppedFrames = blackboxDeviceDroppedFrames();
+    const bool resync = frame->resync || deviceDroppedFrames != blackboxLoggedDeviceDroppedFrames;
+    blackboxLoggedDeviceDroppedFrames = deviceDroppedFrames;
+
+    if (resync) {
+        flightLogEvent_loggingResume_t resume;
+
+        resume.logIteration = frame->iteration;
+        resume.currentTime = frame->state.time;
+
+        writeEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+    }
+
+#ifdef USE_BLACKBOX_COLUMNAR
+    if (blackboxColumnar) {
+        blackboxCheckAndLogArmingBeep();
+        blackboxCheckAndLogFlightMode();
+        writeSlowFrameIfNeeded();
+
+        writeColumnarFrame(&frame->state, frame->iteration);
+    } else
+#endif
+    if (frame->intraframe || resync) {
         /*
          * Don't log a slow frame if the slow data didn't change ("I" frames are already large enough without adding
          * an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
@@ -1475,39 +2270,102 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
             writeSlowFrameIfNeeded();
         }
 
-        loadMainState(currentTimeUs);
-        writeIntraframe();
+        memcpy(blackboxHistory[0], &frame->state, sizeof(blackboxMainState_t));
+        writeIntraframe(frame->iteration);
+        blackboxInterframeIndex = 0;
     } else {
         blackboxCheckAndLogArmingBeep();
         blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
 
-        if (blackboxShouldLogPFrame()) {
-            /*
-             * We assume that slow frames are only interesting in that they aid the interpretation of the main data stream.
-             * So only log slow frames during loop iterations where we log a main frame.
-             */
-            writeSlowFrameIfNeeded();
+        /*
+         * We assume that slow frames are only interesting in that they aid the interpretation of the main data stream.
+         * So only log slow frames during loop iterations where we log a main frame.
+         */
+        writeSlowFrameIfNeeded();
 
-            loadMainState(currentTimeUs);
-            writeInterframe();
-        }
+        blackboxInterframeIndex = (blackboxInterframeIndex + 1) % BLACKBOX_FIELD_RATE_DENOM_MAX;
+        const uint32_t plan = blackboxInterframePlan[blackboxInterframeIndex];
+
+        memcpy(blackboxHistory[0], &frame->state, sizeof(blackboxMainState_t));
+        blackboxHoldSkippedItems(blackboxHistory[0], blackboxHistory[1], plan);
+        writeInterframe(plan);
+    }
 #ifdef USE_GPS
-        if (featureIsEnabled(FEATURE_GPS)) {
-            if (blackboxShouldLogGpsHomeFrame()) {
-                writeGPSHomeFrame();
-                writeGPSFrame(currentTimeUs);
-            } else if (gpsSol.numSat != gpsHistory.GPS_numSat
-                    || gpsSol.llh.lat != gpsHistory.GPS_coord[LAT]
-                    || gpsSol.llh.lon != gpsHistory.GPS_coord[LON]) {
-                //We could check for velocity changes as well but I doubt it changes independent of position
-                writeGPSFrame(currentTimeUs);
-            }
+    if (featureIsEnabled(FEATURE_GPS)) {
+        if (frame->gpsHomeDue || GPS_home[0] != gpsHistory.GPS_home[0] || GPS_home[1] != gpsHistory.GPS_home[1]) {
+            writeGPSHomeFrame();
+            writeGPSFrame(frame->state.time);
+        } else if (gpsSol.numSat != gpsHistory.GPS_numSat
+                || gpsSol.llh.lat != gpsHistory.GPS_coord[LAT]
+                || gpsSol.llh.lon != gpsHistory.GPS_coord[LON]) {
+            //We could check for velocity changes as well but I doubt it changes independent of position
+            writeGPSFrame(frame->state.time);
         }
+    }
 #endif
+}
+
+// Write the queued events that were logged before the frame at frameIndex was queued
+static void blackboxWriteQueuedEvents(uint8_t frameIndex)
+{
+    uint8_t tail = blackboxEventQueueTail;
+
+    while (tail != blackboxEventQueueHead) {
+        blackboxQueuedEvent_t *queued = &blackboxEventQueue[tail & (BLACKBOX_EVENT_QUEUE_SIZE - 1)];
+        if (queued->frameIndex != frameIndex) {
+            break;
+        }
+        writeEvent(queued->event.event, &queued->event.data);
+        blackboxEventQueueTail = ++tail;
+    }
+}
+
+/**
+ * Run the predictors and the encoder over every snapshot the PID loop has queued, oldest first, with the events
+ * logged in between.
+ */
+STATIC_UNIT_TESTED void blackboxEncodeQueuedFrames(void)
+{
+    uint8_t tail = blackboxFrameQueueTail;
+
+    blackboxWriteQueuedEvents(tail);
+    while (tail != blackboxFrameQueueHead) {
+        blackboxEncodeQueuedFrame(&blackboxFrameQueue[tail & (BLACKBOX_FRAME_QUEUE_SIZE - 1)]);
+        // Hand the slot back to the PID loop only once we are done reading it
+        blackboxFrameQueueTail = ++tail;
+        blackboxWriteQueuedEvents(tail);
     }
+}
+
+static bool blackboxEncodeQueueEmpty(void)
+{
+    return blackboxFrameQueueHead == blackboxFrameQueueTail && blackboxEventQueueHead == blackboxEventQueueTail;
+}
+
+bool blackboxEncodeCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs)
+{
+    UNUSED(currentTimeUs);
+    UNUSED(currentDeltaTimeUs);
+
+    return !blackboxEncodeQueueEmpty();
+}
+
+/**
+ * Blackbox task, encodes the frames queued by blackboxUpdate() and hands them to the device.
+ */
+void blackboxEncode(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    const timeUs_t startTime = micros();
+
+    blackboxEncodeQueuedFrames();
+    blackboxDeviceCommit();
 
     //Flush every iteration so that our runtime variance is minimized
     blackboxDeviceFlush();
+
+    DEBUG_SET(DEBUG_BLACKBOX_QUEUE, 2, micros() - startTime);
 }
 
 /**
@@ -1520,6 +2378,8 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         if (ARMING_FLAG(ARMED)) {
             blackboxOpen();
             blackboxStart();
+        } else {
+            blackboxDeviceIdle();
         }
 #ifdef USE_FLASHFS
         if (IS_RC_MODE_ACTIVE(BOXBLACKBOXERASE)) {
@@ -1556,7 +2416,7 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
         if (!sendFieldDefinition('I', 'P', blackboxMainFields, blackboxMainFields + 1, ARRAYLEN(blackboxMainFields),
-                &blackboxMainFields[0].condition, &blackboxMainFields[1].condition)) {
+                &blackboxMainFields[0].condition, &blackboxMainFields[1].condition, &blackboxMainFields[0].group)) {
 #ifdef USE_GPS
             if (featureIsEnabled(FEATURE_GPS)) {
                 blackboxSetState(BLACKBOX_STATE_SEND_GPS_H_HEADER);
@@ -1570,7 +2430,7 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
         if (!sendFieldDefinition('H', 0, blackboxGpsHFields, blackboxGpsHFields + 1, ARRAYLEN(blackboxGpsHFields),
-                NULL, NULL)) {
+                NULL, NULL, NULL)) {
             blackboxSetState(BLACKBOX_STATE_SEND_GPS_G_HEADER);
         }
         break;
@@ -1578,7 +2438,7 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
         if (!sendFieldDefinition('G', 0, blackboxGpsGFields, blackboxGpsGFields + 1, ARRAYLEN(blackboxGpsGFields),
-                &blackboxGpsGFields[0].condition, &blackboxGpsGFields[1].condition)) {
+                &blackboxGpsGFields[0].condition, &blackboxGpsGFields[1].condition, NULL)) {
             blackboxSetState(BLACKBOX_STATE_SEND_SLOW_HEADER);
         }
         break;
@@ -1587,10 +2447,25 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
         if (!sendFieldDefinition('S', 0, blackboxSlowFields, blackboxSlowFields + 1, ARRAYLEN(blackboxSlowFields),
-                NULL, NULL)) {
+                NULL, NULL, NULL)) {
+#ifdef USE_BLACKBOX_BURST
+            if (blackboxBurstIsRecording()) {
+                blackboxSetState(BLACKBOX_STATE_SEND_BURST_HEADER);
+            } else
+#endif
+                blackboxSetState(BLACKBOX_STATE_SEND_SYSINFO);
+        }
+        break;
+#ifdef USE_BLACKBOX_BURST
+    case BLACKBOX_STATE_SEND_BURST_HEADER:
+        blackboxReplenishHeaderBudget();
+        //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
+        if (!sendFieldDefinition('R', 0, blackboxBurstFields, blackboxBurstFields + 1, ARRAYLEN(blackboxBurstFields),
+                NULL, NULL, NULL)) {
             blackboxSetState(BLACKBOX_STATE_SEND_SYSINFO);
         }
         break;
+#endif
     case BLACKBOX_STATE_SEND_SYSINFO:
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0
@@ -1621,6 +2496,9 @@ void blackboxUpdate(timeUs_t currentTimeUs)
 
             blackboxLogIteration(currentTimeUs);
         }
+#ifdef USE_BLACKBOX_BURST
+        blackboxCheckBurstTrigger();
+#endif
         // Keep the logging timers ticking so our log iteration continues to advance
         blackboxAdvanceIterationTimers();
         break;
@@ -1632,8 +2510,25 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         } else {
             blackboxLogIteration(currentTimeUs);
         }
+#ifdef USE_BLACKBOX_BURST
+        blackboxCheckBurstTrigger();
+#endif
         blackboxAdvanceIterationTimers();
         break;
+#ifdef USE_BLACKBOX_BURST
+    case BLACKBOX_STATE_SEND_BURST:
+        blackboxReplenishHeaderBudget();
+        //On entry of this state, xmitState.headerIndex is 0
+        if (!blackboxEncodeQueueEmpty()) {
+            // the burst event has to be written ahead of the samples
+            break;
+        }
+        if (blackboxWriteBurstFrames()) {
+            writeEvent(FLIGHT_LOG_EVENT_LOG_END, NULL);
+            blackboxSetState(BLACKBOX_STATE_SHUTTING_DOWN);
+        }
+        break;
+#endif
     case BLACKBOX_STATE_SHUTTING_DOWN:
         //On entry of this state, startTime is set
         /*
@@ -1642,6 +2537,10 @@ void blackboxUpdate(timeUs_t currentTimeUs)
          *
          * Don't wait longer than it could possibly take if something funky happens.
          */
+        if (!blackboxEncodeQueueEmpty()) {
+            // the blackbox task has yet to write the end of the log
+            break;
+        }
         if (blackboxDeviceEndLog(blackboxLoggedAnyFrames) && (millis() > xmitState.u.startTime + BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS || blackboxDeviceFlushForce())) {
             blackboxDeviceClose();
             blackboxSetState(BLACKBOX_STATE_STOPPED);
@@ -1670,6 +2569,9 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         break;
     }
 
+    // Hand whatever this iteration staged to the device in one bulk write
+    blackboxDeviceCommit();
+
     // Did we run out of room on the device? Stop!
     if (isBlackboxDeviceFull()) {
 #ifdef USE_FLASHFS
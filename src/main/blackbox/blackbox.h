@@ -42,19 +42,83 @@ typedef enum BlackboxMode {
     BLACKBOX_MODE_ALWAYS_ON
 } BlackboxMode;
 
+typedef enum BlackboxFormat {
+    BLACKBOX_FORMAT_INTERLEAVED = 0,
+    BLACKBOX_FORMAT_COLUMNAR
+} BlackboxFormat;
+
+// Main frame fields that can be left out of the log or logged in fewer P-frames
+typedef enum {
+    BLACKBOX_FIELD_GROUP_PIDS = 0,
+    BLACKBOX_FIELD_GROUP_RC,
+    BLACKBOX_FIELD_GROUP_GAIN_SCHEDULE,
+    BLACKBOX_FIELD_GROUP_BATTERY,
+    BLACKBOX_FIELD_GROUP_MAG,
+    BLACKBOX_FIELD_GROUP_ALTITUDE,
+    BLACKBOX_FIELD_GROUP_RSSI,
+    BLACKBOX_FIELD_GROUP_GYRO,
+    BLACKBOX_FIELD_GROUP_ACC,
+    BLACKBOX_FIELD_GROUP_DEBUG,
+    BLACKBOX_FIELD_GROUP_MOTORS,
+    BLACKBOX_FIELD_GROUP_COUNT,
+    BLACKBOX_FIELD_GROUP_FRAME = BLACKBOX_FIELD_GROUP_COUNT // loopIteration and time, in every frame
+} blackboxFieldGroup_e;
+
+// P-frame divisors are powers of 2 so the write plan repeats every BLACKBOX_FIELD_RATE_DENOM_MAX P-frames
+typedef enum {
+    BLACKBOX_FIELD_RATE_1 = 0,
+    BLACKBOX_FIELD_RATE_1_2,
+    BLACKBOX_FIELD_RATE_1_4,
+    BLACKBOX_FIELD_RATE_1_8,
+    BLACKBOX_FIELD_RATE_1_16,
+    BLACKBOX_FIELD_RATE_1_32,
+    BLACKBOX_FIELD_RATE_COUNT
+} blackboxFieldRate_e;
+
+#define BLACKBOX_FIELD_RATE_DENOM_MAX (1 << (BLACKBOX_FIELD_RATE_COUNT - 1))
+
 typedef enum FlightLogEvent {
     FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
     FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
     FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
     FLIGHT_LOG_EVENT_FLIGHTMODE = 30, // Add new event type for flight mode status.
+    FLIGHT_LOG_EVENT_GYRO_BURST = 40, // Raw gyro burst capture follows as 'R' frames
+    FLIGHT_LOG_EVENT_BACKPRESSURE = 41, // Serial link fell behind or caught up, P-frames now at 1/2^level of the P interval
     FLIGHT_LOG_EVENT_LOG_END = 255
 } FlightLogEvent;
 
+typedef enum BlackboxState {
+    BLACKBOX_STATE_DISABLED = 0,
+    BLACKBOX_STATE_STOPPED,
+    BLACKBOX_STATE_PREPARE_LOG_FILE,
+    BLACKBOX_STATE_SEND_HEADER,
+    BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER,
+    BLACKBOX_STATE_SEND_GPS_H_HEADER,
+    BLACKBOX_STATE_SEND_GPS_G_HEADER,
+    BLACKBOX_STATE_SEND_SLOW_HEADER,
+    BLACKBOX_STATE_SEND_BURST_HEADER,
+    BLACKBOX_STATE_SEND_SYSINFO,
+    BLACKBOX_STATE_PAUSED,
+    BLACKBOX_STATE_RUNNING,
+    BLACKBOX_STATE_SEND_BURST,
+    BLACKBOX_STATE_SHUTTING_DOWN,
+    BLACKBOX_STATE_START_ERASE,
+    BLACKBOX_STATE_ERASING,
+    BLACKBOX_STATE_ERASED
+} BlackboxState;
+
 typedef struct blackboxConfig_s {
     uint16_t p_ratio; // I-frame interval / P-frame interval
     uint8_t device;
     uint8_t record_acc;
     uint8_t mode;
+    uint8_t format;
+    uint16_t burst_ms;          // raw gyro burst capture window, 0 to disable
+    uint8_t burst_pretrigger;   // percentage of the burst window kept from before the trigger
+    uint8_t burst_on_event;     // also trigger the burst on a crash or gyro overflow
+    uint16_t fields_disabled_mask;                      // bit per blackboxFieldGroup_e
+    uint8_t field_rate[BLACKBOX_FIELD_GROUP_COUNT];     // blackboxFieldRate_e, P-frame divisor of each field group
+    uint8_t serial_framing;     // wrap serial output in frames with a sequence number and CRC
 } blackboxConfig_t;
 
 PG_DECLARE(blackboxConfig_t, blackboxConfig);
@@ -64,6 +128,8 @@ void blackboxLogEvent(FlightLogEvent event, union flightLogEventData_u *data);
 
 void blackboxInit(void);
 void blackboxUpdate(timeUs_t currentTimeUs);
+bool blackboxEncodeCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+void blackboxEncode(timeUs_t currentTimeUs);
 void blackboxSetStartDateTime(const char *dateTime, timeMs_t timeNowMs);
 int blackboxCalculatePDenom(int rateNum, int rateDenom);
 uint8_t blackboxGetRateDenom(void);
@@ -71,7 +137,9 @@ void blackboxValidateConfig(void);
 void blackboxFinish(void);
 bool blackboxMayEditConfig(void);
 #ifdef UNIT_TEST
+STATIC_UNIT_TESTED void blackboxStart(void);
 STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs);
+STATIC_UNIT_TESTED void blackboxEncodeQueuedFrames(void);
 STATIC_UNIT_TESTED bool blackboxShouldLogPFrame(void);
 STATIC_UNIT_TESTED bool blackboxShouldLogIFrame(void);
 STATIC_UNIT_TESTED bool blackboxShouldLogGpsHomeFrame(void);
@@ -80,4 +148,5 @@ STATIC_UNIT_TESTED bool writeSlowFrameIfNeeded(void);
 STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void);
 extern int32_t blackboxSInterval;
 extern int32_t blackboxSlowFrameIterationTimer;
+extern BlackboxState blackboxState;
 #endif
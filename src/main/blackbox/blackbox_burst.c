@@ -0,0 +1,199 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_BURST
+
+#include "blackbox_burst.h"
+
+#include "common/maths.h"
+
+typedef enum {
+    BURST_STATE_IDLE = 0,
+    BURST_STATE_RECORDING,
+    BURST_STATE_TRIGGERED,
+    BURST_STATE_CAPTURED
+} burstState_e;
+
+static FAST_RAM_ZERO_INIT struct {
+    blackboxBurstSample_t *samples;
+    burstState_e state;
+    blackboxBurstTrigger_e trigger;
+    uint16_t windowSamples;
+    uint16_t postTriggerSamples;
+    uint16_t remaining;         // post-trigger samples still to record
+    uint16_t head;              // next slot to write
+    uint16_t count;             // valid samples in the ring
+    uint16_t triggerIndex;      // of the first post-trigger sample, counted from the oldest sample
+    timeUs_t lastSampleTimeUs;
+    timeUs_t startTimeUs;       // of the oldest sample, valid once captured
+} burst;
+
+static const blackboxBurstSample_t *blackboxBurstGetSampleUnchecked(uint16_t index)
+{
+    // The oldest sample is at head once the ring has wrapped
+    uint32_t slot = (burst.count < burst.windowSamples ? 0 : burst.head) + index;
+    if (slot >= burst.windowSamples) {
+        slot -= burst.windowSamples;
+    }
+
+    return &burst.samples[slot];
+}
+
+/**
+ * Return the number of samples a window of the given length holds at the given gyro rate.
+ */
+uint16_t blackboxBurstWindowSamples(uint16_t windowMs, uint32_t gyroLooptimeUs)
+{
+    if (gyroLooptimeUs == 0) {
+        return 0;
+    }
+
+    return MIN((uint32_t)windowMs * 1000 / gyroLooptimeUs, (uint32_t)UINT16_MAX);
+}
+
+/**
+ * Start recording into a ring of windowSamples samples, nothing is recorded if it is empty.
+ */
+void blackboxBurstStart(blackboxBurstSample_t *samples, uint16_t windowSamples, uint8_t preTriggerPercent)
+{
+    memset(&burst, 0, sizeof(burst));
+
+    if (!samples || windowSamples == 0) {
+        return;
+    }
+
+    burst.samples = samples;
+    burst.windowSamples = windowSamples;
+    burst.postTriggerSamples = MAX(burst.windowSamples - burst.windowSamples * MIN(preTriggerPercent, 100) / 100, 1);
+    burst.state = BURST_STATE_RECORDING;
+}
+
+/**
+ * Store one raw gyro sample, called at the gyro rate.
+ */
+void blackboxBurstCapture(timeUs_t currentTimeUs, const int16_t *gyroADCRaw)
+{
+    if (burst.state != BURST_STATE_RECORDING && burst.state != BURST_STATE_TRIGGERED) {
+        return;
+    }
+
+    blackboxBurstSample_t *sample = &burst.samples[burst.head];
+    sample->deltaUs = burst.count ? MIN(cmpTimeUs(currentTimeUs, burst.lastSampleTimeUs), UINT16_MAX) : 0;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        sample->gyroADCRaw[axis] = gyroADCRaw[axis];
+    }
+    burst.lastSampleTimeUs = currentTimeUs;
+
+    if (++burst.head >= burst.windowSamples) {
+        burst.head = 0;
+    }
+    if (burst.count < burst.windowSamples) {
+        burst.count++;
+    }
+
+    if (burst.state == BURST_STATE_TRIGGERED && --burst.remaining == 0) {
+        blackboxBurstFreeze();
+    }
+}
+
+/**
+ * Keep the rest of the window after this point. Only the first trigger of a log counts.
+ */
+void blackboxBurstTrigger(blackboxBurstTrigger_e trigger)
+{
+    if (burst.state == BURST_STATE_RECORDING) {
+        burst.trigger = trigger;
+        burst.remaining = burst.postTriggerSamples;
+        burst.state = BURST_STATE_TRIGGERED;
+    }
+}
+
+/**
+ * Stop recording. Returns true if a triggered capture is available to be written out; a capture cut short by
+ * disarming before the window completed is kept too.
+ */
+bool blackboxBurstFreeze(void)
+{
+    if (burst.state == BURST_STATE_TRIGGERED) {
+        const uint16_t postTriggerRecorded = burst.postTriggerSamples - burst.remaining;
+        burst.triggerIndex = burst.count - MIN(postTriggerRecorded, burst.count);
+
+        // Rebuild the time of the oldest sample from the deltas that follow it
+        burst.startTimeUs = burst.lastSampleTimeUs;
+        for (uint16_t i = 1; i < burst.count; i++) {
+            burst.startTimeUs -= blackboxBurstGetSampleUnchecked(i)->deltaUs;
+        }
+
+        burst.state = BURST_STATE_CAPTURED;
+    } else if (burst.state == BURST_STATE_RECORDING) {
+        burst.state = BURST_STATE_IDLE;
+    }
+
+    return burst.state == BURST_STATE_CAPTURED;
+}
+
+void blackboxBurstStop(void)
+{
+    burst.state = BURST_STATE_IDLE;
+}
+
+bool blackboxBurstIsRecording(void)
+{
+    return burst.state == BURST_STATE_RECORDING;
+}
+
+uint16_t blackboxBurstSampleCount(void)
+{
+    return burst.state == BURST_STATE_CAPTURED ? burst.count : 0;
+}
+
+uint16_t blackboxBurstTriggerIndex(void)
+{
+    return burst.triggerIndex;
+}
+
+blackboxBurstTrigger_e blackboxBurstTriggerSource(void)
+{
+    return burst.trigger;
+}
+
+timeUs_t blackboxBurstStartTime(void)
+{
+    return burst.startTimeUs;
+}
+
+/**
+ * Return the captured samples oldest first, or NULL past the end.
+ */
+const blackboxBurstSample_t *blackboxBurstGetSample(uint16_t index)
+{
+    if (index >= blackboxBurstSampleCount()) {
+        return NULL;
+    }
+
+    return blackboxBurstGetSampleUnchecked(index);
+}
+#endif // USE_BLACKBOX_BURST
@@ -0,0 +1,59 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/axis.h"
+#include "common/time.h"
+
+/*
+ * Burst capture of the raw gyro at the full gyro rate into a RAM ring, for offline FFT analysis. The ring records
+ * continuously while a log is open, a trigger freezes it once the post-trigger part of the window has been captured,
+ * and the blackbox writes it into the log after disarm. The blackbox provides the ring when the log starts.
+ */
+
+typedef enum {
+    BLACKBOX_BURST_TRIGGER_NONE = 0,
+    BLACKBOX_BURST_TRIGGER_SWITCH,
+    BLACKBOX_BURST_TRIGGER_CRASH,
+    BLACKBOX_BURST_TRIGGER_GYRO_OVERFLOW
+} blackboxBurstTrigger_e;
+
+typedef struct blackboxBurstSample_s {
+    uint16_t deltaUs;                   // since the previous sample
+    int16_t gyroADCRaw[XYZ_AXIS_COUNT];
+} blackboxBurstSample_t;
+
+uint16_t blackboxBurstWindowSamples(uint16_t windowMs, uint32_t gyroLooptimeUs);
+void blackboxBurstStart(blackboxBurstSample_t *samples, uint16_t windowSamples, uint8_t preTriggerPercent);
+void blackboxBurstCapture(timeUs_t currentTimeUs, const int16_t *gyroADCRaw);
+void blackboxBurstTrigger(blackboxBurstTrigger_e trigger);
+bool blackboxBurstFreeze(void);
+void blackboxBurstStop(void);
+
+bool blackboxBurstIsRecording(void);
+uint16_t blackboxBurstSampleCount(void);
+uint16_t blackboxBurstTriggerIndex(void);
+blackboxBurstTrigger_e blackboxBurstTriggerSource(void);
+timeUs_t blackboxBurstStartTime(void);
+const blackboxBurstSample_t *blackboxBurstGetSample(uint16_t index);
@@ -0,0 +1,244 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_COLUMNAR
+
+#include "blackbox_columnar.h"
+
+#include "common/encoding.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+/*
+ * LZMA style binary range coder. Probabilities are 11 bit and adapt by 1/16th of the error on every bit, which is
+ * quick enough to settle within the 32 values of a block column.
+ */
+#define RC_TOP_VALUE            (1 << 24)
+#define RC_PROB_BITS            11
+#define RC_PROB_INIT            (1 << (RC_PROB_BITS - 1))
+#define RC_ADAPT_SHIFT          4
+
+// Residuals are coded as their bit length (0..32, through a 6 bit model tree) followed by the bits below the leading one
+#define RESIDUAL_LENGTH_BITS    6
+
+typedef struct residualModel_s {
+    uint16_t lengthProbs[1 << RESIDUAL_LENGTH_BITS];
+} residualModel_t;
+
+static void rcShiftLow(blackboxColumnarEncoder_t *encoder)
+{
+    blackboxRangeEncoder_t *rc = &encoder->rc;
+
+    if ((uint32_t)rc->low < 0xFF000000 || (rc->low >> 32) != 0) {
+        uint8_t temp = rc->cache;
+        do {
+            encoder->write(temp + (uint8_t)(rc->low >> 32));
+            temp = 0xFF;
+        } while (--rc->cacheSize != 0);
+        rc->cache = (uint8_t)(rc->low >> 24);
+    }
+    rc->cacheSize++;
+    rc->low = (rc->low & 0x00FFFFFF) << 8;
+}
+
+static void rcEncodeBit(blackboxColumnarEncoder_t *encoder, uint16_t *prob, int bit)
+{
+    blackboxRangeEncoder_t *rc = &encoder->rc;
+    const uint32_t bound = (rc->range >> RC_PROB_BITS) * *prob;
+
+    if (bit) {
+        rc->low += bound;
+        rc->range -= bound;
+        *prob -= *prob >> RC_ADAPT_SHIFT;
+    } else {
+        rc->range = bound;
+        *prob += ((1 << RC_PROB_BITS) - *prob) >> RC_ADAPT_SHIFT;
+    }
+
+    while (rc->range < RC_TOP_VALUE) {
+        rc->range <<= 8;
+        rcShiftLow(encoder);
+    }
+}
+
+static void rcEncodeDirectBits(blackboxColumnarEncoder_t *encoder, uint32_t value, int count)
+{
+    blackboxRangeEncoder_t *rc = &encoder->rc;
+
+    while (count--) {
+        rc->range >>= 1;
+        if ((value >> count) & 1) {
+            rc->low += rc->range;
+        }
+        while (rc->range < RC_TOP_VALUE) {
+            rc->range <<= 8;
+            rcShiftLow(encoder);
+        }
+    }
+}
+
+static int bitLength(uint32_t value)
+{
+    return value ? 32 - __builtin_clz(value) : 0;
+}
+
+static void modelReset(residualModel_t *model)
+{
+    for (unsigned i = 0; i < ARRAYLEN(model->lengthProbs); i++) {
+        model->lengthProbs[i] = RC_PROB_INIT;
+    }
+}
+
+static void encodeResidual(blackboxColumnarEncoder_t *encoder, residualModel_t *model, uint32_t residual)
+{
+    const int length = bitLength(residual);
+
+    unsigned node = 1;
+    for (int i = RESIDUAL_LENGTH_BITS - 1; i >= 0; i--) {
+        const int bit = (length >> i) & 1;
+        rcEncodeBit(encoder, &model->lengthProbs[node], bit);
+        node = (node << 1) | bit;
+    }
+
+    if (length > 1) {
+        rcEncodeDirectBits(encoder, residual, length - 1);
+    }
+}
+
+// Unsigned arithmetic so that wrapping fields (time, iteration) round trip without overflow
+static int32_t predict(const int32_t *column, int index, blackboxColumnarPredictor_e predictor)
+{
+    if (index == 0) {
+        return 0;
+    }
+    if (predictor == BLACKBOX_COLUMNAR_PREDICT_DELTA || index == 1) {
+        return column[index - 1];
+    }
+    return (int32_t)(2 * (uint32_t)column[index - 1] - (uint32_t)column[index - 2]);
+}
+
+static uint32_t residualOf(const int32_t *column, int index, blackboxColumnarPredictor_e predictor)
+{
+    return zigzagEncode((int32_t)((uint32_t)column[index] - (uint32_t)predict(column, index, predictor)));
+}
+
+void blackboxColumnarBlockInit(blackboxColumnarBlock_t *block, blackboxColumnarColumn_t *columns, uint8_t columnCount)
+{
+    block->values = columns;
+    block->columnCount = MIN(columnCount, BLACKBOX_COLUMNAR_MAX_COLUMNS);
+    block->frameCount = 0;
+}
+
+void blackboxColumnarBlockReset(blackboxColumnarBlock_t *block)
+{
+    block->frameCount = 0;
+}
+
+/**
+ * Append one frame worth of field values to the block. Returns true once the block is full.
+ */
+bool blackboxColumnarBlockAddFrame(blackboxColumnarBlock_t *block, const int32_t *values)
+{
+    if (block->frameCount < BLACKBOX_COLUMNAR_BLOCK_FRAMES) {
+        for (int column = 0; column < block->columnCount; column++) {
+            block->values[column][block->frameCount] = values[column];
+        }
+        block->frameCount++;
+    }
+
+    return block->frameCount == BLACKBOX_COLUMNAR_BLOCK_FRAMES;
+}
+
+/**
+ * Start encoding a block. The frame and column counts are written uncompressed, the range coded columns follow as
+ * blackboxColumnarEncodeColumn() is called.
+ */
+void blackboxColumnarEncodeBegin(blackboxColumnarEncoder_t *encoder, const blackboxColumnarBlock_t *block, blackboxColumnarWriteFn *write)
+{
+    encoder->block = block;
+    encoder->write = write;
+    encoder->column = 0;
+
+    encoder->rc.low = 0;
+    encoder->rc.range = 0xFFFFFFFF;
+    encoder->rc.cache = 0;
+    encoder->rc.cacheSize = 1;
+
+    write(block->frameCount);
+    write(block->columnCount);
+}
+
+/**
+ * Encode the next column of the block, so that the work can be spread over several scheduler slots.
+ *
+ * Returns true once the whole block has been written.
+ */
+bool blackboxColumnarEncodeColumn(blackboxColumnarEncoder_t *encoder)
+{
+    const blackboxColumnarBlock_t *block = encoder->block;
+
+    if (encoder->column < block->columnCount) {
+        const int32_t *column = block->values[encoder->column];
+
+        // Pick whichever predictor leaves the fewest significant bits over this column
+        uint32_t deltaCost = 0;
+        uint32_t deltaOfDeltaCost = 0;
+        for (int i = 0; i < block->frameCount; i++) {
+            deltaCost += bitLength(residualOf(column, i, BLACKBOX_COLUMNAR_PREDICT_DELTA));
+            deltaOfDeltaCost += bitLength(residualOf(column, i, BLACKBOX_COLUMNAR_PREDICT_DELTA_OF_DELTA));
+        }
+        const blackboxColumnarPredictor_e predictor = deltaOfDeltaCost < deltaCost ? BLACKBOX_COLUMNAR_PREDICT_DELTA_OF_DELTA : BLACKBOX_COLUMNAR_PREDICT_DELTA;
+
+        rcEncodeDirectBits(encoder, predictor, 1);
+
+        residualModel_t model;
+        modelReset(&model);
+        for (int i = 0; i < block->frameCount; i++) {
+            encodeResidual(encoder, &model, residualOf(column, i, predictor));
+        }
+
+        encoder->column++;
+    }
+
+    if (encoder->column < block->columnCount) {
+        return false;
+    }
+
+    for (int i = 0; i < 5; i++) {
+        rcShiftLow(encoder);
+    }
+    return true;
+}
+
+void blackboxColumnarEncodeBlock(const blackboxColumnarBlock_t *block, blackboxColumnarWriteFn *write)
+{
+    blackboxColumnarEncoder_t encoder;
+
+    blackboxColumnarEncodeBegin(&encoder, block, write);
+    while (!blackboxColumnarEncodeColumn(&encoder));
+}
+
+#endif // USE_BLACKBOX_COLUMNAR
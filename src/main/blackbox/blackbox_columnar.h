@@ -0,0 +1,70 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Columnar blackbox blocks: BLACKBOX_COLUMNAR_BLOCK_FRAMES main frames are stored field by field, each field column
+ * is run through a delta or delta-of-delta predictor and the residuals are entropy coded with an adaptive binary
+ * range coder. Models are reset at every column, so each block decodes on its own just like an I-frame.
+ */
+#define BLACKBOX_COLUMNAR_BLOCK_FRAMES 32
+#define BLACKBOX_COLUMNAR_MAX_COLUMNS 64
+
+typedef enum {
+    BLACKBOX_COLUMNAR_PREDICT_DELTA = 0,
+    BLACKBOX_COLUMNAR_PREDICT_DELTA_OF_DELTA
+} blackboxColumnarPredictor_e;
+
+typedef int32_t blackboxColumnarColumn_t[BLACKBOX_COLUMNAR_BLOCK_FRAMES];
+
+// The columns are storage the caller provides, sized for the column count the block is initialised with
+typedef struct blackboxColumnarBlock_s {
+    uint8_t columnCount;
+    uint8_t frameCount;
+    blackboxColumnarColumn_t *values;
+} blackboxColumnarBlock_t;
+
+typedef struct blackboxRangeEncoder_s {
+    uint64_t low;
+    uint32_t range;
+    uint32_t cacheSize;
+    uint8_t cache;
+} blackboxRangeEncoder_t;
+
+typedef void blackboxColumnarWriteFn(uint8_t value);
+
+typedef struct blackboxColumnarEncoder_s {
+    const blackboxColumnarBlock_t *block;
+    blackboxColumnarWriteFn *write;
+    blackboxRangeEncoder_t rc;
+    uint8_t column;
+} blackboxColumnarEncoder_t;
+
+void blackboxColumnarBlockInit(blackboxColumnarBlock_t *block, blackboxColumnarColumn_t *columns, uint8_t columnCount);
+void blackboxColumnarBlockReset(blackboxColumnarBlock_t *block);
+bool blackboxColumnarBlockAddFrame(blackboxColumnarBlock_t *block, const int32_t *values);
+
+void blackboxColumnarEncodeBegin(blackboxColumnarEncoder_t *encoder, const blackboxColumnarBlock_t *block, blackboxColumnarWriteFn *write);
+bool blackboxColumnarEncodeColumn(blackboxColumnarEncoder_t *encoder);
+void blackboxColumnarEncodeBlock(const blackboxColumnarBlock_t *block, blackboxColumnarWriteFn *write);
@@ -47,6 +47,7 @@ typedef enum FlightLogFieldCondition {
 
     FLIGHT_LOG_FIELD_CONDITION_ACC,
     FLIGHT_LOG_FIELD_CONDITION_DEBUG,
+    FLIGHT_LOG_FIELD_CONDITION_GAIN_SCHEDULE,
 
     FLIGHT_LOG_FIELD_CONDITION_NEVER,
 
@@ -130,6 +131,18 @@ typedef struct flightLogEvent_loggingResume_s {
     uint32_t currentTime;
 } flightLogEvent_loggingResume_t;
 
+typedef struct flightLogEvent_gyroBurst_s {
+    uint16_t sampleCount;
+    uint16_t triggerIndex;
+    uint8_t trigger;
+    uint32_t startTime;
+} flightLogEvent_gyroBurst_t;
+
+typedef struct flightLogEvent_backpressure_s {
+    uint8_t level;
+    uint32_t droppedFrames;     // by the transport since logging started
+} flightLogEvent_backpressure_t;
+
 #define FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128
 
 typedef union flightLogEventData_u {
@@ -137,6 +150,8 @@ typedef union flightLogEventData_u {
     flightLogEvent_flightMode_t flightMode; // New event data
     flightLogEvent_inflightAdjustment_t inflightAdjustment;
     flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_gyroBurst_t gyroBurst;
+    flightLogEvent_backpressure_t backpressure;
 } flightLogEventData_t;
 
 typedef struct flightLogEvent_s {
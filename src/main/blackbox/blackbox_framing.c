@@ -0,0 +1,115 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+
+#include "blackbox_framing.h"
+
+#include "common/crc.h"
+
+#include "drivers/serial.h"
+#include "drivers/time.h"
+
+static struct {
+    serialPort_t *port;
+    uint16_t sequence;
+    uint8_t level;
+    timeMs_t levelChangedMs;
+    timeMs_t lastDropMs;
+    uint32_t droppedFrames;
+} framing;
+
+void blackboxFramingInit(serialPort_t *port)
+{
+    memset(&framing, 0, sizeof(framing));
+    framing.port = port;
+    framing.levelChangedMs = millis();
+    framing.lastDropMs = framing.levelChangedMs;
+}
+
+static void blackboxFramingUpdateLevel(bool dropped)
+{
+    const timeMs_t now = millis();
+    const timeMs_t sinceChange = now - framing.levelChangedMs;
+
+    if (dropped) {
+        // The first drop reacts at once, further ones wait for the lower rate to show
+        if (framing.level < BLACKBOX_FRAMING_MAX_LEVEL && (framing.level == 0 || sinceChange >= BLACKBOX_FRAMING_RAISE_HOLDOFF_MS)) {
+            framing.level++;
+            framing.levelChangedMs = now;
+        }
+        framing.lastDropMs = now;
+    } else if (framing.level > 0 && sinceChange >= BLACKBOX_FRAMING_RECOVER_MS && now - framing.lastDropMs >= BLACKBOX_FRAMING_RECOVER_MS
+        && serialTxBytesFree(framing.port) >= framing.port->txBufferSize / 2) {
+        framing.level--;
+        framing.levelChangedMs = now;
+    }
+}
+
+/**
+ * Send one chunk as a frame, or drop it whole if the transmit buffer can't take all of it right now.
+ */
+void blackboxFramingWrite(const uint8_t *data, unsigned int length)
+{
+    uint8_t header[BLACKBOX_FRAMING_HEADER_SIZE] = {
+        BLACKBOX_FRAMING_SYNC1,
+        BLACKBOX_FRAMING_SYNC2,
+        framing.sequence & 0xff,
+        framing.sequence >> 8,
+        length & 0xff,
+        length >> 8,
+    };
+    framing.sequence++;
+
+    // Ports without a transmit buffer (USB VCP) block in serialWriteBuf() instead
+    const bool fits = framing.port->txBufferSize == 0 || serialTxBytesFree(framing.port) >= length + BLACKBOX_FRAMING_OVERHEAD;
+    if (fits) {
+        uint16_t crc = crc16_ccitt_update(0, &header[2], BLACKBOX_FRAMING_HEADER_SIZE - 2);
+        crc = crc16_ccitt_update(crc, data, length);
+        const uint8_t trailer[2] = { crc & 0xff, crc >> 8 };
+
+        serialBeginWrite(framing.port);
+        serialWriteBuf(framing.port, header, sizeof(header));
+        serialWriteBuf(framing.port, data, length);
+        serialWriteBuf(framing.port, trailer, sizeof(trailer));
+        serialEndWrite(framing.port);
+    } else {
+        framing.droppedFrames++;
+    }
+
+    blackboxFramingUpdateLevel(!fits);
+}
+
+uint8_t blackboxFramingBackpressureLevel(void)
+{
+    return framing.level;
+}
+
+uint32_t blackboxFramingDroppedFrames(void)
+{
+    return framing.droppedFrames;
+}
+#endif // USE_BLACKBOX_SERIAL_FRAMING
@@ -0,0 +1,49 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Framed transport for serial logging. Every chunk the blackbox commits goes out as one frame:
+ *
+ *     0xB5 'B' | sequence (u16) | length (u16) | payload | CRC16-CCITT over sequence, length and payload (u16)
+ *
+ * all little endian. A frame that does not fit in the transmit buffer is dropped whole, but still uses up a sequence
+ * number, so a receiver can tell a gap from corruption. Drops raise the back-pressure level, which the blackbox
+ * answers by logging fewer P-frames; it falls again once the link keeps up.
+ */
+#define BLACKBOX_FRAMING_SYNC1          0xB5
+#define BLACKBOX_FRAMING_SYNC2          'B'
+#define BLACKBOX_FRAMING_HEADER_SIZE    6
+#define BLACKBOX_FRAMING_OVERHEAD       (BLACKBOX_FRAMING_HEADER_SIZE + 2)
+
+#define BLACKBOX_FRAMING_MAX_LEVEL      3   // P-frames are logged at 1/2^level of the configured rate
+#define BLACKBOX_FRAMING_RAISE_HOLDOFF_MS   100     // for the reduced rate to take effect before raising again
+#define BLACKBOX_FRAMING_RECOVER_MS         1000    // without drops before trying the next higher rate
+
+struct serialPort_s;
+
+void blackboxFramingInit(struct serialPort_s *port);
+void blackboxFramingWrite(const uint8_t *data, unsigned int length);
+uint8_t blackboxFramingBackpressureLevel(void);
+uint32_t blackboxFramingDroppedFrames(void);
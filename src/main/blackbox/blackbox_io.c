@@ -29,6 +29,7 @@
 #ifdef USE_BLACKBOX
 
 #include "blackbox.h"
+#include "blackbox_framing.h"
 #include "blackbox_io.h"
 
 #include "common/maths.h"
@@ -55,6 +56,9 @@ int32_t blackboxHeaderBudget;
 
 static serialPort_t *blackboxPort = NULL;
 static portSharing_e blackboxPortSharing;
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+static bool blackboxSerialFramed;
+#endif
 
 #ifdef USE_SDCARD
 
@@ -87,61 +91,66 @@ void blackboxOpen(void)
     }
 }
 
-void blackboxWrite(uint8_t value)
+/*
+ * Frames are encoded into a small staging buffer and handed to the device in bulk, rather than paying for a device
+ * switch and a driver call on every byte. The device write routine is resolved once in blackboxDeviceOpen().
+ */
+typedef void blackboxDeviceWriteFn(const uint8_t *data, unsigned int length);
+
+static FAST_RAM_ZERO_INIT uint8_t blackboxStagingBuffer[BLACKBOX_STAGING_BUFFER_SIZE];
+static FAST_RAM_ZERO_INIT unsigned int blackboxStagingLength;
+static FAST_RAM_ZERO_INIT blackboxDeviceWriteFn *blackboxDeviceWrite;
+
+static void blackboxSerialWrite(const uint8_t *data, unsigned int length)
 {
-    switch (blackboxConfig()->device) {
+    serialWriteBuf(blackboxPort, data, length);
+}
+
 #ifdef USE_FLASHFS
-    case BLACKBOX_DEVICE_FLASH:
-        flashfsWriteByte(value); // Write byte asynchronously
-        break;
+static void blackboxFlashWrite(const uint8_t *data, unsigned int length)
+{
+    flashfsWrite(data, length, false); // Write asynchronously
+}
 #endif
+
 #ifdef USE_SDCARD
-    case BLACKBOX_DEVICE_SDCARD:
-        afatfs_fputc(blackboxSDCard.logFile, value);
-        break;
+static void blackboxSDCardWrite(const uint8_t *data, unsigned int length)
+{
+    afatfs_fwrite(blackboxSDCard.logFile, data, length); // Ignore failures due to buffers filling up
+}
 #endif
-    case BLACKBOX_DEVICE_SERIAL:
-    default:
-        serialWrite(blackboxPort, value);
-        break;
+
+/**
+ * Hand everything in the staging buffer to the logging device.
+ */
+void blackboxDeviceCommit(void)
+{
+    if (blackboxStagingLength > 0 && blackboxDeviceWrite) {
+        blackboxDeviceWrite(blackboxStagingBuffer, blackboxStagingLength);
     }
+    blackboxStagingLength = 0;
 }
 
-// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
-int blackboxWriteString(const char *s)
+void blackboxWrite(uint8_t value)
 {
-    int length;
-    const uint8_t *pos;
-
-    switch (blackboxConfig()->device) {
+    blackboxStagingBuffer[blackboxStagingLength++] = value;
 
-#ifdef USE_FLASHFS
-    case BLACKBOX_DEVICE_FLASH:
-        length = strlen(s);
-        flashfsWrite((const uint8_t*) s, length, false); // Write asynchronously
-        break;
-#endif // USE_FLASHFS
-
-#ifdef USE_SDCARD
-    case BLACKBOX_DEVICE_SDCARD:
-        length = strlen(s);
-        afatfs_fwrite(blackboxSDCard.logFile, (const uint8_t*) s, length); // Ignore failures due to buffers filling up
-        break;
-#endif // USE_SDCARD
+    if (blackboxStagingLength == BLACKBOX_STAGING_BUFFER_SIZE) {
+        blackboxDeviceCommit();
+    }
+}
 
-    case BLACKBOX_DEVICE_SERIAL:
-    default:
-        pos = (uint8_t*) s;
-        while (*pos) {
-            serialWrite(blackboxPort, *pos);
-            pos++;
-        }
+// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
+int blackboxWriteString(const char *s)
+{
+    const uint8_t *pos = (const uint8_t *)s;
 
-        length = pos - (uint8_t*) s;
-        break;
+    while (*pos) {
+        blackboxWrite(*pos);
+        pos++;
     }
 
-    return length;
+    return pos - (const uint8_t *)s;
 }
 
 /**
@@ -151,6 +160,8 @@ int blackboxWriteString(const char *s)
  */
 void blackboxDeviceFlush(void)
 {
+    blackboxDeviceCommit();
+
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
         /*
@@ -158,7 +169,24 @@ void blackboxDeviceFlush(void)
          * devices will progressively write in the background without Blackbox calling anything.
          */
     case BLACKBOX_DEVICE_FLASH:
-        flashfsFlushAsync();
+        flashfsFlushAsync(false);
+        break;
+#endif // USE_FLASHFS
+
+    default:
+        ;
+    }
+}
+
+/**
+ * Call regularly while no log is open, to let the device get ready for the next one.
+ */
+void blackboxDeviceIdle(void)
+{
+    switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsEraseAhead();
         break;
 #endif // USE_FLASHFS
 
@@ -174,6 +202,8 @@ void blackboxDeviceFlush(void)
  */
 bool blackboxDeviceFlushForce(void)
 {
+    blackboxDeviceCommit();
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         // Nothing to speed up flushing on serial, as serial is continuously being drained out of its buffer
@@ -181,7 +211,7 @@ bool blackboxDeviceFlushForce(void)
 
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        return flashfsFlushAsync();
+        return flashfsFlushAsync(true);
 #endif // USE_FLASHFS
 
 #ifdef USE_SDCARD
@@ -202,6 +232,9 @@ bool blackboxDeviceFlushForce(void)
  */
 bool blackboxDeviceOpen(void)
 {
+    blackboxStagingLength = 0;
+    blackboxDeviceWrite = NULL;
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         {
@@ -258,6 +291,15 @@ bool blackboxDeviceOpen(void)
                 break;
             };
 
+            blackboxDeviceWrite = blackboxSerialWrite;
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+            blackboxSerialFramed = blackboxConfig()->serial_framing && blackboxPort;
+            if (blackboxSerialFramed) {
+                blackboxFramingInit(blackboxPort);
+                blackboxDeviceWrite = blackboxFramingWrite;
+            }
+#endif
+
             return blackboxPort != NULL;
         }
         break;
@@ -268,6 +310,7 @@ bool blackboxDeviceOpen(void)
         }
 
         blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+        blackboxDeviceWrite = blackboxFlashWrite;
 
         return true;
         break;
@@ -279,6 +322,7 @@ bool blackboxDeviceOpen(void)
         }
 
         blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+        blackboxDeviceWrite = blackboxSDCardWrite;
 
         return true;
         break;
@@ -326,12 +370,18 @@ bool isBlackboxErased(void)
  */
 void blackboxDeviceClose(void)
 {
+    blackboxDeviceCommit();
+    blackboxDeviceWrite = NULL;
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         // Can immediately close without attempting to flush any remaining data.
         // Since the serial port could be shared with other processes, we have to give it back here
         closeSerialPort(blackboxPort);
         blackboxPort = NULL;
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+        blackboxSerialFramed = false;
+#endif
 
         /*
          * Normally this would be handled by mw.c, but since we take an unknown amount
@@ -395,7 +445,7 @@ static void blackboxCreateLogFile(void)
 
     blackboxSDCard.state = BLACKBOX_SDCARD_WAITING;
 
-    afatfs_fopen(filename, "as", blackboxLogFileCreated);
+    afatfs_fopen(filename, "ap", blackboxLogFileCreated);
 }
 
 /**
@@ -478,6 +528,11 @@ static bool blackboxSDCardBeginLog(void)
 bool blackboxDeviceBeginLog(void)
 {
     switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsBeginLog();
+        return true;
+#endif // USE_FLASHFS
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
         return blackboxSDCardBeginLog();
@@ -497,11 +552,18 @@ bool blackboxDeviceBeginLog(void)
  */
 bool blackboxDeviceEndLog(bool retainLog)
 {
-#ifndef USE_SDCARD
+#if !defined(USE_SDCARD) && !defined(USE_FLASHFS)
     UNUSED(retainLog);
 #endif
 
+    blackboxDeviceCommit();
+
     switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsEndLog(retainLog);
+        return true;
+#endif // USE_FLASHFS
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
         // Keep retrying until the close operation queues
@@ -563,6 +625,29 @@ bool isBlackboxDeviceWorking(void)
     }
 }
 
+/**
+ * How far the device has asked the blackbox to cut back the P-frame rate, 0 for the configured rate.
+ */
+uint8_t blackboxDeviceBackpressureLevel(void)
+{
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+    if (blackboxConfig()->device == BLACKBOX_DEVICE_SERIAL && blackboxSerialFramed) {
+        return blackboxFramingBackpressureLevel();
+    }
+#endif
+    return 0;
+}
+
+uint32_t blackboxDeviceDroppedFrames(void)
+{
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+    if (blackboxConfig()->device == BLACKBOX_DEVICE_SERIAL && blackboxSerialFramed) {
+        return blackboxFramingDroppedFrames();
+    }
+#endif
+    return 0;
+}
+
 unsigned int blackboxGetLogNumber(void)
 {
 #ifdef USE_SDCARD
@@ -582,6 +667,12 @@ void blackboxReplenishHeaderBudget(void)
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         freeSpace = serialTxBytesFree(blackboxPort);
+#ifdef USE_BLACKBOX_SERIAL_FRAMING
+        if (blackboxSerialFramed) {
+            // The budget can be committed as two chunks, each goes out in its own frame
+            freeSpace = MAX(freeSpace - 2 * BLACKBOX_FRAMING_OVERHEAD, 0);
+        }
+#endif
         break;
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
@@ -647,7 +738,7 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
              * that the Blackbox header writing code doesn't have to guess about the best time to ask flashfs to
              * flush, and doesn't stall waiting for a flush that would otherwise not automatically be called.
              */
-            flashfsFlushAsync();
+            flashfsFlushAsync(true);
         }
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_FLASHFS
@@ -38,14 +38,22 @@ typedef enum {
  */
 #define BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64
 
+/*
+ * Bytes are staged in RAM and committed to the device in bulk. A full frame comfortably fits, so a logging iteration
+ * normally results in a single device write:
+ */
+#define BLACKBOX_STAGING_BUFFER_SIZE 256
+
 extern int32_t blackboxHeaderBudget;
 
 void blackboxOpen(void);
 void blackboxWrite(uint8_t value);
 int blackboxWriteString(const char *s);
+void blackboxDeviceCommit(void);
 
 void blackboxDeviceFlush(void);
 bool blackboxDeviceFlushForce(void);
+void blackboxDeviceIdle(void);
 bool blackboxDeviceOpen(void);
 void blackboxDeviceClose(void);
 
@@ -57,6 +65,8 @@ bool blackboxDeviceEndLog(bool retainLog);
 
 bool isBlackboxDeviceFull(void);
 bool isBlackboxDeviceWorking(void);
+uint8_t blackboxDeviceBackpressureLevel(void);
+uint32_t blackboxDeviceDroppedFrames(void);
 unsigned int blackboxGetLogNumber(void);
 
 void blackboxReplenishHeaderBudget(void);
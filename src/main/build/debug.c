@@ -76,4 +76,6 @@ const char * const debugModeNames[DEBUG_COUNT] = {
     "RX_SIGNAL_LOSS",
     "RC_SMOOTHING_RATE",
     "ANTI_GRAVITY",
+    "RX_TIMING",
+    "BLACKBOX_QUEUE",
 };
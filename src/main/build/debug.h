@@ -94,6 +94,8 @@ typedef enum {
     DEBUG_RX_SIGNAL_LOSS,
     DEBUG_RC_SMOOTHING_RATE,
     DEBUG_ANTI_GRAVITY,
+    DEBUG_RX_TIMING,
+    DEBUG_BLACKBOX_QUEUE,
     DEBUG_COUNT
 } debugType_e;
 
@@ -127,7 +127,7 @@ static void cmsx_Blackbox_GetDeviceStatus(void)
             tfp_sprintf(cmsx_BlackboxStatus, "READY");
 
             const flashGeometry_t *geometry = flashfsGetGeometry();
-            storageUsed = flashfsGetOffset() / 1024;
+            storageUsed = flashfsGetUsedSize() / 1024;
             storageFree = (geometry->totalSize / 1024) - storageUsed;
         } else {
             tfp_sprintf(cmsx_BlackboxStatus, "FAULT");
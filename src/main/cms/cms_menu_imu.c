@@ -38,12 +38,15 @@
 
 #include "common/utils.h"
 
+#include "config/config_snapshot.h"
 #include "config/feature.h"
 #include "pg/pg.h"
+#include "pg/pg_ids.h"
 
 #include "fc/config.h"
 #include "fc/core.h"
 #include "fc/controlrate_profile.h"
+#include "fc/rc.h"
 #include "fc/rc_controls.h"
 #include "fc/runtime_config.h"
 
@@ -139,6 +142,8 @@ static long cmsx_PidWriteback(const OSD_Entry *self)
 {
     UNUSED(self);
 
+    configSnapshotTouch(PG_PID_PROFILE);
+
     pidProfile_t *pidProfile = currentPidProfile;
     for (uint8_t i = 0; i < 3; i++) {
         pidProfile->pid[i].P = tempPid[i][0];
@@ -199,7 +204,9 @@ static long cmsx_RateProfileWriteback(const OSD_Entry *self)
 {
     UNUSED(self);
 
+    configSnapshotTouch(PG_CONTROL_RATE_PROFILES);
     memcpy(controlRateProfilesMutable(rateProfileIndex), &rateProfile, sizeof(controlRateConfig_t));
+    initRcProcessing();
 
     return 0;
 }
@@ -275,6 +282,8 @@ static long cmsx_launchControlOnExit(const OSD_Entry *self)
 {
     UNUSED(self);
 
+    configSnapshotTouch(PG_PID_PROFILE);
+
     pidProfile_t *pidProfile = pidProfilesMutable(pidProfileIndex);
 
     pidProfile->launchControlMode = cmsx_launchControlMode;
@@ -341,6 +350,8 @@ static long cmsx_profileOtherOnExit(const OSD_Entry *self)
 {
     UNUSED(self);
 
+    configSnapshotTouch(PG_PID_PROFILE);
+
     pidProfile_t *pidProfile = pidProfilesMutable(pidProfileIndex);
     pidProfile->feedForwardTransition = cmsx_feedForwardTransition;
     pidInitConfig(currentPidProfile);
@@ -412,6 +423,8 @@ static long cmsx_menuGyro_onExit(const OSD_Entry *self)
 {
     UNUSED(self);
 
+    configSnapshotTouch(PG_GYRO_CONFIG);
+
     gyroConfigMutable()->gyro_lowpass_hz =  gyroConfig_gyro_lowpass_hz;
     gyroConfigMutable()->gyro_lowpass2_hz =  gyroConfig_gyro_lowpass2_hz;
     gyroConfigMutable()->gyro_soft_notch_hz_1 = gyroConfig_gyro_soft_notch_hz_1;
@@ -472,6 +485,8 @@ static long cmsx_FilterPerProfileWriteback(const OSD_Entry *self)
 {
     UNUSED(self);
 
+    configSnapshotTouch(PG_PID_PROFILE);
+
     pidProfile_t *pidProfile = currentPidProfile;
 
     pidProfile->dterm_lowpass_hz   = cmsx_dterm_lowpass_hz;
@@ -203,6 +203,71 @@ FAST_CODE float biquadFilterApply(biquadFilter_t *filter, float input)
     return result;
 }
 
+// Four lane biquad, all lanes share the coefficients so they are loaded once per sample set
+
+static void biquadFilterVec4SetCoefficients(biquadFilterVec4_t *filter, float b0, float b1, float b2, float a1, float a2)
+{
+    filter->b0 = b0;
+    filter->b1 = b1;
+    filter->b2 = b2;
+    filter->a1 = a1;
+    filter->a2 = a2;
+}
+
+static void biquadFilterVec4Reset(biquadFilterVec4_t *filter)
+{
+    memset(filter->x1, 0, sizeof(filter->x1));
+    memset(filter->x2, 0, sizeof(filter->x2));
+    memset(filter->y1, 0, sizeof(filter->y1));
+    memset(filter->y2, 0, sizeof(filter->y2));
+}
+
+FAST_CODE void biquadFilterVec4UpdateLPF(biquadFilterVec4_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilter_t lane;
+    biquadFilterInitLPF(&lane, filterFreq, refreshRate);
+    biquadFilterVec4SetCoefficients(filter, lane.b0, lane.b1, lane.b2, lane.a1, lane.a2);
+}
+
+void biquadFilterVec4InitLPF(biquadFilterVec4_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterVec4UpdateLPF(filter, filterFreq, refreshRate);
+    biquadFilterVec4Reset(filter);
+}
+
+// PT1 expressed as a biquad: y = k * x + (1 - k) * y1
+FAST_CODE void biquadFilterVec4UpdatePT1(biquadFilterVec4_t *filter, float k)
+{
+    biquadFilterVec4SetCoefficients(filter, k, 0.0f, 0.0f, k - 1.0f, 0.0f);
+}
+
+void biquadFilterVec4InitPT1(biquadFilterVec4_t *filter, float k)
+{
+    biquadFilterVec4UpdatePT1(filter, k);
+    biquadFilterVec4Reset(filter);
+}
+
+FAST_CODE void biquadFilterVec4ApplyDF1(biquadFilterVec4_t *filter, const float *input, float *output)
+{
+    const float b0 = filter->b0;
+    const float b1 = filter->b1;
+    const float b2 = filter->b2;
+    const float a1 = filter->a1;
+    const float a2 = filter->a2;
+
+    for (int i = 0; i < 4; i++) {
+        const float result = b0 * input[i] + b1 * filter->x1[i] + b2 * filter->x2[i] - a1 * filter->y1[i] - a2 * filter->y2[i];
+
+        filter->x2[i] = filter->x1[i];
+        filter->x1[i] = input[i];
+
+        filter->y2[i] = filter->y1[i];
+        filter->y1[i] = result;
+
+        output[i] = result;
+    }
+}
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf)
 {
     filter->movingWindowIndex = 0;
@@ -41,6 +41,12 @@ typedef struct biquadFilter_s {
     float x1, x2, y1, y2;
 } biquadFilter_t;
 
+/* four lanes (e.g. the RPYT rc channels) sharing one set of biquad coefficients */
+typedef struct biquadFilterVec4_s {
+    float b0, b1, b2, a1, a2;
+    float x1[4], x2[4], y1[4], y2[4];
+} biquadFilterVec4_t;
+
 typedef struct laggedMovingAverage_s {
     uint16_t movingWindowIndex;
     uint16_t windowSize;
@@ -73,6 +79,12 @@ float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
 float biquadFilterApply(biquadFilter_t *filter, float input);
 float filterGetNotchQ(float centerFreq, float cutoffFreq);
 
+void biquadFilterVec4InitLPF(biquadFilterVec4_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterVec4UpdateLPF(biquadFilterVec4_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterVec4InitPT1(biquadFilterVec4_t *filter, float k);
+void biquadFilterVec4UpdatePT1(biquadFilterVec4_t *filter, float k);
+void biquadFilterVec4ApplyDF1(biquadFilterVec4_t *filter, const float *input, float *output);
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
 float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
 
@@ -0,0 +1,198 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_LZSS
+
+#include "common/maths.h"
+
+#include "lzss.h"
+
+#define LZSS_WINDOW_MASK (LZSS_WINDOW_SIZE - 1)
+// Matches stay clear of the window bytes the lookahead overwrites
+#define LZSS_MAX_DISTANCE (LZSS_WINDOW_SIZE - LZSS_MAX_MATCH)
+// A flag byte and eight matches
+#define LZSS_GROUP_SIZE_MAX (1 + 8 * sizeof(uint16_t))
+
+void lzssEncoderInit(lzssEncoder_t *encoder, lzssWrite_t writer, void *arg)
+{
+    memset(encoder, 0, sizeof(*encoder));
+    encoder->writer = writer;
+    encoder->arg = arg;
+}
+
+static void lzssEncoderWriteBlock(lzssEncoder_t *encoder)
+{
+    encoder->writer(encoder->arg, encoder->block, encoder->blockLength);
+    encoder->blockLength = 0;
+    encoder->flagMask = 0;
+}
+
+static void lzssEncoderAddItem(lzssEncoder_t *encoder, bool isMatch, uint16_t item)
+{
+    if (!encoder->flagMask) {
+        if (encoder->blockLength + LZSS_GROUP_SIZE_MAX > LZSS_BLOCK_SIZE) {
+            lzssEncoderWriteBlock(encoder);
+        }
+        encoder->flagIndex = encoder->blockLength++;
+        encoder->block[encoder->flagIndex] = 0;
+        encoder->flagMask = 1;
+    }
+
+    if (isMatch) {
+        encoder->block[encoder->flagIndex] |= encoder->flagMask;
+        encoder->block[encoder->blockLength++] = item & 0xff;
+        encoder->block[encoder->blockLength++] = item >> 8;
+    } else {
+        encoder->block[encoder->blockLength++] = item;
+    }
+    encoder->flagMask <<= 1;
+}
+
+static uint16_t lzssHash(const lzssEncoder_t *encoder, uint32_t position)
+{
+    const uint32_t value = encoder->window[position & LZSS_WINDOW_MASK]
+        | encoder->window[(position + 1) & LZSS_WINDOW_MASK] << 8
+        | encoder->window[(position + 2) & LZSS_WINDOW_MASK] << 16;
+
+    return (value * 2654435761U) >> 23 & (LZSS_HASH_SIZE - 1);
+}
+
+// Encode a match or literal at the start of the lookahead
+static void lzssEncodeNext(lzssEncoder_t *encoder)
+{
+    const uint32_t position = encoder->encodedCount;
+    const uint32_t lookahead = encoder->appendedCount - position;
+    uint32_t matchLength = 0;
+    uint16_t distance = 0;
+
+    if (lookahead >= LZSS_MIN_MATCH) {
+        uint16_t *head = &encoder->head[lzssHash(encoder, position)];
+        distance = position - *head;
+        *head = position;
+
+        if (distance > 0 && distance <= LZSS_MAX_DISTANCE && distance <= position) {
+            const uint32_t maxLength = MIN(lookahead, (uint32_t)LZSS_MAX_MATCH);
+            while (matchLength < maxLength
+                && encoder->window[(position - distance + matchLength) & LZSS_WINDOW_MASK] == encoder->window[(position + matchLength) & LZSS_WINDOW_MASK]) {
+                matchLength++;
+            }
+        }
+    }
+
+    if (matchLength >= LZSS_MIN_MATCH) {
+        lzssEncoderAddItem(encoder, true, (distance - 1) << LZSS_LENGTH_BITS | (matchLength - LZSS_MIN_MATCH));
+        // keep the positions inside the match findable
+        for (uint32_t i = 1; i < matchLength && position + i + LZSS_MIN_MATCH <= encoder->appendedCount; i++) {
+            encoder->head[lzssHash(encoder, position + i)] = position + i;
+        }
+        encoder->encodedCount += matchLength;
+    } else {
+        lzssEncoderAddItem(encoder, false, encoder->window[position & LZSS_WINDOW_MASK]);
+        encoder->encodedCount++;
+    }
+}
+
+/*
+ * Add data to the stream. Encoding lags LZSS_MAX_MATCH bytes behind, completed blocks are handed to the writer.
+ */
+void lzssEncoderAppend(lzssEncoder_t *encoder, const uint8_t *data, int count)
+{
+    for (const uint8_t *end = data + count; data < end; data++) {
+        encoder->window[encoder->appendedCount++ & LZSS_WINDOW_MASK] = *data;
+        if (encoder->appendedCount - encoder->encodedCount >= LZSS_MAX_MATCH) {
+            lzssEncodeNext(encoder);
+        }
+    }
+}
+
+/*
+ * Encode the lookahead and hand the block so far to the writer, so that everything appended can be decoded.
+ */
+void lzssEncoderFlush(lzssEncoder_t *encoder)
+{
+    while (encoder->encodedCount < encoder->appendedCount) {
+        lzssEncodeNext(encoder);
+    }
+    if (encoder->blockLength) {
+        lzssEncoderWriteBlock(encoder);
+    }
+}
+
+void lzssDecoderInit(lzssDecoder_t *decoder)
+{
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+void lzssDecoderSetBlock(lzssDecoder_t *decoder, const uint8_t *block, int length)
+{
+    decoder->block = block;
+    decoder->blockEnd = block + length;
+    decoder->flagMask = 0;
+}
+
+/*
+ * Return the next decoded byte, or -1 once the block is used up.
+ */
+int lzssDecoderGet(lzssDecoder_t *decoder)
+{
+    uint8_t c;
+
+    if (decoder->matchLength) {
+        c = decoder->window[(decoder->decodedCount - decoder->matchDistance) & LZSS_WINDOW_MASK];
+        decoder->matchLength--;
+    } else {
+        if (!decoder->flagMask) {
+            if (decoder->block >= decoder->blockEnd) {
+                return -1;
+            }
+            decoder->flags = *decoder->block++;
+            decoder->flagMask = 1;
+        }
+        if (decoder->block >= decoder->blockEnd) {
+            return -1;
+        }
+
+        if (decoder->flags & decoder->flagMask) {
+            if (decoder->blockEnd - decoder->block < 2) {
+                decoder->block = decoder->blockEnd;
+                return -1;
+            }
+            const uint16_t item = decoder->block[0] | decoder->block[1] << 8;
+            decoder->block += 2;
+            decoder->matchDistance = (item >> LZSS_LENGTH_BITS) + 1;
+            decoder->matchLength = (item & ((1 << LZSS_LENGTH_BITS) - 1)) + LZSS_MIN_MATCH - 1;
+            c = decoder->window[(decoder->decodedCount - decoder->matchDistance) & LZSS_WINDOW_MASK];
+        } else {
+            c = *decoder->block++;
+        }
+        decoder->flagMask <<= 1;
+    }
+
+    decoder->window[decoder->decodedCount++ & LZSS_WINDOW_MASK] = c;
+
+    return c;
+}
+#endif // USE_LZSS
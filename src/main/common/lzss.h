@@ -0,0 +1,73 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * LZSS coder for text streams such as CLI dumps.
+ *
+ * A block is a run of groups, each a flag byte followed by up to 8 items. Bit n of the flag byte, LSB first, tells
+ * whether item n is a literal byte or a match. A match is a little endian uint16_t holding the length less
+ * LZSS_MIN_MATCH in the low LZSS_LENGTH_BITS bits and the distance back less one in the rest. Groups never span
+ * blocks, but matches reach back into the history of earlier blocks of the stream.
+ */
+
+#define LZSS_WINDOW_SIZE 1024 // power of two
+#define LZSS_LENGTH_BITS 5
+#define LZSS_MIN_MATCH 3
+#define LZSS_MAX_MATCH (LZSS_MIN_MATCH + (1 << LZSS_LENGTH_BITS) - 1)
+#define LZSS_HASH_SIZE 256 // power of two
+#define LZSS_BLOCK_SIZE 128
+
+typedef void (*lzssWrite_t)(void *arg, const uint8_t *data, int count);
+
+typedef struct lzssEncoder_s {
+    lzssWrite_t writer;
+    void *arg;
+    uint32_t appendedCount;         // bytes added to the window
+    uint32_t encodedCount;          // bytes of those already encoded, the rest is lookahead
+    uint8_t blockLength;
+    uint8_t flagIndex;              // of the flag byte of the current group in block
+    uint8_t flagMask;               // for the next item of the group, 0 if a new group is due
+    uint8_t block[LZSS_BLOCK_SIZE];
+    uint16_t head[LZSS_HASH_SIZE];  // low 16 bits of the latest position of each hash of three bytes
+    uint8_t window[LZSS_WINDOW_SIZE];
+} lzssEncoder_t;
+
+typedef struct lzssDecoder_s {
+    const uint8_t *block;
+    const uint8_t *blockEnd;
+    uint32_t decodedCount;
+    uint16_t matchDistance;
+    uint8_t matchLength;            // bytes of the current match still to be copied
+    uint8_t flags;
+    uint8_t flagMask;
+    uint8_t window[LZSS_WINDOW_SIZE];
+} lzssDecoder_t;
+
+void lzssEncoderInit(lzssEncoder_t *encoder, lzssWrite_t writer, void *arg);
+void lzssEncoderAppend(lzssEncoder_t *encoder, const uint8_t *data, int count);
+void lzssEncoderFlush(lzssEncoder_t *encoder);
+
+void lzssDecoderInit(lzssDecoder_t *decoder);
+void lzssDecoderSetBlock(lzssDecoder_t *decoder, const uint8_t *block, int length);
+int lzssDecoderGet(lzssDecoder_t *decoder);
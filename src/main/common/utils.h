@@ -58,7 +58,11 @@
 #define UNUSED(x) (void)(x)
 #endif
 
+#ifdef __cplusplus
+#define STATIC_ASSERT(condition, name) static_assert((condition), #name)
+#else
 #define STATIC_ASSERT(condition, name) _Static_assert((condition), #name)
+#endif
 
 
 #define BIT(x) (1 << (x))
@@ -43,39 +43,28 @@ extern uint8_t __config_end;
 
 static uint16_t eepromConfigSize;
 
-typedef enum {
-    CR_CLASSICATION_SYSTEM   = 0,
-    CR_CLASSICATION_PROFILE_LAST = CR_CLASSICATION_SYSTEM,
-} configRecordFlags_e;
+// Most registered PGs the tables kept for each PG are sized for, with more the EEPROM is handled without them
+#define EEPROM_PG_COUNT_MAX         128
 
-#define CR_CLASSIFICATION_MASK  (0x3)
-#define CRC_START_VALUE         0xFFFF
-#define CRC_CHECK_VALUE         0x1D0F  // pre-calculated value of CRC that includes the CRC itself
+#ifdef USE_EEPROM_LOG
+// Segments of changed records are appended after the saved copy, each starting on a word boundary
+#define EEPROM_LOG_ALIGN(offset)    (((offset) + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1))
+#define EEPROM_LOG_MAGIC            0xDE1A
 
-// Header for the saved copy.
+// Header for each segment appended to the saved copy. The segment holds records, a footer and a CRC like the saved
+// copy, with the CRC chained to the CRC of the segment before so that stale segments left in the region are ignored.
 typedef struct {
-    uint8_t eepromConfigVersion;
-    uint8_t magic_be;           // magic number, should be 0xBE
-} PG_PACKED configHeader_t;
-
-// Header for each stored PG.
-typedef struct {
-    // split up.
-    uint16_t size;
-    pgn_t pgn;
-    uint8_t version;
-
-    // lower 2 bits used to indicate system or profile number, see CR_CLASSIFICATION_MASK
-    uint8_t flags;
-
-    uint8_t pg[];
-} PG_PACKED configRecord_t;
-
-// Footer for the saved copy.
-typedef struct {
-    uint16_t terminator;
-} PG_PACKED configFooter_t;
-// checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
+    uint16_t magic;
+    uint16_t sequence;          // 1 for the first segment after the saved copy
+} PG_PACKED configLogHeader_t;
+
+static struct {
+    uint16_t sequence;          // of the last valid segment
+    bool synced;                // recordCrc holds the CRC of the latest record of every PG in the EEPROM
+    bool erased;                // the space after the last valid segment can be written without erasing it first
+    uint16_t recordCrc[EEPROM_PG_COUNT_MAX];
+} eepromLog;
+#endif
 
 // Used to check the compiler packing at build time.
 typedef struct {
@@ -92,6 +81,9 @@ void initEEPROM(void)
 
     STATIC_ASSERT(sizeof(configFooter_t) == 2, footer_size_failed);
     STATIC_ASSERT(sizeof(configRecord_t) == 6, record_size_failed);
+#ifdef USE_EEPROM_LOG
+    STATIC_ASSERT(sizeof(configLogHeader_t) == 4, log_header_size_failed);
+#endif
 }
 
 bool isEEPROMVersionValid(void)
@@ -106,23 +98,16 @@ bool isEEPROMVersionValid(void)
     return true;
 }
 
-// Scan the EEPROM config. Returns true if the config is valid.
-bool isEEPROMStructureValid(void)
+// Scan the records of the saved copy or of a segment, up to and including the footer and CRC.
+// Returns the end of the CRC, NULL if the records or the CRC are not valid.
+static const uint8_t *scanEEPROMRecords(const uint8_t *p, uint16_t crc)
 {
-    const uint8_t *p = &__config_start;
-    const configHeader_t *header = (const configHeader_t *)p;
-
-    if (header->magic_be != 0xBE) {
-        return false;
-    }
-
-    uint16_t crc = CRC_START_VALUE;
-    crc = crc16_ccitt_update(crc, header, sizeof(*header));
-    p += sizeof(*header);
-
     for (;;) {
         const configRecord_t *record = (const configRecord_t *)p;
 
+        if (p + sizeof(configFooter_t) + sizeof(uint16_t) > &__config_end) {
+            return NULL;
+        }
         if (record->size == 0) {
             // Found the end.  Stop scanning.
             break;
@@ -130,7 +115,7 @@ bool isEEPROMStructureValid(void)
         if (p + record->size >= &__config_end
             || record->size < sizeof(*record)) {
             // Too big or too small.
-            return false;
+            return NULL;
         }
 
         crc = crc16_ccitt_update(crc, p, record->size);
@@ -145,12 +130,71 @@ bool isEEPROMStructureValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
+    p += sizeof(*storedCrc);
+
+    // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
+    return crc == CRC_CHECK_VALUE ? p : NULL;
+}
+
+#ifdef USE_EEPROM_LOG
+// Follow the segments appended to the saved copy that ends at p. Returns the end of the last valid one.
+static const uint8_t *scanEEPROMLog(const uint8_t *p)
+{
+    eepromLog.sequence = 0;
+
+    for (;;) {
+        const uint8_t *segment = &__config_start + EEPROM_LOG_ALIGN(p - &__config_start);
+        const configLogHeader_t *logHeader = (const configLogHeader_t *)segment;
+        if (segment + sizeof(*logHeader) > &__config_end) {
+            eepromLog.erased = false;
+            break;
+        }
+        if (logHeader->magic != EEPROM_LOG_MAGIC || logHeader->sequence != eepromLog.sequence + 1) {
+            // anything but erased flash here is stale or was cut short by a reset, and has to be erased before writing
+            eepromLog.erased = logHeader->magic == 0xFFFF && logHeader->sequence == 0xFFFF;
+            break;
+        }
+
+        // the stored CRC of the segment before starts the CRC of this one
+        uint16_t crc = CRC_START_VALUE;
+        crc = crc16_ccitt_update(crc, p - sizeof(uint16_t), sizeof(uint16_t));
+        crc = crc16_ccitt_update(crc, logHeader, sizeof(*logHeader));
+        const uint8_t *end = scanEEPROMRecords(segment + sizeof(*logHeader), crc);
+        if (!end) {
+            eepromLog.erased = false;
+            break;
+        }
+
+        eepromLog.sequence = logHeader->sequence;
+        p = end;
+    }
+
+    return p;
+}
+#endif
+
+// Scan the EEPROM config. Returns true if the config is valid.
+bool isEEPROMStructureValid(void)
+{
+    const uint8_t *p = &__config_start;
+    const configHeader_t *header = (const configHeader_t *)p;
+
+    uint16_t crc = CRC_START_VALUE;
+    crc = crc16_ccitt_update(crc, header, sizeof(*header));
+    if (header->magic_be != 0xBE || !(p = scanEEPROMRecords(p + sizeof(*header), crc))) {
+#ifdef USE_EEPROM_LOG
+        eepromLog.synced = false;
+#endif
+        return false;
+    }
+
+#ifdef USE_EEPROM_LOG
+    p = scanEEPROMLog(p);
+#endif
 
     eepromConfigSize = p - &__config_start;
 
-    // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+    return true;
 }
 
 uint16_t getEEPROMConfigSize(void)
@@ -158,49 +202,156 @@ uint16_t getEEPROMConfigSize(void)
     return eepromConfigSize;
 }
 
+// Return the record at p, or the first record of the next segment if p is at the end of one. Returns NULL at the end.
+// this function assumes that EEPROM content is valid
+static const configRecord_t *eepromRecordAt(const uint8_t *p)
+{
+    const configRecord_t *record = (const configRecord_t *)p;
+#ifdef USE_EEPROM_LOG
+    while (record->size == 0) {
+        // skip the footer and CRC, a later segment replaces the records that came before
+        const uint32_t segment = EEPROM_LOG_ALIGN(p + sizeof(configFooter_t) + sizeof(uint16_t) - &__config_start);
+        if (segment >= eepromConfigSize) {
+            return NULL;
+        }
+        p = &__config_start + segment + sizeof(configLogHeader_t);
+        record = (const configRecord_t *)p;
+    }
+#endif
+    if (record->size == 0
+        || p + record->size >= &__config_end
+        || record->size < sizeof(*record)) {
+        return NULL;
+    }
+
+    return record;
+}
+
+static const configRecord_t *eepromFirstRecord(void)
+{
+    return eepromRecordAt(&__config_start + sizeof(configHeader_t));
+}
+
+static const configRecord_t *eepromNextRecord(const configRecord_t *record)
+{
+    return eepromRecordAt((const uint8_t *)record + record->size);
+}
+
+// Note where the latest record of every PG is in one pass, rather than scanning the EEPROM for each PG
+static void indexEEPROM(uint16_t *recordOffset)
+{
+    memset(recordOffset, 0, PG_REGISTRY_SIZE * sizeof(*recordOffset));
+
+    // records are stored in registry order, so the PG of each one is looked for from the PG of the one before
+    const pgRegistry_t *reg = __pg_registry_start;
+    for (const configRecord_t *record = eepromFirstRecord(); record; record = eepromNextRecord(record)) {
+        if ((record->flags & CR_CLASSIFICATION_MASK) != CR_CLASSICATION_SYSTEM) {
+            continue;
+        }
+        for (int i = 0; i < PG_REGISTRY_SIZE; i++) {
+            if (pgN(reg) == record->pgn) {
+                recordOffset[reg - __pg_registry_start] = (const uint8_t *)record - &__config_start;
+                break;
+            }
+            if (++reg == __pg_registry_end) {
+                reg = __pg_registry_start;
+            }
+        }
+    }
+}
+
 // find config record for reg + classification (profile info) in EEPROM
 // return NULL when record is not found
 // this function assumes that EEPROM content is valid
 static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
 {
-    const uint8_t *p = &__config_start;
-    p += sizeof(configHeader_t);             // skip header
-    while (true) {
-        const configRecord_t *record = (const configRecord_t *)p;
-        if (record->size == 0
-            || p + record->size >= &__config_end
-            || record->size < sizeof(*record))
-            break;
+    const configRecord_t *found = NULL;
+    for (const configRecord_t *record = eepromFirstRecord(); record; record = eepromNextRecord(record)) {
         if (pgN(reg) == record->pgn
             && (record->flags & CR_CLASSIFICATION_MASK) == classification)
-            return record;
-        p += record->size;
+            found = record;
+    }
+
+    return found;
+}
+
+#ifdef USE_EEPROM_LOG
+static uint16_t eepromRecordCrc(const pgRegistry_t *reg)
+{
+    const configRecord_t record = {
+        .size = sizeof(configRecord_t) + pgSize(reg),
+        .pgn = pgN(reg),
+        .version = pgVersion(reg),
+        .flags = CR_CLASSICATION_SYSTEM,
+    };
+
+    uint16_t crc = CRC_START_VALUE;
+    crc = crc16_ccitt_update(crc, &record, sizeof(record));
+    return crc16_ccitt_update(crc, reg->address, pgSize(reg));
+}
+
+// Remember what the EEPROM holds for every PG, so that the next write only appends the groups that changed
+static void eepromLogSync(void)
+{
+    eepromLog.synced = PG_REGISTRY_SIZE <= EEPROM_PG_COUNT_MAX;
+    if (eepromLog.synced) {
+        PG_FOREACH(reg) {
+            eepromLog.recordCrc[reg - __pg_registry_start] = eepromRecordCrc(reg);
+        }
     }
-    // record not found
-    return NULL;
 }
+#endif
 
 // Initialize all PG records from EEPROM.
-// This functions processes all PGs sequentially, scanning EEPROM for each one. This is suboptimal,
-//   but each PG is loaded/initialized exactly once and in defined order.
+// This functions processes all PGs sequentially, each PG is loaded/initialized exactly once and in defined order.
 bool loadEEPROM(void)
 {
     bool success = true;
 
+    // offset of the latest record of each PG, 0 if there is none
+    uint16_t recordOffset[EEPROM_PG_COUNT_MAX];
+    const bool indexed = PG_REGISTRY_SIZE <= EEPROM_PG_COUNT_MAX;
+    if (indexed) {
+        indexEEPROM(recordOffset);
+    }
+
+#ifdef USE_EEPROM_LOG
+    bool synced = PG_REGISTRY_SIZE <= EEPROM_PG_COUNT_MAX;
+#endif
+
     PG_FOREACH(reg) {
-        const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+        const configRecord_t *rec;
+        if (indexed) {
+            const uint16_t offset = recordOffset[reg - __pg_registry_start];
+            rec = offset ? (const configRecord_t *)(&__config_start + offset) : NULL;
+        } else {
+            rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+        }
         if (rec) {
             // config from EEPROM is available, use it to initialize PG. pgLoad will handle version mismatch
             if (!pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version)) {
                 success = false;
             }
+#ifdef USE_EEPROM_LOG
+            if (synced) {
+                eepromLog.recordCrc[reg - __pg_registry_start] = crc16_ccitt_update(CRC_START_VALUE, rec, rec->size);
+            }
+#endif
         } else {
             pgReset(reg);
 
             success = false;
+#ifdef USE_EEPROM_LOG
+            // a missing record cannot be told apart from an unchanged one, the next write rewrites everything
+            synced = false;
+#endif
         }
     }
 
+#ifdef USE_EEPROM_LOG
+    eepromLog.synced = synced;
+#endif
+
     return success;
 }
 
@@ -253,8 +404,98 @@ static bool writeSettingsToEEPROM(void)
     return success;
 }
 
+#ifdef USE_EEPROM_LOG
+// Append the records of the PGs that changed since the EEPROM was last read or written, without erasing anything.
+// Returns false if the segment does not fit or the EEPROM has to be rewritten as a whole.
+static bool appendSettingsToEEPROM(void)
+{
+    if (!eepromLog.synced || !eepromLog.erased || !isEEPROMVersionValid()) {
+        return false;
+    }
+
+    uint32_t segmentSize = sizeof(configLogHeader_t) + sizeof(configFooter_t) + sizeof(uint16_t);
+    bool changed = false;
+    PG_FOREACH(reg) {
+        if (eepromRecordCrc(reg) != eepromLog.recordCrc[reg - __pg_registry_start]) {
+            segmentSize += sizeof(configRecord_t) + pgSize(reg);
+            changed = true;
+        }
+    }
+
+    if (!changed) {
+        return true;
+    }
+
+    const uint32_t segment = EEPROM_LOG_ALIGN(eepromConfigSize);
+    if (segment + segmentSize > (uint32_t)(&__config_end - &__config_start)) {
+        return false;
+    }
+
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+    config_streamer_start(&streamer, (uintptr_t)&__config_start + segment, segmentSize);
+
+    const configLogHeader_t logHeader = {
+        .magic = EEPROM_LOG_MAGIC,
+        .sequence = eepromLog.sequence + 1,
+    };
+
+    uint16_t crc = CRC_START_VALUE;
+    crc = crc16_ccitt_update(crc, &__config_start + eepromConfigSize - sizeof(uint16_t), sizeof(uint16_t));
+    config_streamer_write(&streamer, (uint8_t *)&logHeader, sizeof(logHeader));
+    crc = crc16_ccitt_update(crc, (uint8_t *)&logHeader, sizeof(logHeader));
+    PG_FOREACH(reg) {
+        if (eepromRecordCrc(reg) == eepromLog.recordCrc[reg - __pg_registry_start]) {
+            continue;
+        }
+
+        const uint16_t regSize = pgSize(reg);
+        configRecord_t record = {
+            .size = sizeof(configRecord_t) + regSize,
+            .pgn = pgN(reg),
+            .version = pgVersion(reg),
+            .flags = CR_CLASSICATION_SYSTEM,
+        };
+
+        config_streamer_write(&streamer, (uint8_t *)&record, sizeof(record));
+        crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
+        config_streamer_write(&streamer, reg->address, regSize);
+        crc = crc16_ccitt_update(crc, reg->address, regSize);
+    }
+
+    configFooter_t footer = {
+        .terminator = 0,
+    };
+
+    config_streamer_write(&streamer, (uint8_t *)&footer, sizeof(footer));
+    crc = crc16_ccitt_update(crc, (uint8_t *)&footer, sizeof(footer));
+
+    const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
+    config_streamer_write(&streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
+
+    config_streamer_flush(&streamer);
+
+    const uint16_t sequence = eepromLog.sequence;
+    if (config_streamer_finish(&streamer) != 0 || !isEEPROMStructureValid() || eepromLog.sequence != sequence + 1) {
+        return false;
+    }
+
+    eepromLogSync();
+
+    return true;
+}
+#endif
+
 void writeConfigToEEPROM(void)
 {
+#ifdef USE_EEPROM_LOG
+    // Only rewrite the whole region, erasing it, when the changes do not fit after what is there
+    if (appendSettingsToEEPROM()) {
+        return;
+    }
+#endif
+
     bool success = false;
     // write it
     for (int attempt = 0; attempt < 3 && !success; attempt++) {
@@ -264,6 +505,9 @@ void writeConfigToEEPROM(void)
     }
 
     if (success && isEEPROMVersionValid() && isEEPROMStructureValid()) {
+#ifdef USE_EEPROM_LOG
+        eepromLogSync();
+#endif
         return;
     }
 
@@ -23,7 +23,43 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#define EEPROM_CONF_VERSION 171
+#include "pg/pg.h"
+
+#define EEPROM_CONF_VERSION 172
+
+typedef enum {
+    CR_CLASSICATION_SYSTEM   = 0,
+    CR_CLASSICATION_PROFILE_LAST = CR_CLASSICATION_SYSTEM,
+} configRecordFlags_e;
+
+#define CR_CLASSIFICATION_MASK  (0x3)
+#define CRC_START_VALUE         0xFFFF
+#define CRC_CHECK_VALUE         0x1D0F  // pre-calculated value of CRC that includes the CRC itself
+
+// Header for the saved copy.
+typedef struct {
+    uint8_t eepromConfigVersion;
+    uint8_t magic_be;           // magic number, should be 0xBE
+} PG_PACKED configHeader_t;
+
+// Header for each stored PG.
+typedef struct {
+    // split up.
+    uint16_t size;
+    pgn_t pgn;
+    uint8_t version;
+
+    // lower 2 bits used to indicate system or profile number, see CR_CLASSIFICATION_MASK
+    uint8_t flags;
+
+    uint8_t pg[];
+} PG_PACKED configRecord_t;
+
+// Footer for the saved copy.
+typedef struct {
+    uint16_t terminator;
+} PG_PACKED configFooter_t;
+// checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
 bool isEEPROMVersionValid(void);
 bool isEEPROMStructureValid(void);
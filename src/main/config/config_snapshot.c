@@ -0,0 +1,508 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+#include "platform.h"
+
+#ifdef USE_CONFIG_SNAPSHOT
+
+#include "common/crc.h"
+#include "common/utils.h"
+
+#include "config/config_snapshot.h"
+
+#include "fc/config.h"
+#include "fc/controlrate_profile.h"
+#include "fc/rc.h"
+#include "fc/runtime_config.h"
+
+#include "flight/pid.h"
+
+#include "io/beeper.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "sensors/gyro.h"
+
+// The groups a snapshot covers. Loading one re-initialises the gains, rates and filters, the gyro settings that are
+// only taken up at boot have to match the live config, see snapshotNeedsReboot().
+typedef enum {
+    SNAPSHOT_PG_GYRO = 0,
+    SNAPSHOT_PG_PID,
+    SNAPSHOT_PG_RATES,
+    SNAPSHOT_PG_COUNT
+} snapshotPg_e;
+
+static const pgn_t snapshotPgns[SNAPSHOT_PG_COUNT] = {
+    [SNAPSHOT_PG_GYRO] = PG_GYRO_CONFIG,
+    [SNAPSHOT_PG_PID] = PG_PID_PROFILE,
+    [SNAPSHOT_PG_RATES] = PG_CONTROL_RATE_PROFILES,
+};
+
+// A record in the pool is this header followed by the snapshot's copy of the group
+typedef struct snapshotRecordHeader_s {
+    uint8_t slot;
+    uint8_t pg;
+} snapshotRecordHeader_t;
+
+// Enough for one snapshot to differ from the live config in every group, snapshots only hold the groups that differ
+#define CONFIG_SNAPSHOT_POOL_SIZE (sizeof(gyroConfig_t) + sizeof(pidProfile_t) * MAX_PROFILE_COUNT \
+    + sizeof(controlRateConfig_t) * CONTROL_RATE_PROFILE_COUNT + SNAPSHOT_PG_COUNT * sizeof(snapshotRecordHeader_t))
+
+typedef struct configSnapshot_s {
+    char name[CONFIG_SNAPSHOT_NAME_LENGTH + 1];     // empty while the slot is free
+    uint8_t dirty;          // bit per snapshotPg_e, set while the snapshot holds its own copy of the group
+    bool incomplete;
+} configSnapshot_t;
+
+// The snapshots are a group of their own, so they are saved and loaded along with the groups they differ from
+typedef struct configSnapshotStore_s {
+    configSnapshot_t snapshots[CONFIG_SNAPSHOT_COUNT];
+    uint16_t poolUsed;
+    uint8_t pool[CONFIG_SNAPSHOT_POOL_SIZE];
+} configSnapshotStore_t;
+
+PG_DECLARE(configSnapshotStore_t, snapshotStore);
+
+PG_REGISTER(configSnapshotStore_t, snapshotStore, PG_CONFIG_SNAPSHOT, 0);
+
+static uint16_t reloadCrc[SNAPSHOT_PG_COUNT];
+static uint8_t pendingFilterInit;       // bit per snapshotPg_e, filter re-initialisation held back until disarm
+static bool modeKnown;
+static bool modeSelectSecond;
+
+static configSnapshot_t *snapshotGet(uint8_t slot)
+{
+    return &snapshotStoreMutable()->snapshots[slot];
+}
+
+static const pgRegistry_t *snapshotReg(snapshotPg_e pg)
+{
+    return pgFind(snapshotPgns[pg]);
+}
+
+static uint16_t snapshotRecordSize(const snapshotRecordHeader_t *header)
+{
+    return sizeof(*header) + pgSize(snapshotReg(header->pg));
+}
+
+static snapshotRecordHeader_t *snapshotRecordFind(uint8_t slot, snapshotPg_e pg)
+{
+    configSnapshotStore_t *store = snapshotStoreMutable();
+
+    for (uint16_t offset = 0; offset < store->poolUsed; ) {
+        snapshotRecordHeader_t *header = (snapshotRecordHeader_t *)&store->pool[offset];
+        if (header->slot == slot && header->pg == pg) {
+            return header;
+        }
+        offset += snapshotRecordSize(header);
+    }
+
+    return NULL;
+}
+
+static void snapshotRecordRemove(snapshotRecordHeader_t *header)
+{
+    configSnapshotStore_t *store = snapshotStoreMutable();
+
+    snapshotGet(header->slot)->dirty &= ~BIT(header->pg);
+
+    const uint16_t offset = (uint8_t *)header - store->pool;
+    const uint16_t size = snapshotRecordSize(header);
+    memmove(header, (uint8_t *)header + size, store->poolUsed - offset - size);
+    store->poolUsed -= size;
+}
+
+static void snapshotRelease(uint8_t slot)
+{
+    for (snapshotPg_e pg = 0; pg < SNAPSHOT_PG_COUNT; pg++) {
+        snapshotRecordHeader_t *header = snapshotRecordFind(slot, pg);
+        if (header) {
+            snapshotRecordRemove(header);
+        }
+    }
+}
+
+// True if the snapshot still shares the group with the live config, so it needs a copy before the group changes
+static bool snapshotShares(uint8_t slot, snapshotPg_e pg)
+{
+    return snapshotGet(slot)->name[0] && !snapshotGet(slot)->incomplete && !(snapshotGet(slot)->dirty & BIT(pg));
+}
+
+static void snapshotCopy(uint8_t slot, snapshotPg_e pg)
+{
+    configSnapshotStore_t *store = snapshotStoreMutable();
+    const pgRegistry_t *reg = snapshotReg(pg);
+    const uint16_t size = sizeof(snapshotRecordHeader_t) + pgSize(reg);
+    if (store->poolUsed + size > sizeof(store->pool)) {
+        // The snapshot can no longer be rebuilt, give its space to the others
+        snapshotRelease(slot);
+        snapshotGet(slot)->incomplete = true;
+        return;
+    }
+
+    snapshotRecordHeader_t *header = (snapshotRecordHeader_t *)&store->pool[store->poolUsed];
+    header->slot = slot;
+    header->pg = pg;
+    memcpy(header + 1, reg->address, pgSize(reg));
+    store->poolUsed += size;
+    snapshotGet(slot)->dirty |= BIT(pg);
+}
+
+// Drop the copies that match the live config again, e.g. after a group was touched but not changed
+static void snapshotCompact(void)
+{
+    configSnapshotStore_t *store = snapshotStoreMutable();
+
+    for (uint16_t offset = 0; offset < store->poolUsed; ) {
+        snapshotRecordHeader_t *header = (snapshotRecordHeader_t *)&store->pool[offset];
+        const pgRegistry_t *reg = snapshotReg(header->pg);
+        if (memcmp(header + 1, reg->address, pgSize(reg)) == 0) {
+            snapshotRecordRemove(header);
+        } else {
+            offset += snapshotRecordSize(header);
+        }
+    }
+}
+
+static bool snapshotInUse(void)
+{
+    for (int slot = 0; slot < CONFIG_SNAPSHOT_COUNT; slot++) {
+        if (snapshotGet(slot)->name[0]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int snapshotFind(const char *name)
+{
+    for (int slot = 0; slot < CONFIG_SNAPSHOT_COUNT; slot++) {
+        if (snapshotGet(slot)->name[0] && strncasecmp(snapshotGet(slot)->name, name, CONFIG_SNAPSHOT_NAME_LENGTH) == 0) {
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+// True if the snapshot's gyro settings differ in anything gyroInitFilters() doesn't take up
+static bool snapshotNeedsReboot(uint8_t slot)
+{
+    const snapshotRecordHeader_t *header = snapshotRecordFind(slot, SNAPSHOT_PG_GYRO);
+    if (!header) {
+        return false;
+    }
+
+    gyroConfig_t snapshot;
+    memcpy(&snapshot, header + 1, sizeof(snapshot));
+    const gyroConfig_t *live = gyroConfig();
+
+    return snapshot.gyro_align != live->gyro_align
+        || snapshot.gyro_sync_denom != live->gyro_sync_denom
+        || snapshot.gyro_hardware_lpf != live->gyro_hardware_lpf
+        || snapshot.gyro_32khz_hardware_lpf != live->gyro_32khz_hardware_lpf
+        || snapshot.gyro_high_fsr != live->gyro_high_fsr
+        || snapshot.gyro_use_32khz != live->gyro_use_32khz
+        || snapshot.gyro_to_use != live->gyro_to_use
+        || snapshot.checkOverflow != live->checkOverflow
+        || snapshot.dyn_filter_width_percent != live->dyn_filter_width_percent
+        || snapshot.dyn_filter_range != live->dyn_filter_range;
+}
+
+static void snapshotFilterInit(uint8_t changed)
+{
+    if (changed & BIT(SNAPSHOT_PG_GYRO)) {
+        gyroInitFilters();
+    }
+    if (changed & BIT(SNAPSHOT_PG_PID)) {
+        pidInitFilters(currentPidProfile);
+    }
+}
+
+/*
+ * Re-initialise only what depends on the changed groups. Resetting filter state in flight would kick the loop, so
+ * while armed the gains and rates change straight away and the filters follow on disarm.
+ */
+static void snapshotActivate(uint8_t changed)
+{
+    if (changed & BIT(SNAPSHOT_PG_PID)) {
+        pidInitConfig(currentPidProfile);
+    }
+    if (changed & (BIT(SNAPSHOT_PG_PID) | BIT(SNAPSHOT_PG_RATES))) {
+        initRcProcessing();
+    }
+
+    if (ARMING_FLAG(ARMED)) {
+        pendingFilterInit |= changed;
+    } else {
+        snapshotFilterInit(changed);
+    }
+}
+
+static configSnapshotResult_e snapshotLoad(uint8_t slot)
+{
+    if (snapshotGet(slot)->incomplete) {
+        return CONFIG_SNAPSHOT_INCOMPLETE;
+    }
+    if (snapshotNeedsReboot(slot)) {
+        return CONFIG_SNAPSHOT_NEEDS_REBOOT;
+    }
+
+    const uint8_t changed = snapshotGet(slot)->dirty;
+    for (snapshotPg_e pg = 0; pg < SNAPSHOT_PG_COUNT; pg++) {
+        if (!(snapshotGet(slot)->dirty & BIT(pg))) {
+            continue;
+        }
+
+        // The live group is about to change, the other snapshots sharing it take a copy first. The first of them
+        // gets this snapshot's record by swapping contents, so A/B switching needs no pool space of its own.
+        int swapSlot = -1;
+        for (int other = 0; other < CONFIG_SNAPSHOT_COUNT; other++) {
+            if (other != slot && snapshotShares(other, pg)) {
+                if (swapSlot < 0) {
+                    swapSlot = other;
+                } else {
+                    snapshotCopy(other, pg);
+                }
+            }
+        }
+
+        const pgRegistry_t *reg = snapshotReg(pg);
+        snapshotRecordHeader_t *header = snapshotRecordFind(slot, pg);
+        uint8_t *copy = (uint8_t *)(header + 1);
+        if (swapSlot >= 0) {
+            for (int i = 0; i < pgSize(reg); i++) {
+                const uint8_t live = reg->address[i];
+                reg->address[i] = copy[i];
+                copy[i] = live;
+            }
+            header->slot = swapSlot;
+            snapshotGet(slot)->dirty &= ~BIT(pg);
+            snapshotGet(swapSlot)->dirty |= BIT(pg);
+        } else {
+            memcpy(reg->address, copy, pgSize(reg));
+            snapshotRecordRemove(header);
+        }
+    }
+
+    snapshotCompact();
+    snapshotActivate(changed);
+
+    return CONFIG_SNAPSHOT_OK;
+}
+
+/*
+ * Freeze the live config under a name, replacing a snapshot of the same name. Nothing is copied until one of the
+ * groups changes.
+ */
+configSnapshotResult_e configSnapshotSave(const char *name)
+{
+    if (!name[0]) {
+        return CONFIG_SNAPSHOT_NOT_FOUND;
+    }
+
+    int slot = snapshotFind(name);
+    if (slot < 0) {
+        slot = 0;
+        while (slot < CONFIG_SNAPSHOT_COUNT && snapshotGet(slot)->name[0]) {
+            slot++;
+        }
+        if (slot == CONFIG_SNAPSHOT_COUNT) {
+            return CONFIG_SNAPSHOT_NO_SLOT;
+        }
+    }
+
+    snapshotRelease(slot);
+    strncpy(snapshotGet(slot)->name, name, CONFIG_SNAPSHOT_NAME_LENGTH);
+    snapshotGet(slot)->name[CONFIG_SNAPSHOT_NAME_LENGTH] = '\0';
+    snapshotGet(slot)->incomplete = false;
+
+    return CONFIG_SNAPSHOT_OK;
+}
+
+configSnapshotResult_e configSnapshotLoad(const char *name)
+{
+    const int slot = snapshotFind(name);
+    if (slot < 0) {
+        return CONFIG_SNAPSHOT_NOT_FOUND;
+    }
+
+    return snapshotLoad(slot);
+}
+
+configSnapshotResult_e configSnapshotDelete(const char *name)
+{
+    const int slot = snapshotFind(name);
+    if (slot < 0) {
+        return CONFIG_SNAPSHOT_NOT_FOUND;
+    }
+
+    snapshotRelease(slot);
+    memset(snapshotGet(slot), 0, sizeof(configSnapshot_t));
+
+    return CONFIG_SNAPSHOT_OK;
+}
+
+const char *configSnapshotName(uint8_t slot)
+{
+    return slot < CONFIG_SNAPSHOT_COUNT && snapshotGet(slot)->name[0] ? snapshotGet(slot)->name : NULL;
+}
+
+bool configSnapshotIsComplete(uint8_t slot)
+{
+    return slot < CONFIG_SNAPSHOT_COUNT && !snapshotGet(slot)->incomplete;
+}
+
+// Bytes of the pool the snapshot holds
+uint16_t configSnapshotSize(uint8_t slot)
+{
+    uint16_t size = 0;
+    for (snapshotPg_e pg = 0; pg < SNAPSHOT_PG_COUNT; pg++) {
+        const snapshotRecordHeader_t *header = snapshotRecordFind(slot, pg);
+        if (header) {
+            size += snapshotRecordSize(header);
+        }
+    }
+
+    return size;
+}
+
+uint16_t configSnapshotPoolFree(void)
+{
+    return sizeof(snapshotStore()->pool) - snapshotStore()->poolUsed;
+}
+
+/*
+ * Must be called before a group is changed, snapshots that still share the group with the live config copy it.
+ */
+void configSnapshotTouch(pgn_t pgn)
+{
+    if (!snapshotInUse()) {
+        return;
+    }
+
+    for (snapshotPg_e pg = 0; pg < SNAPSHOT_PG_COUNT; pg++) {
+        if (snapshotPgns[pg] == pgn && snapshotReg(pg)) {
+            for (int slot = 0; slot < CONFIG_SNAPSHOT_COUNT; slot++) {
+                if (snapshotShares(slot, pg)) {
+                    snapshotCopy(slot, pg);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Bracket changes to the whole config that don't touch the groups one at a time, like fixing up an invalid config.
+ * Copying every group up front would not fit the pool, so a group that comes back different leaves the snapshots
+ * sharing it incomplete. Loads and resets don't need this, the snapshots are loaded or reset along with the groups.
+ */
+void configSnapshotReloadStart(void)
+{
+    if (!snapshotInUse()) {
+        return;
+    }
+
+    for (snapshotPg_e pg = 0; pg < SNAPSHOT_PG_COUNT; pg++) {
+        const pgRegistry_t *reg = snapshotReg(pg);
+        reloadCrc[pg] = reg ? crc16_ccitt_update(0, reg->address, pgSize(reg)) : 0;
+    }
+}
+
+void configSnapshotReloadEnd(void)
+{
+    if (!snapshotInUse()) {
+        return;
+    }
+
+    for (snapshotPg_e pg = 0; pg < SNAPSHOT_PG_COUNT; pg++) {
+        const pgRegistry_t *reg = snapshotReg(pg);
+        if (reg && crc16_ccitt_update(0, reg->address, pgSize(reg)) != reloadCrc[pg]) {
+            for (int slot = 0; slot < CONFIG_SNAPSHOT_COUNT; slot++) {
+                if (snapshotShares(slot, pg)) {
+                    snapshotRelease(slot);
+                    snapshotGet(slot)->incomplete = true;
+                }
+            }
+        }
+    }
+
+    snapshotCompact();
+}
+
+/*
+ * Called once the whole config has been loaded. Snapshots that don't fit the groups of this build, say after an
+ * update changed their size, are dropped.
+ */
+void configSnapshotLoaded(void)
+{
+    const configSnapshotStore_t *store = snapshotStore();
+    uint8_t dirty[CONFIG_SNAPSHOT_COUNT] = { 0 };
+    bool valid = store->poolUsed <= sizeof(store->pool);
+
+    for (uint16_t offset = 0; valid && offset < store->poolUsed; ) {
+        const snapshotRecordHeader_t *header = (const snapshotRecordHeader_t *)&store->pool[offset];
+
+        valid = offset + sizeof(*header) <= store->poolUsed && header->slot < CONFIG_SNAPSHOT_COUNT
+            && header->pg < SNAPSHOT_PG_COUNT && snapshotReg(header->pg) && !(dirty[header->slot] & BIT(header->pg));
+        if (valid) {
+            dirty[header->slot] |= BIT(header->pg);
+            offset += snapshotRecordSize(header);
+            valid = offset <= store->poolUsed;
+        }
+    }
+
+    for (int slot = 0; slot < CONFIG_SNAPSHOT_COUNT && valid; slot++) {
+        const configSnapshot_t *snapshot = &store->snapshots[slot];
+        valid = snapshot->dirty == dirty[slot] && !snapshot->name[CONFIG_SNAPSHOT_NAME_LENGTH] && (snapshot->name[0] || !dirty[slot]);
+    }
+
+    if (!valid) {
+        PG_RESET(snapshotStore);
+    }
+}
+
+/*
+ * Called with the state of the CONFIG SNAPSHOT mode: switching it on loads the second snapshot, off the first.
+ */
+void configSnapshotUpdate(bool selectSecond)
+{
+    if (modeKnown && selectSecond != modeSelectSecond) {
+        const uint8_t slot = selectSecond ? 1 : 0;
+        if (snapshotGet(slot)->name[0] && snapshotLoad(slot) == CONFIG_SNAPSHOT_OK) {
+            beeperConfirmationBeeps(slot + 1);
+        }
+    }
+    modeKnown = true;
+    modeSelectSecond = selectSecond;
+
+    if (pendingFilterInit && !ARMING_FLAG(ARMED)) {
+        snapshotFilterInit(pendingFilterInit);
+        pendingFilterInit = 0;
+    }
+}
+#endif // USE_CONFIG_SNAPSHOT
@@ -0,0 +1,59 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pg/pg.h"
+
+#define CONFIG_SNAPSHOT_COUNT 2
+#define CONFIG_SNAPSHOT_NAME_LENGTH 8
+
+typedef enum {
+    CONFIG_SNAPSHOT_OK = 0,
+    CONFIG_SNAPSHOT_NOT_FOUND,
+    CONFIG_SNAPSHOT_NO_SLOT,
+    CONFIG_SNAPSHOT_INCOMPLETE,     // a copy did not fit in the pool or the config was reloaded under it
+    CONFIG_SNAPSHOT_NEEDS_REBOOT,   // differs from the live config in gyro settings only taken up at boot
+} configSnapshotResult_e;
+
+#ifdef USE_CONFIG_SNAPSHOT
+configSnapshotResult_e configSnapshotSave(const char *name);
+configSnapshotResult_e configSnapshotLoad(const char *name);
+configSnapshotResult_e configSnapshotDelete(const char *name);
+const char *configSnapshotName(uint8_t slot);
+bool configSnapshotIsComplete(uint8_t slot);
+uint16_t configSnapshotSize(uint8_t slot);
+uint16_t configSnapshotPoolFree(void);
+
+void configSnapshotTouch(pgn_t pgn);
+void configSnapshotReloadStart(void);
+void configSnapshotReloadEnd(void);
+void configSnapshotLoaded(void);
+
+void configSnapshotUpdate(bool selectSecond);
+#else
+#define configSnapshotTouch(pgn) do {} while (0)
+#define configSnapshotReloadStart() do {} while (0)
+#define configSnapshotReloadEnd() do {} while (0)
+#define configSnapshotLoaded() do {} while (0)
+#endif
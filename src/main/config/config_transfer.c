@@ -0,0 +1,274 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_CONFIG_TRANSFER
+
+#include "common/crc.h"
+#include "common/maths.h"
+
+#include "config/config_eeprom.h"
+#include "config/config_snapshot.h"
+#include "pg/pg.h"
+
+#include "config_transfer.h"
+
+// The image is laid out the way writeSettingsToEEPROM() stores the config: header, one record per PG, footer and the
+// inverted big endian CRC, so that a backup can be checked with the same tools as an EEPROM dump.
+
+typedef struct {
+    uint32_t offset;        // of the next segment in the image
+    uint32_t from;          // of the next byte to copy
+    uint8_t *dst;
+    int remaining;
+    bool updateCrc;
+    uint16_t crc;
+} imageReader_t;
+
+typedef enum {
+    IMAGE_WRITE_HEADER = 0,
+    IMAGE_WRITE_RECORD_HEADER,
+    IMAGE_WRITE_RECORD_DATA,
+    IMAGE_WRITE_CRC,
+    IMAGE_WRITE_DONE,
+    IMAGE_WRITE_INVALID
+} imageWriteState_e;
+
+static struct {
+    imageWriteState_e state;
+    uint32_t offset;            // of the next byte expected
+    uint16_t crc;
+    uint8_t field[sizeof(configRecord_t)];  // header, record header, footer or CRC being assembled
+    uint8_t fieldLength;
+    const pgRegistry_t *reg;    // the record data is staged into, NULL to skip the record
+    uint16_t recordOffset;
+    uint16_t recordRemaining;
+} imageWrite = { .state = IMAGE_WRITE_INVALID };
+
+uint32_t configTransferImageSize(void)
+{
+    uint32_t size = sizeof(configHeader_t) + sizeof(configFooter_t) + sizeof(uint16_t);
+    PG_FOREACH(reg) {
+        size += sizeof(configRecord_t) + pgSize(reg);
+    }
+
+    return size;
+}
+
+static void readSegment(imageReader_t *reader, const void *data, uint32_t size)
+{
+    if (reader->updateCrc) {
+        reader->crc = crc16_ccitt_update(reader->crc, data, size);
+    }
+
+    const uint32_t start = reader->offset;
+    reader->offset += size;
+    if (reader->remaining == 0 || reader->offset <= reader->from) {
+        return;
+    }
+
+    const uint32_t skip = reader->from - start;
+    const int take = MIN(size - skip, (uint32_t)reader->remaining);
+    memcpy(reader->dst, (const uint8_t *)data + skip, take);
+    reader->dst += take;
+    reader->from += take;
+    reader->remaining -= take;
+}
+
+/*
+ * Copy up to length bytes of the image of the current config, starting at offset. Returns the number of bytes copied,
+ * 0 past the end of the image.
+ */
+int configTransferRead(uint32_t offset, uint8_t *dst, int length)
+{
+    const uint32_t crcOffset = configTransferImageSize() - sizeof(uint16_t);
+    imageReader_t reader = {
+        .from = offset,
+        .dst = dst,
+        .remaining = length,
+        // The CRC is over the whole image, only take the time to work it out for the chunk that carries it
+        .updateCrc = offset + length > crcOffset,
+        .crc = CRC_START_VALUE,
+    };
+
+    const configHeader_t header = {
+        .eepromConfigVersion = EEPROM_CONF_VERSION,
+        .magic_be = 0xBE,
+    };
+    readSegment(&reader, &header, sizeof(header));
+
+    PG_FOREACH(reg) {
+        if (!reader.updateCrc && reader.remaining == 0) {
+            break;
+        }
+
+        const configRecord_t record = {
+            .size = sizeof(configRecord_t) + pgSize(reg),
+            .pgn = pgN(reg),
+            .version = pgVersion(reg),
+            .flags = CR_CLASSICATION_SYSTEM,
+        };
+        readSegment(&reader, &record, sizeof(record));
+        readSegment(&reader, reg->address, pgSize(reg));
+    }
+
+    const configFooter_t footer = {
+        .terminator = 0,
+    };
+    readSegment(&reader, &footer, sizeof(footer));
+
+    if (reader.updateCrc) {
+        const uint16_t invertedBigEndianCrc = ~(((reader.crc & 0xFF) << 8) | (reader.crc >> 8));
+        readSegment(&reader, &invertedBigEndianCrc, sizeof(invertedBigEndianCrc));
+    }
+
+    return length - reader.remaining;
+}
+
+static void imageWriteStart(void)
+{
+    // Records are staged in the PG copies, a PG without a valid record in the image gets its defaults like loadEEPROM()
+    PG_FOREACH(reg) {
+        pgResetInstance(reg, reg->copy);
+    }
+
+    memset(&imageWrite, 0, sizeof(imageWrite));
+    imageWrite.state = IMAGE_WRITE_HEADER;
+    imageWrite.crc = CRC_START_VALUE;
+}
+
+static void imageWriteCommit(void)
+{
+    PG_FOREACH(reg) {
+        pgLoad(reg, reg->copy, pgSize(reg), pgVersion(reg));
+    }
+    configSnapshotLoaded();
+}
+
+// Handle a completed field, returns false if the image is invalid
+static bool imageWriteField(void)
+{
+    switch (imageWrite.state) {
+    case IMAGE_WRITE_HEADER:
+        if (imageWrite.fieldLength == sizeof(configHeader_t)) {
+            const configHeader_t *header = (const configHeader_t *)imageWrite.field;
+            if (header->eepromConfigVersion != EEPROM_CONF_VERSION || header->magic_be != 0xBE) {
+                return false;
+            }
+            imageWrite.state = IMAGE_WRITE_RECORD_HEADER;
+            imageWrite.fieldLength = 0;
+        }
+        break;
+
+    case IMAGE_WRITE_RECORD_HEADER:
+        if (imageWrite.fieldLength == sizeof(configFooter_t) && ((const configFooter_t *)imageWrite.field)->terminator == 0) {
+            imageWrite.state = IMAGE_WRITE_CRC;
+            imageWrite.fieldLength = 0;
+        } else if (imageWrite.fieldLength == sizeof(configRecord_t)) {
+            const configRecord_t *record = (const configRecord_t *)imageWrite.field;
+            if (record->size < sizeof(configRecord_t)) {
+                return false;
+            }
+
+            // Records of unknown PGs, other versions or profiles are skipped, as they are when loading the EEPROM
+            imageWrite.reg = pgFind(record->pgn);
+            if (imageWrite.reg && record->version == pgVersion(imageWrite.reg)
+                && (record->flags & CR_CLASSIFICATION_MASK) == CR_CLASSICATION_SYSTEM) {
+                pgResetInstance(imageWrite.reg, imageWrite.reg->copy);
+            } else {
+                imageWrite.reg = NULL;
+            }
+            imageWrite.recordOffset = 0;
+            imageWrite.recordRemaining = record->size - sizeof(configRecord_t);
+            imageWrite.state = imageWrite.recordRemaining ? IMAGE_WRITE_RECORD_DATA : IMAGE_WRITE_RECORD_HEADER;
+            imageWrite.fieldLength = 0;
+        }
+        break;
+
+    case IMAGE_WRITE_CRC:
+        if (imageWrite.fieldLength == sizeof(uint16_t)) {
+            // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
+            if (imageWrite.crc != CRC_CHECK_VALUE) {
+                return false;
+            }
+            imageWriteCommit();
+            imageWrite.state = IMAGE_WRITE_DONE;
+        }
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Take the next chunk of an image, which must start where the previous chunk ended. Offset 0 starts a new transfer.
+ * Nothing is loaded into the parameter groups until the whole image has arrived and its CRC checks out.
+ */
+configTransferResult_e configTransferWrite(uint32_t offset, const uint8_t *src, int length)
+{
+    if (offset == 0) {
+        imageWriteStart();
+    } else if (offset != imageWrite.offset || imageWrite.state == IMAGE_WRITE_DONE) {
+        imageWrite.state = IMAGE_WRITE_INVALID;
+    }
+
+    while (length > 0 && imageWrite.state != IMAGE_WRITE_INVALID) {
+        int take;
+        if (imageWrite.state == IMAGE_WRITE_RECORD_DATA) {
+            take = MIN(length, imageWrite.recordRemaining);
+            imageWrite.crc = crc16_ccitt_update(imageWrite.crc, src, take);
+            if (imageWrite.reg && imageWrite.recordOffset < pgSize(imageWrite.reg)) {
+                const int stage = MIN(take, pgSize(imageWrite.reg) - imageWrite.recordOffset);
+                memcpy(imageWrite.reg->copy + imageWrite.recordOffset, src, stage);
+            }
+            imageWrite.recordOffset += take;
+            imageWrite.recordRemaining -= take;
+            if (imageWrite.recordRemaining == 0) {
+                imageWrite.state = IMAGE_WRITE_RECORD_HEADER;
+            }
+        } else {
+            take = 1;
+            imageWrite.crc = crc16_ccitt_update(imageWrite.crc, src, take);
+            imageWrite.field[imageWrite.fieldLength++] = *src;
+            if (!imageWriteField()) {
+                imageWrite.state = IMAGE_WRITE_INVALID;
+            }
+        }
+
+        imageWrite.offset += take;
+        src += take;
+        length -= take;
+    }
+
+    if (imageWrite.state == IMAGE_WRITE_INVALID) {
+        return CONFIG_TRANSFER_ERROR;
+    }
+
+    return imageWrite.state == IMAGE_WRITE_DONE ? CONFIG_TRANSFER_COMPLETE : CONFIG_TRANSFER_MORE;
+}
+#endif // USE_CONFIG_TRANSFER
@@ -0,0 +1,33 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef enum {
+    CONFIG_TRANSFER_ERROR = -1,     // bad offset, structure or CRC, the transfer has to start again from offset 0
+    CONFIG_TRANSFER_MORE = 0,       // data accepted, more expected
+    CONFIG_TRANSFER_COMPLETE = 1,   // image validated and loaded into the parameter groups
+} configTransferResult_e;
+
+uint32_t configTransferImageSize(void);
+int configTransferRead(uint32_t offset, uint8_t *dst, int length);
+configTransferResult_e configTransferWrite(uint32_t offset, const uint8_t *src, int length);
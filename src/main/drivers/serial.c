@@ -123,3 +123,33 @@ void serialEndWrite(serialPort_t *instance)
     if (instance->vTable->endWrite)
         instance->vTable->endWrite(instance);
 }
+
+/*
+ * Returns where the next bytes go in the transmit buffer and sets count to how many fit there before it wraps, or
+ * NULL if the port can not be written in place. Bytes written there are only sent once passed to serialCommitTx(),
+ * nothing else may write to the port in between.
+ */
+uint8_t *serialReserveTx(serialPort_t *instance, int *count)
+{
+    if (!instance->vTable->commitTx) {
+        *count = 0;
+        return NULL;
+    }
+
+    // The tail only moves on as bytes go out, a stale value just makes the space look smaller
+    const uint32_t head = instance->txBufferHead;
+    const uint32_t tail = instance->txBufferTail;
+    if (head >= tail) {
+        // One byte stays free so a full buffer is not mistaken for an empty one
+        *count = instance->txBufferSize - head - (tail == 0 ? 1 : 0);
+    } else {
+        *count = tail - head - 1;
+    }
+
+    return (uint8_t *)&instance->txBuffer[head];
+}
+
+void serialCommitTx(serialPort_t *instance, int count)
+{
+    instance->vTable->commitTx(instance, count);
+}
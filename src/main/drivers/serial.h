@@ -120,6 +120,9 @@ struct serialPortVTable {
     // Optional functions used to buffer large writes.
     void (*beginWrite)(serialPort_t *instance);
     void (*endWrite)(serialPort_t *instance);
+
+    // Optional, sends bytes written directly into the transmit buffer, see serialReserveTx().
+    void (*commitTx)(serialPort_t *instance, int count);
 };
 
 void serialWrite(serialPort_t *instance, uint8_t ch);
@@ -139,3 +142,5 @@ uint32_t serialGetBaudRate(serialPort_t *instance);
 void serialWriteBufShim(void *instance, const uint8_t *data, int count);
 void serialBeginWrite(serialPort_t *instance);
 void serialEndWrite(serialPort_t *instance);
+uint8_t *serialReserveTx(serialPort_t *instance, int *count);
+void serialCommitTx(serialPort_t *instance, int count);
@@ -220,6 +220,18 @@ void tcpWrite(serialPort_t *instance, uint8_t ch)
     tcpDataOut(s);
 }
 
+static void tcpCommitTx(serialPort_t *instance, int count)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    pthread_mutex_lock(&s->txLock);
+
+    const uint32_t head = s->port.txBufferHead + count;
+    s->port.txBufferHead = head >= s->port.txBufferSize ? head - s->port.txBufferSize : head;
+    pthread_mutex_unlock(&s->txLock);
+
+    tcpDataOut(s);
+}
+
 void tcpDataOut(tcpPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
@@ -271,4 +283,5 @@ static const struct serialPortVTable tcpVTable = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .commitTx = tcpCommitTx,
 };
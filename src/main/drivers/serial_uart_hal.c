@@ -355,6 +355,15 @@ uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
+static void uartStartTx(uartPort_t *s)
+{
+    if (s->txDMAStream) {
+        uartTryStartTxDMA(s);
+    } else {
+        __HAL_UART_ENABLE_IT(&s->Handle, UART_IT_TXE);
+    }
+}
+
 void uartWrite(serialPort_t *instance, uint8_t ch)
 {
     uartPort_t *s = (uartPort_t *)instance;
@@ -365,11 +374,16 @@ void uartWrite(serialPort_t *instance, uint8_t ch)
         s->port.txBufferHead++;
     }
 
-    if (s->txDMAStream) {
-        uartTryStartTxDMA(s);
-    } else {
-        __HAL_UART_ENABLE_IT(&s->Handle, UART_IT_TXE);
-    }
+    uartStartTx(s);
+}
+
+static void uartCommitTx(serialPort_t *instance, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    const uint32_t head = s->port.txBufferHead + count;
+    s->port.txBufferHead = head >= s->port.txBufferSize ? head - s->port.txBufferSize : head;
+
+    uartStartTx(s);
 }
 
 const struct serialPortVTable uartVTable[] = {
@@ -386,6 +400,7 @@ const struct serialPortVTable uartVTable[] = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .commitTx = uartCommitTx,
     }
 };
 
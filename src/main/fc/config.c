@@ -28,6 +28,7 @@
 #include "build/debug.h"
 
 #include "config/config_eeprom.h"
+#include "config/config_snapshot.h"
 #include "config/feature.h"
 
 #include "drivers/system.h"
@@ -517,8 +518,11 @@ bool readEEPROM(void)
 
     // Sanity check, read flash
     bool success = loadEEPROM();
+    configSnapshotLoaded();
 
+    configSnapshotReloadStart();
     validateAndFixConfig();
+    configSnapshotReloadEnd();
 
     activateConfig();
 
@@ -529,7 +533,9 @@ bool readEEPROM(void)
 
 void writeEEPROM(void)
 {
+    configSnapshotReloadStart();
     validateAndFixConfig();
+    configSnapshotReloadEnd();
 
     suspendRxPwmPpmSignal();
 
@@ -27,6 +27,7 @@
 #include "common/axis.h"
 
 #include "config/config_reset.h"
+#include "config/config_snapshot.h"
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
 
@@ -86,6 +87,7 @@ void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint
     if ((dstControlRateProfileIndex < CONTROL_RATE_PROFILE_COUNT && srcControlRateProfileIndex < CONTROL_RATE_PROFILE_COUNT)
         && dstControlRateProfileIndex != srcControlRateProfileIndex
     ) {
+        configSnapshotTouch(PG_CONTROL_RATE_PROFILES);
         memcpy(controlRateProfilesMutable(dstControlRateProfileIndex), controlRateProfilesMutable(srcControlRateProfileIndex), sizeof(controlRateConfig_t));
     }
 }
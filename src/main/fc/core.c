@@ -28,12 +28,14 @@
 #include "build/debug.h"
 
 #include "blackbox/blackbox.h"
+#include "blackbox/blackbox_burst.h"
 
 #include "common/axis.h"
 #include "common/filter.h"
 #include "common/maths.h"
 #include "common/utils.h"
 
+#include "config/config_snapshot.h"
 #include "config/feature.h"
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
@@ -84,6 +86,7 @@
 
 #include "flight/position.h"
 #include "flight/failsafe.h"
+#include "flight/gain_schedule.h"
 #include "flight/imu.h"
 #include "flight/mixer.h"
 #include "flight/pid.h"
@@ -801,6 +804,9 @@ bool processRx(timeUs_t currentTimeUs)
 
     if (!cliMode) {
         processRcAdjustments(currentControlRateProfile);
+#ifdef USE_CONFIG_SNAPSHOT
+        configSnapshotUpdate(IS_RC_MODE_ACTIVE(BOXCONFIGSNAPSHOT));
+#endif
     }
 
     bool canUseHorizonMode = true;
@@ -932,6 +938,7 @@ static FAST_CODE void subTaskPidController(timeUs_t currentTimeUs)
 {
     uint32_t startTime = 0;
     if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    gainScheduleUpdate();
     // PID - note this is function pointer set by setPIDController()
     pidController(currentPidProfile, &accelerometerConfig()->accelerometerTrims, currentTimeUs);
     DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
@@ -1045,7 +1052,12 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
 
 static FAST_CODE_NOINLINE void subTaskRcCommand(timeUs_t currentTimeUs)
 {
-    UNUSED(currentTimeUs);
+    // Pick up a freshly received RC frame here rather than waiting for TASK_RX to be scheduled
+    if (rxConfig()->rx_fast_path && rxFastPathUpdate(currentTimeUs)) {
+        rcProcessNewFrame(currentTimeUs, true);
+        DEBUG_SET(DEBUG_RX_TIMING, 0, currentTimeUs - rxGetFrameReadyTimeUs());
+        DEBUG_SET(DEBUG_RX_TIMING, 1, 1);
+    }
 
     // If we're armed, at minimum throttle, and we do arming via the
     // sticks, do not process yaw input from the rx.  We do this so the
@@ -1082,6 +1094,10 @@ FAST_CODE void taskMainPidLoop(timeUs_t currentTimeUs)
     // 2 - subTaskMotorUpdate()
     // 3 - subTaskPidSubprocesses()
     gyroUpdate(currentTimeUs);
+    pidUpdateDtermAtGyroRate();
+#ifdef USE_BLACKBOX_BURST
+    blackboxBurstCapture(currentTimeUs, gyroGetRawADC());
+#endif
     DEBUG_SET(DEBUG_PIDLOOP, 0, micros() - currentTimeUs);
 
     if (pidUpdateCounter++ % pidConfig()->pid_process_denom == 0) {
@@ -150,6 +150,7 @@
 
 #include "flight/failsafe.h"
 #include "flight/imu.h"
+#include "flight/gain_schedule.h"
 #include "flight/mixer.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
@@ -502,6 +503,7 @@ void init(void)
     // so we are ready to call validateAndFixGyroConfig(), pidInit(), and setAccelerationFilter()
     validateAndFixGyroConfig();
     pidInit(currentPidProfile);
+    gainScheduleInit();
     accInitFilters();
 
 #ifdef USE_PID_AUDIO
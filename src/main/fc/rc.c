@@ -148,6 +148,31 @@ float applyRaceFlightRates(const int axis, float rcCommandf, const float rcComma
     return angleRate;
 }
 
+// Rates are odd functions of the stick deflection, so only [0, 1] is tabulated and the sign is
+// restored on lookup. Rebuilt by initRcProcessing() whenever the rate profile changes.
+#define SETPOINT_LOOKUP_LENGTH 64
+static FAST_RAM_ZERO_INIT float setpointLookup[XYZ_AXIS_COUNT][SETPOINT_LOOKUP_LENGTH + 1];
+
+static void initSetpointLookup(void)
+{
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        for (int i = 0; i <= SETPOINT_LOOKUP_LENGTH; i++) {
+            const float rcCommandf = (float)i / SETPOINT_LOOKUP_LENGTH;
+            setpointLookup[axis][i] = applyRates(axis, rcCommandf, rcCommandf);
+        }
+    }
+}
+
+static FAST_CODE float rcLookupSetpoint(int axis, float rcCommandf, const float rcCommandfAbs)
+{
+    const float index = MIN(rcCommandfAbs, 1.0f) * SETPOINT_LOOKUP_LENGTH;
+    const int indexInt = MIN((int)index, SETPOINT_LOOKUP_LENGTH - 1);
+    const float *lookup = setpointLookup[axis];
+    const float angleRate = lookup[indexInt] + (index - indexInt) * (lookup[indexInt + 1] - lookup[indexInt]);
+
+    return rcCommandf < 0 ? -angleRate : angleRate;
+}
+
 static void calculateSetpointRate(int axis)
 {
     float angleRate;
@@ -170,7 +195,7 @@ static void calculateSetpointRate(int axis)
         const float rcCommandfAbs = ABS(rcCommandf);
         rcDeflectionAbs[axis] = rcCommandfAbs;
 
-        angleRate = applyRates(axis, rcCommandf, rcCommandfAbs);
+        angleRate = rcLookupSetpoint(axis, rcCommandf, rcCommandfAbs);
     }
     // Rate limit from profile (deg/sec)
     setpointRate[axis] = constrainf(angleRate, -1.0f * currentControlRateProfile->rate_limit[axis], 1.0f * currentControlRateProfile->rate_limit[axis]);
@@ -320,30 +345,26 @@ FAST_CODE_NOINLINE void rcSmoothingSetFilterCutoffs(rcSmoothingFilter_t *smoothi
         smoothingData->inputCutoffFrequency = calcRcSmoothingCutoff(smoothingData->averageFrameTimeUs, (rxConfig()->rc_smoothing_input_type == RC_SMOOTHING_INPUT_PT1));
     }
 
-    // initialize or update the input filter
+    // initialize or update the input filter, all channels share the same coefficients
     if ((smoothingData->inputCutoffFrequency != oldCutoff) || !smoothingData->filterInitialized) {
-        for (int i = 0; i < PRIMARY_CHANNEL_COUNT; i++) {
-            if ((1 << i) & interpolationChannels) {  // only update channels specified by rc_interp_ch
-                switch (rxConfig()->rc_smoothing_input_type) {
-                
-                    case RC_SMOOTHING_INPUT_PT1:
-                        if (!smoothingData->filterInitialized) {
-                            pt1FilterInit((pt1Filter_t*) &smoothingData->filter[i], pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
-                        } else {
-                            pt1FilterUpdateCutoff((pt1Filter_t*) &smoothingData->filter[i], pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
-                        }
-                        break;
-                        
-                    case RC_SMOOTHING_INPUT_BIQUAD:
-                    default:
-                        if (!smoothingData->filterInitialized) {
-                            biquadFilterInitLPF((biquadFilter_t*) &smoothingData->filter[i], smoothingData->inputCutoffFrequency, targetPidLooptime);
-                        } else {
-                            biquadFilterUpdateLPF((biquadFilter_t*) &smoothingData->filter[i], smoothingData->inputCutoffFrequency, targetPidLooptime);
-                        }
-                        break;
+        switch (rxConfig()->rc_smoothing_input_type) {
+
+            case RC_SMOOTHING_INPUT_PT1:
+                if (!smoothingData->filterInitialized) {
+                    biquadFilterVec4InitPT1(&smoothingData->filter, pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
+                } else {
+                    biquadFilterVec4UpdatePT1(&smoothingData->filter, pt1FilterGain(smoothingData->inputCutoffFrequency, dT));
                 }
-            }
+                break;
+
+            case RC_SMOOTHING_INPUT_BIQUAD:
+            default:
+                if (!smoothingData->filterInitialized) {
+                    biquadFilterVec4InitLPF(&smoothingData->filter, smoothingData->inputCutoffFrequency, targetPidLooptime);
+                } else {
+                    biquadFilterVec4UpdateLPF(&smoothingData->filter, smoothingData->inputCutoffFrequency, targetPidLooptime);
+                }
+                break;
         }
     }
 
@@ -408,10 +429,65 @@ FAST_CODE_NOINLINE bool rcSmoothingAutoCalculate(void)
     return ret;
 }
 
+// Extrapolate each channel along the slope of the last rx frame until the next frame arrives.
+// Unlike interpolation this adds no frame of delay, and the setpoint keeps moving at a constant
+// rate between frames so the feed forward term sees a steady derivative instead of a spike.
+FAST_CODE uint8_t processRcPrediction(void)
+{
+    static FAST_RAM_ZERO_INIT float rcCommandPredict[PRIMARY_CHANNEL_COUNT];
+    static FAST_RAM_ZERO_INIT float rcCommandLastFrame[PRIMARY_CHANNEL_COUNT];
+    static FAST_RAM_ZERO_INIT float rcStepSize[PRIMARY_CHANNEL_COUNT];
+    static FAST_RAM_ZERO_INIT int16_t rcPredictionStepCount;
+    static FAST_RAM_ZERO_INIT bool lastFrameValid;
+
+    uint8_t updatedChannel = 0;
+
+    if (isRXDataNew) {
+        // measured interval between the last two frames, fall back to the protocol rate until one has been seen
+        const uint16_t rxFrameTimeUs = currentRxRefreshRate ? currentRxRefreshRate : rxGetRefreshRate();
+        if (rxIsReceivingSignal() && rcSmoothingRxRateValid(rxFrameTimeUs) && targetPidLooptime > 0) {
+            rcPredictionStepCount = lastFrameValid ? rxFrameTimeUs / targetPidLooptime : 0;
+            lastFrameValid = true;
+        } else {
+            // no slope across a signal loss, start again from the next frame
+            rcPredictionStepCount = 0;
+            lastFrameValid = false;
+        }
+
+        for (int channel = 0; channel < PRIMARY_CHANNEL_COUNT; channel++) {
+            if ((1 << channel) & interpolationChannels) {
+                rcStepSize[channel] = rcPredictionStepCount > 0 ? (rcCommand[channel] - rcCommandLastFrame[channel]) / rcPredictionStepCount : 0;
+                rcCommandLastFrame[channel] = rcCommand[channel];
+                rcCommandPredict[channel] = rcCommand[channel];
+            }
+        }
+    } else if (rcPredictionStepCount > 0) {
+        // never extrapolate further than one frame ahead, a lost frame holds the last prediction
+        rcPredictionStepCount--;
+
+        for (int channel = 0; channel < PRIMARY_CHANNEL_COUNT; channel++) {
+            if ((1 << channel) & interpolationChannels) {
+                rcCommandPredict[channel] += rcStepSize[channel];
+                if (channel == THROTTLE) {
+                    rcCommandPredict[channel] = constrainf(rcCommandPredict[channel], PWM_RANGE_MIN, PWM_RANGE_MAX);
+                } else {
+                    rcCommandPredict[channel] = constrainf(rcCommandPredict[channel], -500.0f, 500.0f);
+                }
+                rcCommand[channel] = rcCommandPredict[channel];
+            }
+        }
+        updatedChannel = interpolationChannels;
+    }
+
+    DEBUG_SET(DEBUG_RC_INTERPOLATION, 2, rcPredictionStepCount);
+
+    return updatedChannel;
+}
+
 FAST_CODE uint8_t processRcSmoothingFilter(void)
 {
     uint8_t updatedChannel = 0;
-    static FAST_RAM_ZERO_INIT float lastRxData[4];
+    static FAST_RAM_ZERO_INIT float lastRxData[PRIMARY_CHANNEL_COUNT];
     static FAST_RAM_ZERO_INIT bool initialized;
     static FAST_RAM_ZERO_INIT timeMs_t validRxFrameTimeMs;
     static FAST_RAM_ZERO_INIT bool calculateCutoffs;
@@ -516,19 +592,14 @@ FAST_CODE uint8_t processRcSmoothingFilter(void)
     }
 
     // each pid loop continue to apply the last received channel value to the filter
+    float smoothedRxData[PRIMARY_CHANNEL_COUNT];
+    if (rcSmoothingData.filterInitialized) {
+        biquadFilterVec4ApplyDF1(&rcSmoothingData.filter, lastRxData, smoothedRxData);
+    }
     for (updatedChannel = 0; updatedChannel < PRIMARY_CHANNEL_COUNT; updatedChannel++) {
         if ((1 << updatedChannel) & interpolationChannels) {  // only smooth selected channels base on the rc_interp_ch value
             if (rcSmoothingData.filterInitialized) {
-                switch (rxConfig()->rc_smoothing_input_type) {
-                    case RC_SMOOTHING_INPUT_PT1:
-                        rcCommand[updatedChannel] = pt1FilterApply((pt1Filter_t*) &rcSmoothingData.filter[updatedChannel], lastRxData[updatedChannel]);
-                        break;
-
-                    case RC_SMOOTHING_INPUT_BIQUAD:
-                    default:
-                        rcCommand[updatedChannel] = biquadFilterApplyDF1((biquadFilter_t*) &rcSmoothingData.filter[updatedChannel], lastRxData[updatedChannel]);
-                        break;
-                }
+                rcCommand[updatedChannel] = smoothedRxData[updatedChannel];
             } else {
                 // If filter isn't initialized yet then use the actual unsmoothed rx channel data
                 rcCommand[updatedChannel] = lastRxData[updatedChannel];
@@ -553,6 +624,9 @@ FAST_CODE void processRcCommand(void)
     case RC_SMOOTHING_TYPE_FILTER:
         updatedChannel = processRcSmoothingFilter();
         break;
+    case RC_SMOOTHING_TYPE_PREDICT:
+        updatedChannel = processRcPrediction();
+        break;
 #endif // USE_RC_SMOOTHING_FILTER
     case RC_SMOOTHING_TYPE_INTERPOLATION:
     default:
@@ -678,6 +752,24 @@ FAST_CODE FAST_CODE_NOINLINE void updateRcCommands(void)
     }
 }
 
+// Called once per received RC frame, either from the RX task or from the PID loop fast path. When failsafe
+// changed the sticks of a frame the fast path already applied, the RX task calls again with newFrame false,
+// which updates the setpoint without counting the frame twice in the refresh rate.
+FAST_CODE_NOINLINE void rcProcessNewFrame(timeUs_t currentTimeUs, bool newFrame)
+{
+    static timeUs_t lastRxTimeUs;
+    if (newFrame) {
+        currentRxRefreshRate = constrain(currentTimeUs - lastRxTimeUs, 1000, 30000);
+        lastRxTimeUs = currentTimeUs;
+
+        DEBUG_SET(DEBUG_RX_TIMING, 2, currentRxRefreshRate);
+    }
+    isRXDataNew = true;
+
+    // updateRcCommands sets rcCommand, which is needed by updateAltHoldState and updateSonarAltHoldState
+    updateRcCommands();
+}
+
 void resetYawAxis(void)
 {
     rcCommand[YAW] = 0;
@@ -714,6 +806,8 @@ void initRcProcessing(void)
         break;
     }
 
+    initSetpointLookup();
+
     interpolationChannels = 0;
     switch (rxConfig()->rcInterpolationChannels) {
     case INTERPOLATION_CHANNELS_RPYT:
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "common/time.h"
+
 typedef enum {
     INTERPOLATION_CHANNELS_RP,
     INTERPOLATION_CHANNELS_RPY,
@@ -36,6 +38,7 @@ float getRcDeflection(int axis);
 float getRcDeflectionAbs(int axis);
 float getThrottlePIDAttenuation(void);
 void updateRcCommands(void);
+void rcProcessNewFrame(timeUs_t currentTimeUs, bool newFrame);
 void resetYawAxis(void);
 void initRcProcessing(void);
 bool isMotorsReversed(void);
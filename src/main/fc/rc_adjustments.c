@@ -37,6 +37,7 @@
 
 #include "drivers/time.h"
 
+#include "config/config_snapshot.h"
 #include "config/feature.h"
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
@@ -338,7 +339,6 @@ static int applyStepAdjustment(controlRateConfig_t *controlRateConfig, uint8_t a
     case ADJUSTMENT_THROTTLE_EXPO:
         newValue = constrain((int)controlRateConfig->thrExpo8 + delta, 0, 100); // FIXME magic numbers repeated in cli.c
         controlRateConfig->thrExpo8 = newValue;
-        initRcProcessing();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_THROTTLE_EXPO, newValue);
         break;
     case ADJUSTMENT_PITCH_ROLL_RATE:
@@ -503,7 +503,6 @@ static int applyAbsoluteAdjustment(controlRateConfig_t *controlRateConfig, adjus
     case ADJUSTMENT_THROTTLE_EXPO:
         newValue = constrain(value, 0, 100); // FIXME magic numbers repeated in cli.c
         controlRateConfig->thrExpo8 = newValue;
-        initRcProcessing();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_THROTTLE_EXPO, newValue);
         break;
     case ADJUSTMENT_PITCH_ROLL_RATE:
@@ -705,6 +704,14 @@ static void updateAdjustmentStates(void)
 
 #define RESET_FREQUENCY_2HZ (1000 / 2)
 
+// Rebuilding the rate lookup tables is expensive, so only do it when an adjustment really changed the rate profile
+static void updateRcProcessing(const controlRateConfig_t *previousRates, const controlRateConfig_t *controlRateConfig)
+{
+    if (memcmp(previousRates, controlRateConfig, sizeof(*controlRateConfig)) != 0) {
+        initRcProcessing();
+    }
+}
+
 void processRcAdjustments(controlRateConfig_t *controlRateConfig)
 {
     const uint32_t now = millis();
@@ -763,8 +770,12 @@ void processRcAdjustments(controlRateConfig_t *controlRateConfig)
                 continue;
             }
 
+            configSnapshotTouch(PG_PID_PROFILE);
+            configSnapshotTouch(PG_CONTROL_RATE_PROFILES);
+            const controlRateConfig_t previousRates = *controlRateConfig;
             newValue = applyStepAdjustment(controlRateConfig, adjustmentFunction, delta);
             pidInitConfig(pidProfile);
+            updateRcProcessing(&previousRates, controlRateConfig);
         } else if (adjustmentState->config->mode == ADJUSTMENT_MODE_SELECT) {
             int switchPositions = adjustmentState->config->data.switchPositions;
             if (adjustmentFunction == ADJUSTMENT_RATE_PROFILE && systemConfig()->rateProfile6PosSwitch) {
@@ -802,8 +813,12 @@ void processRcAdjustments(controlRateConfig_t *controlRateConfig)
             int value = (((rcData[channelIndex] - PWM_RANGE_MIDDLE) * adjustmentRange->adjustmentScale) / (PWM_RANGE_MIDDLE - PWM_RANGE_MIN)) + adjustmentRange->adjustmentCenter;
 
             lastRcData[index] = rcData[channelIndex];
+            configSnapshotTouch(PG_PID_PROFILE);
+            configSnapshotTouch(PG_CONTROL_RATE_PROFILES);
+            const controlRateConfig_t previousRates = *controlRateConfig;
             applyAbsoluteAdjustment(controlRateConfig, adjustmentConfig->adjustmentFunction, value);
             pidInitConfig(pidProfile);
+            updateRcProcessing(&previousRates, controlRateConfig);
         }
     }
 }
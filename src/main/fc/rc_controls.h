@@ -63,7 +63,8 @@ typedef enum {
 
 typedef enum {
     RC_SMOOTHING_TYPE_INTERPOLATION,
-    RC_SMOOTHING_TYPE_FILTER
+    RC_SMOOTHING_TYPE_FILTER,
+    RC_SMOOTHING_TYPE_PREDICT
 } rcSmoothingType_e;
 
 typedef enum {
@@ -117,14 +118,9 @@ typedef struct rcSmoothingFilterTraining_s {
     uint16_t max;
 } rcSmoothingFilterTraining_t;
 
-typedef union rcSmoothingFilterTypes_u {
-    pt1Filter_t pt1Filter;
-    biquadFilter_t biquadFilter;
-} rcSmoothingFilterTypes_t;
-
 typedef struct rcSmoothingFilter_s {
     bool filterInitialized;
-    rcSmoothingFilterTypes_t filter[4];
+    biquadFilterVec4_t filter;              // RPYT smoothed together, lanes outside rc_interp_ch are ignored
     uint16_t inputCutoffFrequency;
     uint16_t derivativeCutoffFrequency;
     int averageFrameTimeUs;
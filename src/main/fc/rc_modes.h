@@ -74,6 +74,8 @@ typedef enum {
     BOXACROTRAINER,
     BOXVTXCONTROLDISABLE,
     BOXLAUNCHCONTROL,
+    BOXBLACKBOXBURST,
+    BOXCONFIGSNAPSHOT,
     CHECKBOX_ITEM_COUNT
 } boxId_e;
 
@@ -24,6 +24,8 @@
 
 #include "platform.h"
 
+#include "blackbox/blackbox.h"
+
 #include "build/debug.h"
 
 #include "cms/cms.h"
@@ -129,9 +131,8 @@ static void taskHandleSerial(timeUs_t currentTimeUs)
 #endif
 
 #ifdef USE_CLI
-    // in cli mode, all serial stuff goes to here. enter cli mode by sending #
+    // in cli mode, all serial stuff goes to the CLI task. enter cli mode by sending #
     if (cliMode) {
-        cliProcess();
         return;
     }
 #endif
@@ -139,6 +140,15 @@ static void taskHandleSerial(timeUs_t currentTimeUs)
     mspSerialProcess(evaluateMspData, mspFcProcessCommand, mspFcProcessReply);
 }
 
+#ifdef USE_CLI
+static void taskCli(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    cliProcess();
+}
+#endif
+
 static void taskBatteryAlerts(timeUs_t currentTimeUs)
 {
     if (!ARMING_FLAG(ARMED)) {
@@ -160,10 +170,13 @@ static void taskUpdateRxMain(timeUs_t currentTimeUs)
         return;
     }
 
-    static timeUs_t lastRxTimeUs;
-    currentRxRefreshRate = constrain(currentTimeUs - lastRxTimeUs, 1000, 30000);
-    lastRxTimeUs = currentTimeUs;
-    isRXDataNew = true;
+    // If the PID loop fast path already delivered this frame's sticks, don't process them twice. If failsafe
+    // changed them since, only the setpoint is updated again, the frame was already timed.
+    if (!rxFastPathFrameDelivered()) {
+        rcProcessNewFrame(currentTimeUs, !rxFastPathFrameApplied());
+        DEBUG_SET(DEBUG_RX_TIMING, 0, currentTimeUs - rxGetFrameReadyTimeUs());
+        DEBUG_SET(DEBUG_RX_TIMING, 1, 0);
+    }
 
 #ifdef USE_USB_CDC_HID
     if (!ARMING_FLAG(ARMED)) {
@@ -171,8 +184,6 @@ static void taskUpdateRxMain(timeUs_t currentTimeUs)
     }
 #endif
 
-    // updateRcCommands sets rcCommand, which is needed by updateAltHoldState and updateSonarAltHoldState
-    updateRcCommands();
     updateArmingStatus();
 }
 
@@ -330,6 +341,10 @@ void fcTasksInit(void)
     setTaskEnabled(TASK_PINIOBOX, true);
 #endif
 
+#ifdef USE_BLACKBOX
+    setTaskEnabled(TASK_BLACKBOX, blackboxConfig()->device != BLACKBOX_DEVICE_NONE);
+#endif
+
 #ifdef USE_CMS
 #ifdef USE_MSP_DISPLAYPORT
     setTaskEnabled(TASK_CMS, true);
@@ -462,6 +477,15 @@ cfTask_t cfTasks[TASK_COUNT] = {
     [TASK_PINIOBOX] = DEFINE_TASK("PINIOBOX", NULL, NULL, pinioBoxUpdate, TASK_PERIOD_HZ(20), TASK_PRIORITY_IDLE),
 #endif
 
+#ifdef USE_BLACKBOX
+    [TASK_BLACKBOX] = DEFINE_TASK("BLACKBOX", NULL, blackboxEncodeCheck, blackboxEncode, TASK_PERIOD_HZ(1000), TASK_PRIORITY_MEDIUM),
+#endif
+
+#ifdef USE_CLI
+    // enabled on entering cli mode, dumps are printed a slice per run
+    [TASK_CLI] = DEFINE_TASK("CLI", NULL, NULL, taskCli, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW),
+#endif
+
 #ifdef USE_RANGEFINDER
     [TASK_RANGEFINDER] = DEFINE_TASK("RANGEFINDER", NULL, NULL, rangefinderUpdate, TASK_PERIOD_HZ(10), TASK_PRIORITY_IDLE),
 #endif
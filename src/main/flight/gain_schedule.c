@@ -0,0 +1,136 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "fc/rc_controls.h"
+
+#include "flight/gain_schedule.h"
+
+#include "rx/rx.h"
+
+#include "sensors/battery.h"
+
+PG_REGISTER_WITH_RESET_FN(gainScheduleConfig_t, gainScheduleConfig, PG_GAIN_SCHEDULE_CONFIG, 0);
+
+void pgResetFn_gainScheduleConfig(gainScheduleConfig_t *config)
+{
+    static const uint8_t defaultThrottle[GAIN_SCHEDULE_THROTTLE_POINTS] = { 0, 30, 60, 100 };
+    static const uint8_t defaultCellVoltage[GAIN_SCHEDULE_VBAT_POINTS] = { 33, 37, 42 };
+
+    config->enabled = false;
+    for (int i = 0; i < GAIN_SCHEDULE_THROTTLE_POINTS; i++) {
+        config->throttle[i] = defaultThrottle[i];
+    }
+    for (int i = 0; i < GAIN_SCHEDULE_VBAT_POINTS; i++) {
+        config->cellVoltage[i] = defaultCellVoltage[i];
+    }
+    for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+        for (int i = 0; i < GAIN_SCHEDULE_TABLE_SIZE; i++) {
+            config->gain[term][i] = 100;
+        }
+    }
+}
+
+static FAST_RAM_ZERO_INIT bool gainScheduleEnabled;
+static FAST_RAM_ZERO_INIT float gainScheduleThrottle[GAIN_SCHEDULE_THROTTLE_POINTS];
+static FAST_RAM_ZERO_INIT float gainScheduleCellVoltage[GAIN_SCHEDULE_VBAT_POINTS];
+static FAST_RAM_ZERO_INIT float gainScheduleTable[GAIN_SCHEDULE_TERM_COUNT][GAIN_SCHEDULE_TABLE_SIZE];
+static FAST_RAM_ZERO_INIT float gainScheduleMultiplier[GAIN_SCHEDULE_TERM_COUNT];
+
+// Convert the configuration to floats once so the per loop evaluation is just a lookup and a blend
+void gainScheduleInit(void)
+{
+    gainScheduleEnabled = gainScheduleConfig()->enabled;
+
+    for (int i = 0; i < GAIN_SCHEDULE_THROTTLE_POINTS; i++) {
+        gainScheduleThrottle[i] = gainScheduleConfig()->throttle[i] / 100.0f;
+    }
+    for (int i = 0; i < GAIN_SCHEDULE_VBAT_POINTS; i++) {
+        gainScheduleCellVoltage[i] = gainScheduleConfig()->cellVoltage[i] / 10.0f;
+    }
+    for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+        for (int i = 0; i < GAIN_SCHEDULE_TABLE_SIZE; i++) {
+            gainScheduleTable[term][i] = gainScheduleConfig()->gain[term][i] / 100.0f;
+        }
+        gainScheduleMultiplier[term] = 1.0f;
+    }
+}
+
+// Returns the index of the segment containing value and the position within it, clamped to the end points
+static int gainScheduleFindSegment(const float *points, int count, float value, float *fraction)
+{
+    int index = 0;
+    while (index < count - 2 && value > points[index + 1]) {
+        index++;
+    }
+
+    const float width = points[index + 1] - points[index];
+    *fraction = width > 0.0f ? constrainf((value - points[index]) / width, 0.0f, 1.0f) : 0.0f;
+
+    return index;
+}
+
+float gainScheduleInterpolate(const float *table, const float *throttlePoints, const float *voltagePoints, float throttle, float cellVoltage)
+{
+    float throttleFraction;
+    float voltageFraction;
+    const int column = gainScheduleFindSegment(throttlePoints, GAIN_SCHEDULE_THROTTLE_POINTS, throttle, &throttleFraction);
+    const int row = gainScheduleFindSegment(voltagePoints, GAIN_SCHEDULE_VBAT_POINTS, cellVoltage, &voltageFraction);
+
+    const float *lower = &table[row * GAIN_SCHEDULE_THROTTLE_POINTS + column];
+    const float *upper = lower + GAIN_SCHEDULE_THROTTLE_POINTS;
+
+    const float lowerGain = lower[0] + throttleFraction * (lower[1] - lower[0]);
+    const float upperGain = upper[0] + throttleFraction * (upper[1] - upper[0]);
+
+    return lowerGain + voltageFraction * (upperGain - lowerGain);
+}
+
+// Called once per PID loop, before the per-axis PID calculations
+FAST_CODE void gainScheduleUpdate(void)
+{
+    if (!gainScheduleEnabled) {
+        return;
+    }
+
+    const float throttle = constrainf((rcCommand[THROTTLE] - PWM_RANGE_MIN) / (float)(PWM_RANGE_MAX - PWM_RANGE_MIN), 0.0f, 1.0f);
+
+    // without a battery reading use the top row, which is tuned for a full pack
+    const uint8_t cellCount = getBatteryCellCount();
+    const float cellVoltage = cellCount ? getBatteryVoltage() / (10.0f * cellCount) : gainScheduleCellVoltage[GAIN_SCHEDULE_VBAT_POINTS - 1];
+
+    for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+        gainScheduleMultiplier[term] = gainScheduleInterpolate(gainScheduleTable[term], gainScheduleThrottle, gainScheduleCellVoltage, throttle, cellVoltage);
+    }
+}
+
+float gainScheduleGetMultiplier(gainScheduleTerm_e term)
+{
+    return gainScheduleMultiplier[term];
+}
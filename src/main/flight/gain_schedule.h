@@ -0,0 +1,52 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pg/pg.h"
+
+#define GAIN_SCHEDULE_THROTTLE_POINTS 4
+#define GAIN_SCHEDULE_VBAT_POINTS 3
+#define GAIN_SCHEDULE_TABLE_SIZE (GAIN_SCHEDULE_VBAT_POINTS * GAIN_SCHEDULE_THROTTLE_POINTS)
+
+typedef enum {
+    GAIN_SCHEDULE_P = 0,
+    GAIN_SCHEDULE_I,
+    GAIN_SCHEDULE_D,
+    GAIN_SCHEDULE_F,
+    GAIN_SCHEDULE_TERM_COUNT
+} gainScheduleTerm_e;
+
+typedef struct gainScheduleConfig_s {
+    uint8_t enabled;
+    uint8_t throttle[GAIN_SCHEDULE_THROTTLE_POINTS];        // throttle breakpoints in percent, ascending
+    uint8_t cellVoltage[GAIN_SCHEDULE_VBAT_POINTS];         // average cell voltage breakpoints in 0.1V units, ascending
+    uint8_t gain[GAIN_SCHEDULE_TERM_COUNT][GAIN_SCHEDULE_TABLE_SIZE]; // multiplier in percent, one row of throttle points per cell voltage point
+} gainScheduleConfig_t;
+
+PG_DECLARE(gainScheduleConfig_t, gainScheduleConfig);
+
+void gainScheduleInit(void);
+void gainScheduleUpdate(void);
+float gainScheduleGetMultiplier(gainScheduleTerm_e term);
+float gainScheduleInterpolate(const float *table, const float *throttlePoints, const float *voltagePoints, float throttle, float cellVoltage);
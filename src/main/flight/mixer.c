@@ -58,13 +58,14 @@
 #include "flight/mixer.h"
 #include "flight/mixer_tricopter.h"
 #include "flight/pid.h"
+#include "flight/thrust_linearization.h"
 
 #include "rx/rx.h"
 
 #include "sensors/battery.h"
 #include "sensors/gyro.h"
 
-PG_REGISTER_WITH_RESET_TEMPLATE(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 1);
 
 #define DYN_LPF_THROTTLE_STEPS           100
 #define DYN_LPF_THROTTLE_UPDATE_DELAY_US 5000 // minimum of 5ms between updates
@@ -73,6 +74,7 @@ PG_RESET_TEMPLATE(mixerConfig_t, mixerConfig,
     .mixerMode = DEFAULT_MIXER,
     .yaw_motors_reversed = false,
     .crashflip_motor_percent = 0,
+    .thrust_linear = 0,
 );
 
 PG_REGISTER_WITH_RESET_FN(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 1);
@@ -405,11 +407,14 @@ void initEscEndpoints(void)
     rcCommandThrottleRange = PWM_RANGE_MAX - rxConfig()->mincheck;
 }
 
+static FAST_RAM_ZERO_INIT thrustLinearizationLut_t thrustLinearizationLut;
+
 void mixerInit(mixerMode_e mixerMode)
 {
     currentMixerMode = mixerMode;
 
     initEscEndpoints();
+    thrustLinearizationLutInit(&thrustLinearizationLut, mixerConfig()->thrust_linear);
 #ifdef USE_SERVOS
     if (mixerIsTricopter()) {
         mixerTricopterInit();
@@ -725,8 +730,13 @@ static void applyMixToMotors(float motorMix[MAX_SUPPORTED_MOTORS], motorMixer_t
 {
     // Now add in the desired throttle, but keep in a range that doesn't clip adjusted
     // roll/pitch/yaw. This could move throttle down, but also up for those low throttle flips.
+    const bool linearizeThrust = thrustLinearizationLut.enabled;
     for (int i = 0; i < motorCount; i++) {
-        float motorOutput = motorOutputMin + (motorOutputRange * (motorOutputMixSign * motorMix[i] + throttle * activeMixer[i].throttle));
+        float motorOutputNormalised = motorOutputMixSign * motorMix[i] + throttle * activeMixer[i].throttle;
+        if (linearizeThrust) {
+            motorOutputNormalised = thrustLinearizationLutApply(&thrustLinearizationLut, motorOutputNormalised);
+        }
+        float motorOutput = motorOutputMin + motorOutputRange * motorOutputNormalised;
 #ifdef USE_SERVOS
         if (mixerIsTricopter()) {
             motorOutput += mixerTricopterMotorCorrection(i);
@@ -90,6 +90,7 @@ typedef struct mixerConfig_s {
     uint8_t mixerMode;
     bool yaw_motors_reversed;
     uint8_t crashflip_motor_percent;
+    uint8_t thrust_linear;              // percentage of the motor thrust curve that follows the square law, 0 = no linearisation
 } mixerConfig_t;
 
 PG_DECLARE(mixerConfig_t, mixerConfig);
@@ -33,6 +33,7 @@
 #include "common/filter.h"
 
 #include "config/config_reset.h"
+#include "config/config_snapshot.h"
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
 
@@ -47,6 +48,7 @@
 #include "fc/runtime_config.h"
 
 #include "flight/pid.h"
+#include "flight/gain_schedule.h"
 #include "flight/imu.h"
 #include "flight/gps_rescue.h"
 #include "flight/mixer.h"
@@ -80,7 +82,7 @@ static FAST_RAM_ZERO_INIT uint16_t itermAcceleratorGain;
 static FAST_RAM float antiGravityOsdCutoff = 1.0f;
 static FAST_RAM_ZERO_INIT bool antiGravityEnabled;
 
-PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 2);
+PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 3);
 
 #ifdef STM32F10X
 #define PID_PROCESS_DENOM_DEFAULT       1
@@ -95,11 +97,13 @@ PG_RESET_TEMPLATE(pidConfig_t, pidConfig,
     .pid_process_denom = PID_PROCESS_DENOM_DEFAULT,
     .runaway_takeoff_prevention = true,
     .runaway_takeoff_deactivate_throttle = 20,  // throttle level % needed to accumulate deactivation time
-    .runaway_takeoff_deactivate_delay = 500     // Accumulated time (in milliseconds) before deactivation in successful takeoff
+    .runaway_takeoff_deactivate_delay = 500,    // Accumulated time (in milliseconds) before deactivation in successful takeoff
+    .dterm_gyro_rate = false,
 );
 #else
 PG_RESET_TEMPLATE(pidConfig_t, pidConfig,
-    .pid_process_denom = PID_PROCESS_DENOM_DEFAULT
+    .pid_process_denom = PID_PROCESS_DENOM_DEFAULT,
+    .dterm_gyro_rate = false,
 );
 #endif
 
@@ -231,6 +235,13 @@ static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermLowpassApplyFn;
 static FAST_RAM_ZERO_INIT dtermLowpass_t dtermLowpass[XYZ_AXIS_COUNT];
 static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermLowpass2ApplyFn;
 static FAST_RAM_ZERO_INIT dtermLowpass_t dtermLowpass2[XYZ_AXIS_COUNT];
+// The D-term filters run either in the PID loop or, with dterm_gyro_rate, for every gyro sample
+static FAST_RAM_ZERO_INIT bool dtermAtGyroRate;
+static FAST_RAM_ZERO_INIT uint32_t dtermLooptime;
+static FAST_RAM_ZERO_INIT float dtermDt;
+static FAST_RAM_ZERO_INIT float dtermPreviousGyroRate[XYZ_AXIS_COUNT];
+static FAST_RAM_ZERO_INIT float dtermDerivativeSum[XYZ_AXIS_COUNT];
+static FAST_RAM_ZERO_INIT uint8_t dtermDerivativeCount;
 static FAST_RAM_ZERO_INIT filterApplyFnPtr ptermYawLowpassApplyFn;
 static FAST_RAM_ZERO_INIT pt1Filter_t ptermYawLowpass;
 #if defined(USE_ITERM_RELAX)
@@ -264,12 +275,21 @@ void pidInitFilters(const pidProfile_t *pidProfile)
 
     const uint32_t pidFrequencyNyquist = pidFrequency / 2; // No rounding needed
 
+    dtermAtGyroRate = pidConfig()->dterm_gyro_rate && pidConfig()->pid_process_denom > 1 && gyro.targetLooptime > 0;
+    dtermLooptime = dtermAtGyroRate ? gyro.targetLooptime : targetPidLooptime;
+    dtermDt = dtermLooptime * 1e-6f;
+    const uint32_t dtermFrequencyNyquist = 0.5f / dtermDt;
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        dtermDerivativeSum[axis] = 0.0f;
+    }
+    dtermDerivativeCount = 0;
+
     uint16_t dTermNotchHz;
-    if (pidProfile->dterm_notch_hz <= pidFrequencyNyquist) {
+    if (pidProfile->dterm_notch_hz <= dtermFrequencyNyquist) {
         dTermNotchHz = pidProfile->dterm_notch_hz;
     } else {
-        if (pidProfile->dterm_notch_cutoff < pidFrequencyNyquist) {
-            dTermNotchHz = pidFrequencyNyquist;
+        if (pidProfile->dterm_notch_cutoff < dtermFrequencyNyquist) {
+            dTermNotchHz = dtermFrequencyNyquist;
         } else {
             dTermNotchHz = 0;
         }
@@ -279,21 +299,21 @@ void pidInitFilters(const pidProfile_t *pidProfile)
         dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(dTermNotchHz, pidProfile->dterm_notch_cutoff);
         for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-            biquadFilterInit(&dtermNotch[axis], dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
+            biquadFilterInit(&dtermNotch[axis], dTermNotchHz, dtermLooptime, notchQ, FILTER_NOTCH);
         }
     } else {
         dtermNotchApplyFn = nullFilterApply;
     }
 
     //1st Dterm Lowpass Filter
-    if (pidProfile->dterm_lowpass_hz == 0 || pidProfile->dterm_lowpass_hz > pidFrequencyNyquist) {
+    if (pidProfile->dterm_lowpass_hz == 0 || pidProfile->dterm_lowpass_hz > dtermFrequencyNyquist) {
         dtermLowpassApplyFn = nullFilterApply;
     } else {
         switch (pidProfile->dterm_filter_type) {
         case FILTER_PT1:
             dtermLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                pt1FilterInit(&dtermLowpass[axis].pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass_hz, dT));
+                pt1FilterInit(&dtermLowpass[axis].pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass_hz, dtermDt));
             }
             break;
         case FILTER_BIQUAD:
@@ -303,7 +323,7 @@ void pidInitFilters(const pidProfile_t *pidProfile)
             dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApply;
 #endif
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                biquadFilterInitLPF(&dtermLowpass[axis].biquadFilter, pidProfile->dterm_lowpass_hz, targetPidLooptime);
+                biquadFilterInitLPF(&dtermLowpass[axis].biquadFilter, pidProfile->dterm_lowpass_hz, dtermLooptime);
             }
             break;
         default:
@@ -313,20 +333,20 @@ void pidInitFilters(const pidProfile_t *pidProfile)
     }
 
     //2nd Dterm Lowpass Filter
-    if (pidProfile->dterm_lowpass2_hz == 0 || pidProfile->dterm_lowpass2_hz > pidFrequencyNyquist) {
+    if (pidProfile->dterm_lowpass2_hz == 0 || pidProfile->dterm_lowpass2_hz > dtermFrequencyNyquist) {
     	dtermLowpass2ApplyFn = nullFilterApply;
     } else {
         switch (pidProfile->dterm_filter2_type) {
         case FILTER_PT1:
             dtermLowpass2ApplyFn = (filterApplyFnPtr)pt1FilterApply;
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                pt1FilterInit(&dtermLowpass2[axis].pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass2_hz, dT));
+                pt1FilterInit(&dtermLowpass2[axis].pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass2_hz, dtermDt));
             }
             break;
         case FILTER_BIQUAD:
             dtermLowpass2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                biquadFilterInitLPF(&dtermLowpass2[axis].biquadFilter, pidProfile->dterm_lowpass2_hz, targetPidLooptime);
+                biquadFilterInitLPF(&dtermLowpass2[axis].biquadFilter, pidProfile->dterm_lowpass2_hz, dtermLooptime);
             }
             break;
         default:
@@ -601,6 +621,7 @@ void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex)
     if ((dstPidProfileIndex < MAX_PROFILE_COUNT-1 && srcPidProfileIndex < MAX_PROFILE_COUNT-1)
         && dstPidProfileIndex != srcPidProfileIndex
     ) {
+        configSnapshotTouch(PG_PID_PROFILE);
         memcpy(pidProfilesMutable(dstPidProfileIndex), pidProfilesMutable(srcPidProfileIndex), sizeof(pidProfile_t));
     }
 }
@@ -1040,11 +1061,31 @@ static float applyLaunchControl(int axis, const rollAndPitchTrims_t *angleTrim)
 }
 #endif
 
+// Called for every gyro sample. When the PID loop runs slower than the gyro the D-term filters
+// and the differentiation run here, so the samples between PID loops are not simply discarded.
+FAST_CODE void pidUpdateDtermAtGyroRate(void)
+{
+    if (!dtermAtGyroRate) {
+        return;
+    }
+
+    for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
+        float gyroRateDterm = dtermNotchApplyFn((filter_t *) &dtermNotch[axis], gyro.gyroADCf[axis]);
+        gyroRateDterm = dtermLowpassApplyFn((filter_t *) &dtermLowpass[axis], gyroRateDterm);
+        gyroRateDterm = dtermLowpass2ApplyFn((filter_t *) &dtermLowpass2[axis], gyroRateDterm);
+
+        dtermDerivativeSum[axis] += gyroRateDterm - dtermPreviousGyroRate[axis];
+        dtermPreviousGyroRate[axis] = gyroRateDterm;
+    }
+    if (dtermDerivativeCount < UINT8_MAX) {
+        dtermDerivativeCount++;
+    }
+}
+
 // Betaflight pid controller, which will be maintained in the future with additional features specialised for current (mini) multirotor usage.
 // Based on 2DOF reference design (matlab)
 void FAST_CODE pidController(const pidProfile_t *pidProfile, const rollAndPitchTrims_t *angleTrim, timeUs_t currentTimeUs)
 {
-    static float previousGyroRateDterm[XYZ_AXIS_COUNT];
     static float previousPidSetpoint[XYZ_AXIS_COUNT];
     static timeUs_t levelModeStartTimeUs = 0;
     static bool gpsRescuePreviousState = false;
@@ -1057,6 +1098,12 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, const rollAndPitchT
     const float tpaFactorKp = tpaFactor;
 #endif
 
+    // throttle and battery gain schedule, evaluated once per loop in gainScheduleUpdate()
+    const float scheduleKp = tpaFactorKp * gainScheduleGetMultiplier(GAIN_SCHEDULE_P);
+    const float scheduleKi = gainScheduleGetMultiplier(GAIN_SCHEDULE_I);
+    const float scheduleKd = tpaFactor * gainScheduleGetMultiplier(GAIN_SCHEDULE_D);
+    const float scheduleKf = gainScheduleGetMultiplier(GAIN_SCHEDULE_F);
+
 #ifdef USE_YAW_SPIN_RECOVERY
     const bool yawSpinActive = gyroYawSpinDetected();
 #endif
@@ -1091,12 +1138,30 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, const rollAndPitchT
         dynCi *= constrainf((1.0f - getMotorMixRange()) * itermWindupPointInv, 0.0f, 1.0f);
     }
 
-    // Precalculate gyro deta for D-term here, this allows loop unrolling
-    float gyroRateDterm[XYZ_AXIS_COUNT];
-    for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
-        gyroRateDterm[axis] = dtermNotchApplyFn((filter_t *) &dtermNotch[axis], gyro.gyroADCf[axis]);
-        gyroRateDterm[axis] = dtermLowpassApplyFn((filter_t *) &dtermLowpass[axis], gyroRateDterm[axis]);
-        gyroRateDterm[axis] = dtermLowpass2ApplyFn((filter_t *) &dtermLowpass2[axis], gyroRateDterm[axis]);
+    // Precalculate gyro delta for D-term here, this allows loop unrolling
+    // Divide rate change by dT to get differential (ie dr/dt).
+    // dT is fixed and calculated from the target PID loop time
+    // This is done to avoid DTerm spikes that occur with dynamically
+    // calculated deltaT whenever another task causes the PID
+    // loop execution to be delayed.
+    float dtermDelta[XYZ_AXIS_COUNT];
+    if (dtermAtGyroRate) {
+        // filtered and differentiated for every gyro sample, just take the mean since the last loop
+        const float dtermScale = dtermDerivativeCount ? 1.0f / (dtermDerivativeCount * dtermDt) : 0.0f;
+        for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
+            dtermDelta[axis] = -dtermDerivativeSum[axis] * dtermScale;
+            dtermDerivativeSum[axis] = 0.0f;
+        }
+        dtermDerivativeCount = 0;
+    } else {
+        for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
+            float gyroRateDterm = dtermNotchApplyFn((filter_t *) &dtermNotch[axis], gyro.gyroADCf[axis]);
+            gyroRateDterm = dtermLowpassApplyFn((filter_t *) &dtermLowpass[axis], gyroRateDterm);
+            gyroRateDterm = dtermLowpass2ApplyFn((filter_t *) &dtermLowpass2[axis], gyroRateDterm);
+
+            dtermDelta[axis] = -(gyroRateDterm - dtermPreviousGyroRate[axis]) * pidFrequency;
+            dtermPreviousGyroRate[axis] = gyroRateDterm;
+        }
     }
 
     rotateItermAndAxisError();
@@ -1154,7 +1219,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, const rollAndPitchT
         // b = 1 and only c (feedforward weight) can be tuned (amount derivative on measurement or error).
 
         // -----calculate P component
-        pidData[axis].P = pidCoefficient[axis].Kp * errorRate * tpaFactorKp;
+        pidData[axis].P = pidCoefficient[axis].Kp * errorRate * scheduleKp;
         if (axis == FD_YAW) {
             pidData[axis].P = ptermYawLowpassApplyFn((filter_t *) &ptermYawLowpass, pidData[axis].P);
         }
@@ -1162,9 +1227,9 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, const rollAndPitchT
         // -----calculate I component
 #ifdef USE_LAUNCH_CONTROL
         // if launch control is active override the iterm gains
-        const float Ki = launchControlActive ? launchControlKi : pidCoefficient[axis].Ki;
+        const float Ki = (launchControlActive ? launchControlKi : pidCoefficient[axis].Ki) * scheduleKi;
 #else
-        const float Ki = pidCoefficient[axis].Ki;
+        const float Ki = pidCoefficient[axis].Ki * scheduleKi;
 #endif
         pidData[axis].I = constrainf(iterm + Ki * itermErrorRate * dynCi, -itermLimit, itermLimit);
 
@@ -1172,28 +1237,21 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, const rollAndPitchT
         // disable D if launch control is active
         if ((pidCoefficient[axis].Kd > 0) && !launchControlActive){
 
-            // Divide rate change by dT to get differential (ie dr/dt).
-            // dT is fixed and calculated from the target PID loop time
-            // This is done to avoid DTerm spikes that occur with dynamically
-            // calculated deltaT whenever another task causes the PID
-            // loop execution to be delayed.
-            const float delta =
-                - (gyroRateDterm[axis] - previousGyroRateDterm[axis]) * pidFrequency;
+            const float delta = dtermDelta[axis];
 
             if (cmpTimeUs(currentTimeUs, levelModeStartTimeUs) > CRASH_RECOVERY_DETECTION_DELAY_US) {
                 detectAndSetCrashRecovery(pidProfile->crash_recovery, axis, currentTimeUs, delta, errorRate);
             }
 
-            pidData[axis].D = pidCoefficient[axis].Kd * delta * tpaFactor;
+            pidData[axis].D = pidCoefficient[axis].Kd * delta * scheduleKd;
         } else {
             pidData[axis].D = 0;
         }
-        previousGyroRateDterm[axis] = gyroRateDterm[axis];
 
         // -----calculate feedforward component
         
         // Only enable feedforward for rate mode and if launch control is inactive
-        const float feedforwardGain = (flightModeFlags || launchControlActive) ? 0.0f : pidCoefficient[axis].Kf;
+        const float feedforwardGain = (flightModeFlags || launchControlActive) ? 0.0f : pidCoefficient[axis].Kf * scheduleKf;
         
         if (feedforwardGain > 0) {
 
@@ -1307,11 +1365,11 @@ void dynLpfDTermUpdate(float throttle)
 
          if (dynLpfFilter == DYN_LPF_PT1) {
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt1FilterUpdateCutoff(&dtermLowpass[axis].pt1Filter, pt1FilterGain(cutoffFreq, dT));
+                pt1FilterUpdateCutoff(&dtermLowpass[axis].pt1Filter, pt1FilterGain(cutoffFreq, dtermDt));
             }
         } else {
             for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterUpdateLPF(&dtermLowpass[axis].biquadFilter, cutoffFreq, targetPidLooptime);
+                biquadFilterUpdateLPF(&dtermLowpass[axis].biquadFilter, cutoffFreq, dtermLooptime);
             }
         }
     }
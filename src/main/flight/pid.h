@@ -165,12 +165,14 @@ typedef struct pidConfig_s {
     uint8_t runaway_takeoff_prevention;          // off, on - enables pidsum runaway disarm logic
     uint16_t runaway_takeoff_deactivate_delay;   // delay in ms for "in-flight" conditions before deactivation (successful flight)
     uint8_t runaway_takeoff_deactivate_throttle; // minimum throttle percent required during deactivation phase
+    uint8_t dterm_gyro_rate;                     // off, on - run D-term filtering and differentiation at gyro rate when pid_process_denom > 1
 } pidConfig_t;
 
 PG_DECLARE(pidConfig_t, pidConfig);
 
 union rollAndPitchTrims_u;
 void pidController(const pidProfile_t *pidProfile, const union rollAndPitchTrims_u *angleTrim, timeUs_t currentTimeUs);
+void pidUpdateDtermAtGyroRate(void);
 
 typedef struct pidAxisData_s {
     float P;
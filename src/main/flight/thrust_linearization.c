@@ -0,0 +1,69 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "flight/thrust_linearization.h"
+
+// Thrust is modelled as T(u) = (1 - a) * u + a * u^2 for a normalised motor command u, where
+// a = thrust_linear / 100 sets how strongly the props follow the square law. The table holds the
+// command needed for each evenly spaced thrust step, so the mixer only has to interpolate.
+static float thrustCurveInverse(float thrust, float a)
+{
+    if (a <= 0.0f) {
+        return thrust;
+    }
+    const float b = 1.0f - a;
+    return (sqrtf(b * b + 4.0f * a * thrust) - b) / (2.0f * a);
+}
+
+void thrustLinearizationLutInit(thrustLinearizationLut_t *lut, uint8_t thrustLinearPercent)
+{
+    const float a = MIN(thrustLinearPercent, 100) / 100.0f;
+
+    lut->enabled = thrustLinearPercent > 0;
+    for (int i = 0; i <= THRUST_LINEARIZATION_LUT_SEGMENTS; i++) {
+        lut->motorOutput[i] = thrustCurveInverse((float)i / THRUST_LINEARIZATION_LUT_SEGMENTS, a);
+    }
+    // pin the end points so the mapped range matches the unmapped one exactly
+    lut->motorOutput[0] = 0.0f;
+    lut->motorOutput[THRUST_LINEARIZATION_LUT_SEGMENTS] = 1.0f;
+}
+
+// Values outside 0..1 are passed through unchanged so that the mixer's clipping and
+// failsafe handling of out of range outputs is not affected.
+FAST_CODE float thrustLinearizationLutApply(const thrustLinearizationLut_t *lut, float thrust)
+{
+    if (thrust <= 0.0f || thrust >= 1.0f) {
+        return thrust;
+    }
+
+    const float position = thrust * THRUST_LINEARIZATION_LUT_SEGMENTS;
+    const int index = MIN((int)position, THRUST_LINEARIZATION_LUT_SEGMENTS - 1);
+    const float fraction = position - index;
+
+    return lut->motorOutput[index] + fraction * (lut->motorOutput[index + 1] - lut->motorOutput[index]);
+}
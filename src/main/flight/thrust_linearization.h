@@ -0,0 +1,35 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define THRUST_LINEARIZATION_LUT_SEGMENTS 32
+
+// Piecewise-linear inverse of the motor thrust curve, indexed by normalised thrust (0..1)
+typedef struct thrustLinearizationLut_s {
+    bool enabled;
+    float motorOutput[THRUST_LINEARIZATION_LUT_SEGMENTS + 1];
+} thrustLinearizationLut_t;
+
+void thrustLinearizationLutInit(thrustLinearizationLut_t *lut, uint8_t thrustLinearPercent);
+float thrustLinearizationLutApply(const thrustLinearizationLut_t *lut, float thrust);
@@ -48,6 +48,8 @@ extern uint8_t __config_end;
 
 #include "common/axis.h"
 #include "common/color.h"
+#include "common/crc.h"
+#include "common/lzss.h"
 #include "common/maths.h"
 #include "common/printf.h"
 #include "common/strtol.h"
@@ -56,6 +58,7 @@ extern uint8_t __config_end;
 #include "common/utils.h"
 
 #include "config/config_eeprom.h"
+#include "config/config_snapshot.h"
 #include "config/feature.h"
 
 #include "drivers/accgyro/accgyro.h"
@@ -110,6 +113,7 @@ extern uint8_t __config_end;
 #include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
 #include "io/flashfs.h"
+#include "io/flashfs_log.h"
 #include "io/gimbal.h"
 #include "io/gps.h"
 #include "io/ledstrip.h"
@@ -170,6 +174,12 @@ static serialPort_t *cliPort;
 
 static bufWriter_t *cliWriter;
 static uint8_t cliWriteBuffer[sizeof(*cliWriter) + CLI_OUT_BUFFER_SIZE];
+static uint32_t cliWriteCount;  // bytes handed to the port, paces dump output
+
+// Kept free in the TX buffer at the end of each slice of dump output, about one row: a line and its default
+#define CLI_DUMP_ROW_SIZE 128U
+// Longest a slice of dump output may hold up the scheduler for
+#define CLI_DUMP_SLICE_US 200
 
 static char cliBuffer[CLI_IN_BUFFER_SIZE];
 static uint32_t bufferIndex = 0;
@@ -272,6 +282,125 @@ static void backupAndResetConfigs(void)
     resetConfigs();
 }
 
+#ifdef USE_CLI_COMPRESSION
+/*
+ * 'dump' and 'diff' with the 'compressed' option send their output LZSS coded, in frames of
+ *
+ *   CLI_FRAME_MARKER, flags, length, length bytes of LZSS blocks, CRC8 DVB-S2 of flags to the end of the payload
+ *
+ * A host can send CLI input the same way, to restore a backup in a fraction of the time. Input in frames is not
+ * echoed and gets no prompts. What the commands print goes back in frames too, with a CLI_FRAME_SYNC frame once an
+ * input frame has been dealt with, which is when the host can send the next one. The decoder takes the encoder's
+ * RAM, so that output is sent as it is in CLI_FRAME_STORED frames.
+ */
+#define CLI_FRAME_MARKER 0x02 // STX
+#define CLI_FRAME_START (1 << 0) // first frame of a stream, resets the history
+#define CLI_FRAME_END (1 << 1) // last frame of a stream
+#define CLI_FRAME_SYNC (1 << 2) // the input received so far has been dealt with
+#define CLI_FRAME_STORED (1 << 3) // the payload is plain text rather than LZSS blocks
+
+typedef enum {
+    CLI_FRAME_IDLE = 0,
+    CLI_FRAME_FLAGS,
+    CLI_FRAME_LENGTH,
+    CLI_FRAME_PAYLOAD,
+    CLI_FRAME_CRC,
+    CLI_FRAME_DECODING
+} cliFrameState_e;
+
+static struct {
+    bool encoding;              // output goes out in frames
+    bool decoding;              // input arrives in frames
+    uint8_t outputFlags;        // of the next frame out
+    cliFrameState_e inputState;
+    uint8_t inputFlags;
+    uint8_t inputLength;
+    uint8_t inputIndex;
+    // Input frames are only read while no dump is being encoded, and the output while decoding is stored
+    union {
+        lzssEncoder_t encoder;
+        struct {
+            lzssDecoder_t decoder;
+            uint8_t input[LZSS_BLOCK_SIZE];
+        };
+    };
+} cliCompression;
+
+static void cliWriteFrame(void *arg, const uint8_t *data, int count)
+{
+    UNUSED(arg);
+
+    const uint8_t header[] = { CLI_FRAME_MARKER, cliCompression.outputFlags, count };
+    uint8_t crc = crc8_dvb_s2_update(0, header + 1, sizeof(header) - 1);
+    crc = crc8_dvb_s2_update(crc, data, count);
+
+    serialWriteBuf(cliPort, header, sizeof(header));
+    serialWriteBuf(cliPort, data, count);
+    serialWriteBuf(cliPort, &crc, sizeof(crc));
+    cliWriteCount += sizeof(header) + count + sizeof(crc);
+
+    cliCompression.outputFlags = 0;
+}
+
+static void cliWriteStored(const uint8_t *data, int count)
+{
+    while (count > 0) {
+        const int length = MIN(count, LZSS_BLOCK_SIZE);
+        cliCompression.outputFlags |= CLI_FRAME_STORED;
+        cliWriteFrame(NULL, data, length);
+        data += length;
+        count -= length;
+    }
+}
+
+static void cliCompressionStart(void)
+{
+    if (!cliCompression.encoding) {
+        bufWriterFlush(cliWriter);
+        if (!cliCompression.decoding) {
+            lzssEncoderInit(&cliCompression.encoder, cliWriteFrame, NULL);
+        }
+        cliCompression.outputFlags = CLI_FRAME_START;
+        cliCompression.encoding = true;
+    }
+}
+
+// Send everything printed so far, followed by an empty frame with the given flags
+static void cliCompressionFlush(uint8_t flags)
+{
+    bufWriterFlush(cliWriter);
+    if (!cliCompression.decoding) {
+        lzssEncoderFlush(&cliCompression.encoder);
+    }
+    cliCompression.outputFlags |= flags;
+    cliWriteFrame(NULL, NULL, 0);
+}
+
+static void cliCompressionEnd(void)
+{
+    cliCompressionFlush(CLI_FRAME_END | CLI_FRAME_SYNC);
+    cliCompression.encoding = false;
+    cliCompression.decoding = false;
+    cliCompression.inputState = CLI_FRAME_IDLE;
+}
+#endif
+
+static void cliWriteBufShim(void *arg, void *data, int count)
+{
+#ifdef USE_CLI_COMPRESSION
+    if (cliCompression.encoding && cliCompression.decoding) {
+        cliWriteStored(data, count);
+        return;
+    }
+    if (cliCompression.encoding) {
+        lzssEncoderAppend(&cliCompression.encoder, data, count);
+        return;
+    }
+#endif
+    cliWriteCount += count;
+    serialWriteBuf(arg, data, count);
+}
+
 static void cliPrint(const char *str)
 {
     while (*str) {
@@ -316,6 +445,61 @@ typedef enum {
     HIDE_UNUSED = (1 << 6)
 } dumpFlags_e;
 
+typedef enum {
+    DUMP_STATE_IDLE = 0,
+    DUMP_STATE_SECTIONS,
+    DUMP_STATE_MASTER_VALUES,
+    DUMP_STATE_PROFILE,
+    DUMP_STATE_PROFILE_VALUES,
+    DUMP_STATE_RATE_PROFILE,
+    DUMP_STATE_RATE_PROFILE_VALUES
+} dumpState_e;
+
+// The dump or diff in progress, printed a slice at a time by cliProcess() as the port has room for it
+static struct {
+    dumpState_e state;
+    uint8_t dumpMask;
+    uint8_t index;          // next section, or the profile being printed
+    uint16_t row;           // rows of the section printed so far, a slice can stop part way through a section
+    uint16_t valueIndex;    // next entry in valueTable
+    bool slicing;           // a slice is being printed, see cliDumpRow()
+    bool rowStopped;        // the slice ran out of room part way through the section
+    uint32_t sliceWriteCount;
+    uint32_t sliceBytesFree;
+    uint32_t sliceHeadroom;
+    timeUs_t sliceStartUs;
+} configDump;
+
+// True once the slice has written what was free in the TX buffer when it started, or has run for long enough
+static bool cliDumpSliceFull(void)
+{
+    return cliWriteCount - configDump.sliceWriteCount + configDump.sliceHeadroom >= configDump.sliceBytesFree
+        || cmpTimeUs(micros(), configDump.sliceStartUs) >= CLI_DUMP_SLICE_US;
+}
+
+/*
+ * Called by the section printers before each row they print, numbered from 0. False for the rows an earlier slice of
+ * the dump printed, and for the rest of the section once this slice is out of room; the next slice resumes there.
+ * Always true outside a dump, when the printers serve their own commands.
+ */
+static bool cliDumpRow(uint32_t row)
+{
+    if (!configDump.slicing) {
+        return true;
+    }
+    if (configDump.rowStopped || row < configDump.row) {
+        return false;
+    }
+    // a section's header always goes out with its first row, so a resumed section never repeats it
+    if (row > 0 && cliDumpSliceFull()) {
+        configDump.rowStopped = true;
+        return false;
+    }
+
+    configDump.row = row + 1;
+    return true;
+}
+
 static void cliPrintfva(const char *format, va_list va)
 {
     tfp_format(cliWriter, cliPutp, format, va);
@@ -586,17 +770,6 @@ static void dumpPgValue(const clivalue_t *value, uint8_t dumpMask)
     }
 }
 
-static void dumpAllValues(uint16_t valueSection, uint8_t dumpMask)
-{
-    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-        const clivalue_t *value = &valueTable[i];
-        bufWriterFlush(cliWriter);
-        if ((value->type & VALUE_SECTION_MASK) == valueSection) {
-            dumpPgValue(value, dumpMask);
-        }
-    }
-}
-
 static void cliPrintVar(const clivalue_t *var, bool full)
 {
     const void *ptr = cliGetValuePointer(var);
@@ -638,8 +811,10 @@ static void cliPrintVarRange(const clivalue_t *var)
     }
 }
 
-static void cliSetVar(const clivalue_t *var, const uint32_t value)
+void cliSetVar(const clivalue_t *var, const uint32_t value)
 {
+    configSnapshotTouch(var->pgn);
+
     void *ptr = cliGetValuePointer(var);
     uint32_t workValue;
     uint32_t mask;
@@ -765,6 +940,9 @@ static void printRxFailsafe(uint8_t dumpMask, const rxFailsafeChannelConfig_t *r
 {
     // print out rxConfig failsafe settings
     for (uint32_t channel = 0; channel < MAX_SUPPORTED_RC_CHANNEL_COUNT; channel++) {
+        if (!cliDumpRow(channel)) {
+            continue;
+        }
         const rxFailsafeChannelConfig_t *channelFailsafeConfig = &rxFailsafeChannelConfigs[channel];
         const rxFailsafeChannelConfig_t *defaultChannelFailsafeConfig = &defaultRxFailsafeChannelConfigs[channel];
         const bool equalsDefault = !memcmp(channelFailsafeConfig, defaultChannelFailsafeConfig, sizeof(*channelFailsafeConfig));
@@ -882,6 +1060,9 @@ static void printAux(uint8_t dumpMask, const modeActivationCondition_t *modeActi
     const char *format = "aux %u %u %u %u %u %u %u";
     // print out aux channel settings
     for (uint32_t i = 0; i < MAX_MODE_ACTIVATION_CONDITION_COUNT; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const modeActivationCondition_t *mac = &modeActivationConditions[i];
         bool equalsDefault = false;
         if (defaultModeActivationConditions) {
@@ -991,7 +1172,7 @@ static void printSerial(uint8_t dumpMask, const serialConfig_t *serialConfig, co
 {
     const char *format = "serial %d %d %ld %ld %ld %ld";
     for (uint32_t i = 0; i < SERIAL_PORT_COUNT; i++) {
-        if (!serialIsPortAvailable(serialConfig->portConfigs[i].identifier)) {
+        if (!cliDumpRow(i) || !serialIsPortAvailable(serialConfig->portConfigs[i].identifier)) {
             continue;
         };
         bool equalsDefault = false;
@@ -1260,6 +1441,9 @@ static void printAdjustmentRange(uint8_t dumpMask, const adjustmentRange_t *adju
     const char *format = "adjrange %u %u %u %u %u %u %u %u %u";
     // print out adjustment ranges channel settings
     for (uint32_t i = 0; i < MAX_ADJUSTMENT_RANGE_COUNT; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const adjustmentRange_t *ar = &adjustmentRanges[i];
         bool equalsDefault = false;
         if (defaultAdjustmentRanges) {
@@ -1396,6 +1580,9 @@ static void printMotorMix(uint8_t dumpMask, const motorMixer_t *customMotorMixer
     for (uint32_t i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
         if (customMotorMixer[i].throttle == 0.0f)
             break;
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const float thr = customMotorMixer[i].throttle;
         const float roll = customMotorMixer[i].roll;
         const float pitch = customMotorMixer[i].pitch;
@@ -1498,6 +1685,9 @@ static void printRxRange(uint8_t dumpMask, const rxChannelRangeConfig_t *channel
 {
     const char *format = "rxrange %u %u %u";
     for (uint32_t i = 0; i < NON_AUX_CHANNEL_COUNT; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         bool equalsDefault = false;
         if (defaultChannelRangeConfigs) {
             equalsDefault = !memcmp(&channelRangeConfigs[i], &defaultChannelRangeConfigs[i], sizeof(channelRangeConfigs[i]));
@@ -1571,6 +1761,9 @@ static void printLed(uint8_t dumpMask, const ledConfig_t *ledConfigs, const ledC
     char ledConfigBuffer[20];
     char ledConfigDefaultBuffer[20];
     for (uint32_t i = 0; i < LED_MAX_STRIP_LENGTH; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         ledConfig_t ledConfig = ledConfigs[i];
         generateLedConfig(&ledConfig, ledConfigBuffer, sizeof(ledConfigBuffer));
         bool equalsDefault = false;
@@ -1614,6 +1807,9 @@ static void printColor(uint8_t dumpMask, const hsvColor_t *colors, const hsvColo
 {
     const char *format = "color %u %d,%u,%u";
     for (uint32_t i = 0; i < LED_CONFIGURABLE_COLOR_COUNT; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const hsvColor_t *color = &colors[i];
         bool equalsDefault = false;
         if (defaultColors) {
@@ -1650,8 +1846,12 @@ static void cliColor(char *cmdline)
 static void printModeColor(uint8_t dumpMask, const ledStripConfig_t *ledStripConfig, const ledStripConfig_t *defaultLedStripConfig)
 {
     const char *format = "mode_color %u %u %u";
+    uint32_t row = 0;
     for (uint32_t i = 0; i < LED_MODE_COUNT; i++) {
         for (uint32_t j = 0; j < LED_DIRECTION_COUNT; j++) {
+            if (!cliDumpRow(row++)) {
+                continue;
+            }
             int colorIndex = ledStripConfig->modeColors[i].color[j];
             bool equalsDefault = false;
             if (defaultLedStripConfig) {
@@ -1664,6 +1864,9 @@ static void printModeColor(uint8_t dumpMask, const ledStripConfig_t *ledStripCon
     }
 
     for (uint32_t j = 0; j < LED_SPECIAL_COLOR_COUNT; j++) {
+        if (!cliDumpRow(row++)) {
+            continue;
+        }
         const int colorIndex = ledStripConfig->specialColors.color[j];
         bool equalsDefault = false;
         if (defaultLedStripConfig) {
@@ -1674,6 +1877,9 @@ static void printModeColor(uint8_t dumpMask, const ledStripConfig_t *ledStripCon
         cliDumpPrintLinef(dumpMask, equalsDefault, format, LED_SPECIAL, j, colorIndex);
     }
 
+    if (!cliDumpRow(row)) {
+        return;
+    }
     const int ledStripAuxChannel = ledStripConfig->ledstrip_aux_channel;
     bool equalsDefault = false;
     if (defaultLedStripConfig) {
@@ -1723,6 +1929,9 @@ static void printServo(uint8_t dumpMask, const servoParam_t *servoParams, const
     // print out servo settings
     const char *format = "servo %u %d %d %d %d %d";
     for (uint32_t i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const servoParam_t *servoConf = &servoParams[i];
         bool equalsDefault = false;
         if (defaultServoParams) {
@@ -1865,6 +2074,9 @@ static void printServoMix(uint8_t dumpMask, const servoMixer_t *customServoMixer
         if (customServoMixer.rate == 0) {
             break;
         }
+        if (!cliDumpRow(i)) {
+            continue;
+        }
 
         bool equalsDefault = false;
         if (defaultCustomServoMixers) {
@@ -2092,9 +2304,28 @@ static void cliFlashInfo(char *cmdline)
     UNUSED(cmdline);
 
     cliPrintLinef("Flash sectors=%u, sectorSize=%u, pagesPerSector=%u, pageSize=%u, totalSize=%u, usedSize=%u",
-            layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize, flashfsGetOffset());
+            layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize, flashfsGetUsedSize());
+
+#ifdef USE_FLASHFS_LOG
+    for (int i = 0; i < flashfsLogCount(); i++) {
+        const flashfsLog_t *log = flashfsLogGet(i);
+        cliPrintLinef("Log %u: start=%u, size=%u%s", log->sequence, log->start, log->length,
+            log->flags & FLASHFS_LOG_FLAG_RECOVERED ? ", recovered" : "");
+    }
+#endif
 }
 
+#ifdef USE_FLASHFS_LOG
+static void cliFlashDelete(char *cmdline)
+{
+    if (isEmpty(cmdline)) {
+        cliShowParseError();
+    } else if (!flashfsLogDelete(atoi(cmdline))) {
+        cliPrintLine("No such log");
+    }
+}
+#endif
+
 
 static void cliFlashErase(char *cmdline)
 {
@@ -2192,6 +2423,9 @@ static void printVtx(uint8_t dumpMask, const vtxConfig_t *vtxConfig, const vtxCo
     const char *format = "vtx %u %u %u %u %u %u";
     bool equalsDefault = false;
     for (uint32_t i = 0; i < MAX_CHANNEL_ACTIVATION_CONDITION_COUNT; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const vtxChannelActivationCondition_t *cac = &vtxConfig->vtxChannelActivationConditions[i];
         if (vtxConfigDefault) {
             const vtxChannelActivationCondition_t *cacDefault = &vtxConfigDefault->vtxChannelActivationConditions[i];
@@ -2411,15 +2645,16 @@ static void printFeature(uint8_t dumpMask, const featureConfig_t *featureConfig,
 {
     const uint32_t mask = getFeatureMask(featureConfig->enabledFeatures);
     const uint32_t defaultMask = featureConfigDefault->enabledFeatures;
+    uint32_t row = 0;
     for (uint32_t i = 0; featureNames[i]; i++) { // disabled features first
-        if (strcmp(featureNames[i], emptyString) != 0) { //Skip unused
+        if (cliDumpRow(row++) && strcmp(featureNames[i], emptyString) != 0) { //Skip unused
             const char *format = "feature -%s";
             cliDefaultPrintLinef(dumpMask, (defaultMask | ~mask) & (1 << i), format, featureNames[i]);
             cliDumpPrintLinef(dumpMask, (~defaultMask | mask) & (1 << i), format, featureNames[i]);
         }
     }
     for (uint32_t i = 0; featureNames[i]; i++) {  // enabled features
-        if (strcmp(featureNames[i], emptyString) != 0) { //Skip unused
+        if (cliDumpRow(row++) && strcmp(featureNames[i], emptyString) != 0) { //Skip unused
             const char *format = "feature %s";
             if (defaultMask & (1 << i)) {
                 cliDefaultPrintLinef(dumpMask, (~defaultMask | mask) & (1 << i), format, featureNames[i]);
@@ -2510,6 +2745,9 @@ static void printBeeper(uint8_t dumpMask, const uint32_t offFlags, const uint32_
 {
     const uint8_t beeperCount = beeperTableEntryCount();
     for (int32_t i = 0; i < beeperCount - 1; i++) {
+        if (!cliDumpRow(i)) {
+            continue;
+        }
         const char *formatOff = "%s -%s";
         const char *formatOn = "%s %s";
         const uint32_t beeperModeMask = beeperModeMaskForTableIndex(i);
@@ -2706,6 +2944,11 @@ static char *checkCommand(char *cmdLine, const char *command)
 
 static void cliRebootEx(bool bootLoader)
 {
+#ifdef USE_CLI_COMPRESSION
+    if (cliCompression.encoding) {
+        cliCompressionEnd();
+    }
+#endif
     cliPrint("\r\nRebooting");
     bufWriterFlush(cliWriter);
     waitForSerialPortToFinishTransmitting(cliPort);
@@ -3270,40 +3513,6 @@ static void cliRateProfile(char *cmdline)
     }
 }
 
-static void cliDumpPidProfile(uint8_t pidProfileIndex, uint8_t dumpMask)
-{
-    if (pidProfileIndex >= MAX_PROFILE_COUNT) {
-        // Faulty values
-        return;
-    }
-
-    pidProfileIndexToUse = pidProfileIndex;
-
-    cliPrintHashLine("profile");
-    cliProfile("");
-    cliPrintLinefeed();
-    dumpAllValues(PROFILE_VALUE, dumpMask);
-
-    pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
-}
-
-static void cliDumpRateProfile(uint8_t rateProfileIndex, uint8_t dumpMask)
-{
-    if (rateProfileIndex >= CONTROL_RATE_PROFILE_COUNT) {
-        // Faulty values
-        return;
-    }
-
-    rateProfileIndexToUse = rateProfileIndex;
-
-    cliPrintHashLine("rateprofile");
-    cliRateProfile("");
-    cliPrintLinefeed();
-    dumpAllValues(PROFILE_RATE_VALUE, dumpMask);
-
-    rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
-}
-
 static void cliSave(char *cmdline)
 {
     UNUSED(cmdline);
@@ -3448,12 +3657,10 @@ STATIC_UNIT_TESTED void cliSet(char *cmdline)
         eqptr++;
         eqptr = skipSpace(eqptr);
 
-        for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-            const clivalue_t *val = &valueTable[i];
-
-            // ensure exact match when setting to prevent setting variables with shorter names
-            if (strncasecmp(cmdline, val->name, strlen(val->name)) == 0 && variableNameLength == strlen(val->name)) {
+        {
+            const clivalue_t *val = settingGetByName(cmdline, variableNameLength);
 
+            if (val) {
                 bool valueChanged = false;
                 int16_t value  = 0;
                 switch (val->type & VALUE_MODE_MASK) {
@@ -3504,6 +3711,8 @@ STATIC_UNIT_TESTED void cliSet(char *cmdline)
                         const uint8_t arrayLength = val->config.array.length;
                         char *valPtr = eqptr;
 
+                        configSnapshotTouch(val->pgn);
+
                         int i = 0;
                         while (i < arrayLength && valPtr != NULL) {
                             // skip spaces
@@ -3584,6 +3793,65 @@ STATIC_UNIT_TESTED void cliSet(char *cmdline)
     }
 }
 
+#ifdef USE_CONFIG_SNAPSHOT
+static void cliSnapshot(char *cmdline)
+{
+    if (!isEmpty(cmdline)) {
+        char *saveptr;
+        const char *action = strtok_r(cmdline, " ", &saveptr);
+        const char *name = strtok_r(NULL, " ", &saveptr);
+        if (!name) {
+            cliShowParseError();
+
+            return;
+        }
+
+        configSnapshotResult_e result;
+        if (strcasecmp(action, "save") == 0) {
+            result = configSnapshotSave(name);
+        } else if (strcasecmp(action, "load") == 0) {
+            result = configSnapshotLoad(name);
+        } else if (strcasecmp(action, "delete") == 0) {
+            result = configSnapshotDelete(name);
+        } else {
+            cliShowParseError();
+
+            return;
+        }
+
+        switch (result) {
+        case CONFIG_SNAPSHOT_NOT_FOUND:
+            cliPrintErrorLinef("NO SNAPSHOT %s", name);
+
+            return;
+        case CONFIG_SNAPSHOT_NO_SLOT:
+            cliPrintErrorLinef("NO FREE SNAPSHOT, DELETE ONE FIRST");
+
+            return;
+        case CONFIG_SNAPSHOT_INCOMPLETE:
+            cliPrintErrorLinef("SNAPSHOT %s IS INCOMPLETE, SAVE IT AGAIN", name);
+
+            return;
+        case CONFIG_SNAPSHOT_NEEDS_REBOOT:
+            cliPrintErrorLinef("SNAPSHOT %s CHANGES GYRO SETTINGS THAT NEED A REBOOT", name);
+
+            return;
+        default:
+
+            break;
+        }
+    }
+
+    for (uint8_t slot = 0; slot < CONFIG_SNAPSHOT_COUNT; slot++) {
+        const char *name = configSnapshotName(slot);
+        if (name) {
+            cliPrintLinef("snapshot %d %s: %d bytes%s", slot + 1, name, configSnapshotSize(slot), configSnapshotIsComplete(slot) ? "" : " (incomplete)");
+        }
+    }
+    cliPrintLinef("%d bytes free", configSnapshotPoolFree());
+}
+#endif
+
 static void cliStatus(char *cmdline)
 {
     UNUSED(cmdline);
@@ -3819,7 +4087,7 @@ static void cliRcSmoothing(char *cmdline)
             }
         }
     } else {
-        cliPrintLine("INTERPOLATION");
+        cliPrintLine(lookupTables[TABLE_RC_SMOOTHING_TYPE].values[rxConfig()->rc_smoothing_type]);
     }
 }
 #endif // USE_RC_SMOOTHING_FILTER
@@ -3964,6 +4232,7 @@ static ioTag_t *getIoTag(const cliResourceValue_t value, uint8_t index)
 
 static void printResource(uint8_t dumpMask)
 {
+    uint32_t row = 0;
     for (unsigned int i = 0; i < ARRAYLEN(resourceTable); i++) {
         const char* owner = ownerNames[resourceTable[i].owner];
         const pgRegistry_t* pg = pgFind(resourceTable[i].pgn);
@@ -3978,6 +4247,9 @@ static void printResource(uint8_t dumpMask)
         }
 
         for (int index = 0; index < MAX_RESOURCE_INDEX(resourceTable[i].maxIndex); index++) {
+            if (!cliDumpRow(row++)) {
+                continue;
+            }
             const ioTag_t ioTag = *((const uint8_t *)currentConfig + resourceTable[i].stride * index + resourceTable[i].offset);
             const ioTag_t ioTagDefault = *((const uint8_t *)defaultConfig + resourceTable[i].stride * index + resourceTable[i].offset);
 
@@ -4300,32 +4572,53 @@ error:
 }
 #endif
 
-static void printConfig(char *cmdline, bool doDiff)
-{
-    uint8_t dumpMask = DUMP_MASTER;
-    char *options;
-    if ((options = checkCommand(cmdline, "master"))) {
-        dumpMask = DUMP_MASTER; // only
-    } else if ((options = checkCommand(cmdline, "profile"))) {
-        dumpMask = DUMP_PROFILE; // only
-    } else if ((options = checkCommand(cmdline, "rates"))) {
-        dumpMask = DUMP_RATES; // only
-    } else if ((options = checkCommand(cmdline, "all"))) {
-        dumpMask = DUMP_ALL;   // all profiles and rates
-    } else {
-        options = cmdline;
-    }
+typedef enum {
+    DUMP_SECTION_VERSION = 0,
+    DUMP_SECTION_NAME,
+#ifdef USE_RESOURCE_MGMT
+    DUMP_SECTION_RESOURCES,
+#endif
+#ifndef USE_QUAD_MIXER_ONLY
+    DUMP_SECTION_MIXER,
+#ifdef USE_SERVOS
+    DUMP_SECTION_SERVO,
+    DUMP_SECTION_SERVO_MIX,
+#endif
+#endif
+    DUMP_SECTION_FEATURE,
+#if defined(USE_BEEPER)
+    DUMP_SECTION_BEEPER,
+#if defined(USE_DSHOT)
+    DUMP_SECTION_BEACON,
+#endif
+#endif
+    DUMP_SECTION_MAP,
+    DUMP_SECTION_SERIAL,
+#ifdef USE_LED_STRIP
+    DUMP_SECTION_LED,
+    DUMP_SECTION_COLOR,
+    DUMP_SECTION_MODE_COLOR,
+#endif
+    DUMP_SECTION_AUX,
+    DUMP_SECTION_ADJRANGE,
+    DUMP_SECTION_RXRANGE,
+#ifdef USE_VTX_CONTROL
+    DUMP_SECTION_VTX,
+#endif
+    DUMP_SECTION_RXFAIL,
+    DUMP_SECTION_COUNT
+} dumpSection_e;
 
-    if (doDiff) {
-        dumpMask = dumpMask | DO_DIFF;
-    }
-    
-    backupAndResetConfigs();
-    if (checkCommand(options, "defaults")) {
-        dumpMask = dumpMask | SHOW_DEFAULTS;   // add default values as comments for changed values
-    }
+/*
+ * Print a section of the dump. Sections with rows can stop part way through when a slice runs out of room, see
+ * cliDumpRow(); a section resumed by the next slice does not print its header again.
+ */
+static void printConfigSection(dumpSection_e section, uint8_t dumpMask)
+{
+    const bool header = configDump.row == 0;
 
-    if ((dumpMask & DUMP_MASTER) || (dumpMask & DUMP_ALL)) {
+    switch (section) {
+    case DUMP_SECTION_VERSION:
         cliPrintHashLine("version");
         cliVersion(NULL);
         cliPrintLinefeed();
@@ -4338,7 +4631,7 @@ static void printConfig(char *cmdline, bool doDiff)
         if (dumpMask & DUMP_ALL) {
             cliMcuId(NULL);
 #if defined(USE_BOARD_INFO) && defined(USE_SIGNATURE)
-        cliSignature("");
+            cliSignature("");
 #endif
         }
 
@@ -4347,128 +4640,382 @@ static void printConfig(char *cmdline, bool doDiff)
             cliPrint("defaults nosave");
             cliPrintLinefeed();
         }
+        break;
 
+    case DUMP_SECTION_NAME:
         cliPrintHashLine("name");
         printName(dumpMask, &pilotConfig_Copy);
+        break;
 
 #ifdef USE_RESOURCE_MGMT
-        cliPrintHashLine("resources");
+    case DUMP_SECTION_RESOURCES:
+        if (header) {
+            cliPrintHashLine("resources");
+        }
         printResource(dumpMask);
+        break;
 #endif
 
 #ifndef USE_QUAD_MIXER_ONLY
-        cliPrintHashLine("mixer");
-        const bool equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
-        const char *formatMixer = "mixer %s";
-        cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
-        cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
-
-        cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
+    case DUMP_SECTION_MIXER:
+        if (header) {
+            cliPrintHashLine("mixer");
+            const bool equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
+            const char *formatMixer = "mixer %s";
+            cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
+            cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
 
+            cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
+        }
         printMotorMix(dumpMask, customMotorMixer_CopyArray, customMotorMixer(0));
+        break;
 
 #ifdef USE_SERVOS
-        cliPrintHashLine("servo");
+    case DUMP_SECTION_SERVO:
+        if (header) {
+            cliPrintHashLine("servo");
+        }
         printServo(dumpMask, servoParams_CopyArray, servoParams(0));
+        break;
 
-        cliPrintHashLine("servo mix");
-        // print custom servo mixer if exists
-        cliDumpPrintLinef(dumpMask, customServoMixers(0)->rate == 0, "smix reset\r\n");
+    case DUMP_SECTION_SERVO_MIX:
+        if (header) {
+            cliPrintHashLine("servo mix");
+            // print custom servo mixer if exists
+            cliDumpPrintLinef(dumpMask, customServoMixers(0)->rate == 0, "smix reset\r\n");
+        }
         printServoMix(dumpMask, customServoMixers_CopyArray, customServoMixers(0));
+        break;
 #endif
 #endif
 
-        cliPrintHashLine("feature");
+    case DUMP_SECTION_FEATURE:
+        if (header) {
+            cliPrintHashLine("feature");
+        }
         printFeature(dumpMask, &featureConfig_Copy, featureConfig());
+        break;
 
 #if defined(USE_BEEPER)
-        cliPrintHashLine("beeper");
+    case DUMP_SECTION_BEEPER:
+        if (header) {
+            cliPrintHashLine("beeper");
+        }
         printBeeper(dumpMask, beeperConfig_Copy.beeper_off_flags, beeperConfig()->beeper_off_flags, "beeper");
+        break;
 
 #if defined(USE_DSHOT)
-        cliPrintHashLine("beacon");
+    case DUMP_SECTION_BEACON:
+        if (header) {
+            cliPrintHashLine("beacon");
+        }
         printBeeper(dumpMask, beeperConfig_Copy.dshotBeaconOffFlags, beeperConfig()->dshotBeaconOffFlags, "beacon");
+        break;
 #endif
 #endif // USE_BEEPER
 
+    case DUMP_SECTION_MAP:
         cliPrintHashLine("map");
         printMap(dumpMask, &rxConfig_Copy, rxConfig());
+        break;
 
-        cliPrintHashLine("serial");
+    case DUMP_SECTION_SERIAL:
+        if (header) {
+            cliPrintHashLine("serial");
+        }
         printSerial(dumpMask, &serialConfig_Copy, serialConfig());
+        break;
 
 #ifdef USE_LED_STRIP
-        cliPrintHashLine("led");
+    case DUMP_SECTION_LED:
+        if (header) {
+            cliPrintHashLine("led");
+        }
         printLed(dumpMask, ledStripConfig_Copy.ledConfigs, ledStripConfig()->ledConfigs);
+        break;
 
-        cliPrintHashLine("color");
+    case DUMP_SECTION_COLOR:
+        if (header) {
+            cliPrintHashLine("color");
+        }
         printColor(dumpMask, ledStripConfig_Copy.colors, ledStripConfig()->colors);
+        break;
 
-        cliPrintHashLine("mode_color");
+    case DUMP_SECTION_MODE_COLOR:
+        if (header) {
+            cliPrintHashLine("mode_color");
+        }
         printModeColor(dumpMask, &ledStripConfig_Copy, ledStripConfig());
+        break;
 #endif
 
-        cliPrintHashLine("aux");
+    case DUMP_SECTION_AUX:
+        if (header) {
+            cliPrintHashLine("aux");
+        }
         printAux(dumpMask, modeActivationConditions_CopyArray, modeActivationConditions(0));
+        break;
 
-        cliPrintHashLine("adjrange");
+    case DUMP_SECTION_ADJRANGE:
+        if (header) {
+            cliPrintHashLine("adjrange");
+        }
         printAdjustmentRange(dumpMask, adjustmentRanges_CopyArray, adjustmentRanges(0));
+        break;
 
-        cliPrintHashLine("rxrange");
+    case DUMP_SECTION_RXRANGE:
+        if (header) {
+            cliPrintHashLine("rxrange");
+        }
         printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0));
+        break;
 
 #ifdef USE_VTX_CONTROL
-        cliPrintHashLine("vtx");
+    case DUMP_SECTION_VTX:
+        if (header) {
+            cliPrintHashLine("vtx");
+        }
         printVtx(dumpMask, &vtxConfig_Copy, vtxConfig());
+        break;
 #endif
 
-        cliPrintHashLine("rxfail");
+    case DUMP_SECTION_RXFAIL:
+        if (header) {
+            cliPrintHashLine("rxfail");
+        }
         printRxFailsafe(dumpMask, rxFailsafeChannelConfigs_CopyArray, rxFailsafeChannelConfigs(0));
+        break;
 
-        cliPrintHashLine("master");
-        dumpAllValues(MASTER_VALUE, dumpMask);
+    default:
+        break;
+    }
+}
 
-        if (dumpMask & DUMP_ALL) {
-            for (uint32_t pidProfileIndex = 0; pidProfileIndex < MAX_PROFILE_COUNT; pidProfileIndex++) {
-                cliDumpPidProfile(pidProfileIndex, dumpMask);
+// Print the next entry of the value table if it belongs to the section, returns false once past the end of the table
+static bool dumpNextValue(uint16_t valueSection, uint8_t dumpMask)
+{
+    if (configDump.valueIndex >= valueTableEntryCount) {
+        return false;
+    }
+
+    const clivalue_t *value = &valueTable[configDump.valueIndex++];
+    if ((value->type & VALUE_SECTION_MASK) == valueSection) {
+        dumpPgValue(value, dumpMask);
+    }
+
+    return true;
+}
+
+// 'dump all' prints every profile, the other dumps just the active one if they print profiles of this kind at all
+static uint8_t dumpProfileCount(uint8_t profileCount, uint8_t profileMask)
+{
+    if (configDump.dumpMask & DUMP_ALL) {
+        return profileCount;
+    }
+
+    return (configDump.dumpMask & (DUMP_MASTER | profileMask)) ? 1 : 0;
+}
+
+static uint8_t dumpProfileIndex(uint8_t activeProfileIndex)
+{
+    return (configDump.dumpMask & DUMP_ALL) ? configDump.index : activeProfileIndex;
+}
+
+// Print the next section, profile header or value of the dump, returns false once the dump is complete
+static bool printConfigStep(void)
+{
+    const uint8_t dumpMask = configDump.dumpMask;
+
+    switch (configDump.state) {
+    case DUMP_STATE_SECTIONS:
+        if (configDump.index < DUMP_SECTION_COUNT) {
+            printConfigSection(configDump.index, dumpMask);
+            if (!configDump.rowStopped) {
+                configDump.index++;
+                configDump.row = 0;
             }
-            cliPrintHashLine("restore original profile selection");
+        } else {
+            cliPrintHashLine("master");
+            configDump.valueIndex = 0;
+            configDump.state = DUMP_STATE_MASTER_VALUES;
+        }
+        break;
 
-            pidProfileIndexToUse = systemConfig_Copy.pidProfileIndex;
+    case DUMP_STATE_MASTER_VALUES:
+        if (!dumpNextValue(MASTER_VALUE, dumpMask)) {
+            configDump.index = 0;
+            configDump.state = DUMP_STATE_PROFILE;
+        }
+        break;
 
-            cliProfile("");
+    case DUMP_STATE_PROFILE:
+        if (configDump.index < dumpProfileCount(MAX_PROFILE_COUNT, DUMP_PROFILE)) {
+            const uint8_t pidProfileIndex = dumpProfileIndex(systemConfig_Copy.pidProfileIndex);
+            if (pidProfileIndex >= MAX_PROFILE_COUNT) {
+                // Faulty values
+                configDump.index++;
+                break;
+            }
 
+            pidProfileIndexToUse = pidProfileIndex;
+            cliPrintHashLine("profile");
+            cliProfile("");
+            cliPrintLinefeed();
             pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
 
-            for (uint32_t rateIndex = 0; rateIndex < CONTROL_RATE_PROFILE_COUNT; rateIndex++) {
-                cliDumpRateProfile(rateIndex, dumpMask);
+            configDump.valueIndex = 0;
+            configDump.state = DUMP_STATE_PROFILE_VALUES;
+        } else {
+            if (dumpMask & DUMP_ALL) {
+                cliPrintHashLine("restore original profile selection");
+
+                pidProfileIndexToUse = systemConfig_Copy.pidProfileIndex;
+
+                cliProfile("");
+
+                pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
             }
-            cliPrintHashLine("restore original rateprofile selection");
 
-            rateProfileIndexToUse = systemConfig_Copy.activeRateProfile;
+            configDump.index = 0;
+            configDump.state = DUMP_STATE_RATE_PROFILE;
+        }
+        break;
 
-            cliRateProfile("");
+    case DUMP_STATE_PROFILE_VALUES: {
+        pidProfileIndexToUse = dumpProfileIndex(systemConfig_Copy.pidProfileIndex);
+        const bool more = dumpNextValue(PROFILE_VALUE, dumpMask);
+        pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
+
+        if (!more) {
+            configDump.index++;
+            configDump.state = DUMP_STATE_PROFILE;
+        }
+        break;
+    }
 
+    case DUMP_STATE_RATE_PROFILE:
+        if (configDump.index < dumpProfileCount(CONTROL_RATE_PROFILE_COUNT, DUMP_RATES)) {
+            const uint8_t rateProfileIndex = dumpProfileIndex(systemConfig_Copy.activeRateProfile);
+            if (rateProfileIndex >= CONTROL_RATE_PROFILE_COUNT) {
+                // Faulty values
+                configDump.index++;
+                break;
+            }
+
+            rateProfileIndexToUse = rateProfileIndex;
+            cliPrintHashLine("rateprofile");
+            cliRateProfile("");
+            cliPrintLinefeed();
             rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
 
-            cliPrintHashLine("save configuration");
-            cliPrint("save");
+            configDump.valueIndex = 0;
+            configDump.state = DUMP_STATE_RATE_PROFILE_VALUES;
         } else {
-            cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+            if (dumpMask & DUMP_ALL) {
+                cliPrintHashLine("restore original rateprofile selection");
+
+                rateProfileIndexToUse = systemConfig_Copy.activeRateProfile;
+
+                cliRateProfile("");
 
-            cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+                rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
+
+                cliPrintHashLine("save configuration");
+                cliPrint("save");
+            }
+
+            configDump.state = DUMP_STATE_IDLE;
         }
+        break;
+
+    case DUMP_STATE_RATE_PROFILE_VALUES: {
+        rateProfileIndexToUse = dumpProfileIndex(systemConfig_Copy.activeRateProfile);
+        const bool more = dumpNextValue(PROFILE_RATE_VALUE, dumpMask);
+        rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
+
+        if (!more) {
+            configDump.index++;
+            configDump.state = DUMP_STATE_RATE_PROFILE;
+        }
+        break;
     }
 
-    if (dumpMask & DUMP_PROFILE) {
-        cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+    default:
+        configDump.state = DUMP_STATE_IDLE;
+        break;
     }
 
-    if (dumpMask & DUMP_RATES) {
-        cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+    return configDump.state != DUMP_STATE_IDLE;
+}
+
+/*
+ * Print a slice of the dump in progress. A slice stops once it has written what was free in the TX buffer when it
+ * started, or has run for CLI_DUMP_SLICE_US, so neither a slow port nor a long diff holds up the scheduler; the
+ * rest follows on the next run of the CLI task. A slice stops between the rows of a section as well as between
+ * sections and values.
+ */
+static void printConfigResume(void)
+{
+    configDump.sliceBytesFree = serialTxBytesFree(cliPort);
+    configDump.sliceHeadroom = MIN(CLI_DUMP_ROW_SIZE, cliPort->txBufferSize / 2);
+    if (configDump.sliceHeadroom >= configDump.sliceBytesFree) {
+        return;
+    }
+
+    configDump.sliceStartUs = micros();
+    configDump.sliceWriteCount = cliWriteCount;
+    configDump.rowStopped = false;
+    configDump.slicing = true;
+
+    // the configs are only swapped for the defaults for as long as the slice takes
+    backupAndResetConfigs();
+    while (!cliDumpSliceFull() && !configDump.rowStopped) {
+        if (!printConfigStep()) {
+            break;
+        }
     }
-    // restore configs from copies
     restoreConfigs();
+
+    configDump.slicing = false;
+}
+
+static void printConfig(char *cmdline, bool doDiff)
+{
+    uint8_t dumpMask = DUMP_MASTER;
+    char *options;
+    if ((options = checkCommand(cmdline, "master"))) {
+        dumpMask = DUMP_MASTER; // only
+    } else if ((options = checkCommand(cmdline, "profile"))) {
+        dumpMask = DUMP_PROFILE; // only
+    } else if ((options = checkCommand(cmdline, "rates"))) {
+        dumpMask = DUMP_RATES; // only
+    } else if ((options = checkCommand(cmdline, "all"))) {
+        dumpMask = DUMP_ALL;   // all profiles and rates
+    } else {
+        options = cmdline;
+    }
+
+    if (doDiff) {
+        dumpMask = dumpMask | DO_DIFF;
+    }
+
+    char *nextOption;
+    if ((nextOption = checkCommand(options, "defaults"))) {
+        dumpMask = dumpMask | SHOW_DEFAULTS;   // add default values as comments for changed values
+        options = nextOption;
+    }
+
+#ifdef USE_CLI_COMPRESSION
+    if (checkCommand(options, "compressed")) {
+        cliCompressionStart();
+    }
+#endif
+
+    configDump.dumpMask = dumpMask;
+    configDump.index = 0;
+    configDump.row = 0;
+    // printed from cliProcess(), starting on the next run of the CLI task
+    configDump.state = (dumpMask & (DUMP_MASTER | DUMP_ALL)) ? DUMP_STATE_SECTIONS : DUMP_STATE_PROFILE;
 }
 
 static void cliDump(char *cmdline)
@@ -4525,6 +5072,12 @@ typedef struct {
 }
 #endif
 
+#ifdef USE_CLI_COMPRESSION
+#define DUMP_COMPRESSED_ARGS " {compressed}"
+#else
+#define DUMP_COMPRESSED_ARGS ""
+#endif
+
 static void cliHelp(char *cmdline);
 
 // should be sorted a..z for bsearch()
@@ -4550,7 +5103,7 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("color", "configure colors", NULL, cliColor),
 #endif
     CLI_COMMAND_DEF("defaults", "reset to defaults and reboot", "[nosave]", cliDefaults),
-    CLI_COMMAND_DEF("diff", "list configuration changes from default", "[master|profile|rates|all] {defaults}", cliDiff),
+    CLI_COMMAND_DEF("diff", "list configuration changes from default", "[master|profile|rates|all] {defaults}" DUMP_COMPRESSED_ARGS, cliDiff),
 #ifdef USE_RESOURCE_MGMT
     CLI_COMMAND_DEF("dma", "list dma utilisation", NULL, cliDma),
 #endif
@@ -4558,7 +5111,7 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("dshotprog", "program DShot ESC(s)", "<index> <command>+", cliDshotProg),
 #endif
     CLI_COMMAND_DEF("dump", "dump configuration",
-        "[master|profile|rates|all] {defaults}", cliDump),
+        "[master|profile|rates|all] {defaults}" DUMP_COMPRESSED_ARGS, cliDump),
 #ifdef USE_ESCSERIAL
     CLI_COMMAND_DEF("escprog", "passthrough esc to serial", "<mode [sk/bl/ki/cc]> <index>", cliEscPassthrough),
 #endif
@@ -4567,6 +5120,9 @@ const clicmd_t cmdTable[] = {
         "list\r\n"
         "\t<+|->[name]", cliFeature),
 #ifdef USE_FLASHFS
+#ifdef USE_FLASHFS_LOG
+    CLI_COMMAND_DEF("flash_delete", "delete a log", "<log>", cliFlashDelete),
+#endif
     CLI_COMMAND_DEF("flash_erase", "erase flash chip", NULL, cliFlashErase),
     CLI_COMMAND_DEF("flash_info", "show flash chip info", NULL, cliFlashInfo),
 #ifdef USE_FLASH_TOOLS
@@ -4639,6 +5195,9 @@ const clicmd_t cmdTable[] = {
         "\treset\r\n"
         "\tload <mixer>\r\n"
         "\treverse <servo> <source> r|n", cliServoMix),
+#endif
+#ifdef USE_CONFIG_SNAPSHOT
+    CLI_COMMAND_DEF("snapshot", "A/B snapshots of the filter, PID and rate settings", "[save|load|delete <name>]", cliSnapshot),
 #endif
     CLI_COMMAND_DEF("status", "show status", NULL, cliStatus),
 #if defined(USE_TASK_STATISTICS)
@@ -4671,112 +5230,272 @@ static void cliHelp(char *cmdline)
     }
 }
 
-void cliProcess(void)
+static bool cliEchoInput(void)
 {
-    if (!cliWriter) {
+#ifdef USE_CLI_COMPRESSION
+    return !cliCompression.decoding;
+#else
+    return true;
+#endif
+}
+
+// Called once a command, and the dump it may have started, is complete
+static void cliCommandComplete(void)
+{
+#ifdef USE_CLI_COMPRESSION
+    if (cliCompression.decoding) {
+        // no prompts for input in frames
         return;
     }
+    if (cliCompression.encoding) {
+        cliCompressionEnd();
+    }
+#endif
+    cliPrompt();
+}
 
-    // Be a little bit tricky.  Flush the last inputs buffer, if any.
-    bufWriterFlush(cliWriter);
-
-    while (serialRxBytesWaiting(cliPort)) {
-        uint8_t c = serialRead(cliPort);
-        if (c == '\t' || c == '?') {
-            // do tab completion
-            const clicmd_t *cmd, *pstart = NULL, *pend = NULL;
-            uint32_t i = bufferIndex;
-            for (cmd = cmdTable; cmd < cmdTable + ARRAYLEN(cmdTable); cmd++) {
-                if (bufferIndex && (strncasecmp(cliBuffer, cmd->name, bufferIndex) != 0))
-                    continue;
-                if (!pstart)
-                    pstart = cmd;
-                pend = cmd;
-            }
-            if (pstart) {    /* Buffer matches one or more commands */
-                for (; ; bufferIndex++) {
-                    if (pstart->name[bufferIndex] != pend->name[bufferIndex])
-                        break;
-                    if (!pstart->name[bufferIndex] && bufferIndex < sizeof(cliBuffer) - 2) {
-                        /* Unambiguous -- append a space */
-                        cliBuffer[bufferIndex++] = ' ';
-                        cliBuffer[bufferIndex] = '\0';
-                        break;
-                    }
-                    cliBuffer[bufferIndex] = pstart->name[bufferIndex];
+// Handle a character of input, returns false when no further input is to be handled for now
+static bool cliProcessChar(uint8_t c)
+{
+    if (c == '\t' || c == '?') {
+        // do tab completion
+        const clicmd_t *cmd, *pstart = NULL, *pend = NULL;
+        uint32_t i = bufferIndex;
+        for (cmd = cmdTable; cmd < cmdTable + ARRAYLEN(cmdTable); cmd++) {
+            if (bufferIndex && (strncasecmp(cliBuffer, cmd->name, bufferIndex) != 0))
+                continue;
+            if (!pstart)
+                pstart = cmd;
+            pend = cmd;
+        }
+        if (pstart) {    /* Buffer matches one or more commands */
+            for (; ; bufferIndex++) {
+                if (pstart->name[bufferIndex] != pend->name[bufferIndex])
+                    break;
+                if (!pstart->name[bufferIndex] && bufferIndex < sizeof(cliBuffer) - 2) {
+                    /* Unambiguous -- append a space */
+                    cliBuffer[bufferIndex++] = ' ';
+                    cliBuffer[bufferIndex] = '\0';
+                    break;
                 }
+                cliBuffer[bufferIndex] = pstart->name[bufferIndex];
             }
-            if (!bufferIndex || pstart != pend) {
-                /* Print list of ambiguous matches */
-                cliPrint("\r\033[K");
-                for (cmd = pstart; cmd <= pend; cmd++) {
-                    cliPrint(cmd->name);
-                    cliWrite('\t');
-                }
-                cliPrompt();
-                i = 0;    /* Redraw prompt */
+        }
+        if (!bufferIndex || pstart != pend) {
+            /* Print list of ambiguous matches */
+            cliPrint("\r\033[K");
+            for (cmd = pstart; cmd <= pend; cmd++) {
+                cliPrint(cmd->name);
+                cliWrite('\t');
             }
-            for (; i < bufferIndex; i++)
-                cliWrite(cliBuffer[i]);
-        } else if (!bufferIndex && c == 4) {   // CTRL-D
-            cliExit(cliBuffer);
-            return;
-        } else if (c == 12) {                  // NewPage / CTRL-L
-            // clear screen
-            cliPrint("\033[2J\033[1;1H");
             cliPrompt();
-        } else if (bufferIndex && (c == '\n' || c == '\r')) {
-            // enter pressed
+            i = 0;    /* Redraw prompt */
+        }
+        for (; i < bufferIndex; i++)
+            cliWrite(cliBuffer[i]);
+    } else if (!bufferIndex && c == 4) {   // CTRL-D
+        cliExit(cliBuffer);
+        return false;
+    } else if (c == 12) {                  // NewPage / CTRL-L
+        // clear screen
+        cliPrint("\033[2J\033[1;1H");
+        cliPrompt();
+    } else if (bufferIndex && (c == '\n' || c == '\r')) {
+        // enter pressed
+        if (cliEchoInput()) {
             cliPrintLinefeed();
+        }
 
-            // Strip comment starting with # from line
-            char *p = cliBuffer;
-            p = strchr(p, '#');
-            if (NULL != p) {
-                bufferIndex = (uint32_t)(p - cliBuffer);
-            }
+        // Strip comment starting with # from line
+        char *p = cliBuffer;
+        p = strchr(p, '#');
+        if (NULL != p) {
+            bufferIndex = (uint32_t)(p - cliBuffer);
+        }
 
-            // Strip trailing whitespace
-            while (bufferIndex > 0 && cliBuffer[bufferIndex - 1] == ' ') {
-                bufferIndex--;
-            }
+        // Strip trailing whitespace
+        while (bufferIndex > 0 && cliBuffer[bufferIndex - 1] == ' ') {
+            bufferIndex--;
+        }
 
-            // Process non-empty lines
-            if (bufferIndex > 0) {
-                cliBuffer[bufferIndex] = 0; // null terminate
+        // Process non-empty lines
+        if (bufferIndex > 0) {
+            cliBuffer[bufferIndex] = 0; // null terminate
 
-                const clicmd_t *cmd;
-                char *options;
-                for (cmd = cmdTable; cmd < cmdTable + ARRAYLEN(cmdTable); cmd++) {
-                    if ((options = checkCommand(cliBuffer, cmd->name))) {
-                        break;
-                    }
+            const clicmd_t *cmd;
+            char *options;
+            for (cmd = cmdTable; cmd < cmdTable + ARRAYLEN(cmdTable); cmd++) {
+                if ((options = checkCommand(cliBuffer, cmd->name))) {
+                    break;
                 }
-                if (cmd < cmdTable + ARRAYLEN(cmdTable))
-                    cmd->func(options);
-                else
-                    cliPrint("Unknown command, try 'help'");
-                bufferIndex = 0;
             }
+            if (cmd < cmdTable + ARRAYLEN(cmdTable))
+                cmd->func(options);
+            else
+                cliPrint("Unknown command, try 'help'");
+            bufferIndex = 0;
+        }
+
+        memset(cliBuffer, 0, sizeof(cliBuffer));
+
+        // 'exit' will reset this flag, so we don't need to print prompt again
+        if (!cliMode)
+            return false;
+
+        // a dump still being printed is complete once it has all been sent
+        if (configDump.state != DUMP_STATE_IDLE)
+            return false;
+
+        cliCommandComplete();
+    } else if (c == 127) {
+        // backspace
+        if (bufferIndex) {
+            cliBuffer[--bufferIndex] = 0;
+            cliPrint("\010 \010");
+        }
+    } else if (bufferIndex < sizeof(cliBuffer) && c >= 32 && c <= 126) {
+        if (!bufferIndex && c == ' ')
+            return true; // Ignore leading spaces
+        cliBuffer[bufferIndex++] = c;
+        if (cliEchoInput()) {
+            cliWrite(c);
+        }
+    }
 
-            memset(cliBuffer, 0, sizeof(cliBuffer));
+    return true;
+}
 
-            // 'exit' will reset this flag, so we don't need to print prompt again
-            if (!cliMode)
-                return;
+#ifdef USE_CLI_COMPRESSION
+static void cliFrameError(void)
+{
+    if (cliCompression.encoding) {
+        cliCompressionEnd();
+    }
+    cliCompression.inputState = CLI_FRAME_IDLE;
 
-            cliPrompt();
-        } else if (c == 127) {
-            // backspace
-            if (bufferIndex) {
-                cliBuffer[--bufferIndex] = 0;
-                cliPrint("\010 \010");
+    cliPrintErrorLinef("COMPRESSED INPUT");
+    cliPrompt();
+}
+
+// Collect a frame of compressed input, returns false for a character that is not part of a frame
+static bool cliReadFrame(uint8_t c)
+{
+    switch (cliCompression.inputState) {
+    case CLI_FRAME_IDLE:
+        if (c != CLI_FRAME_MARKER) {
+            return false;
+        }
+        cliCompression.inputState = CLI_FRAME_FLAGS;
+        break;
+
+    case CLI_FRAME_FLAGS:
+        cliCompression.inputFlags = c;
+        cliCompression.inputState = CLI_FRAME_LENGTH;
+        break;
+
+    case CLI_FRAME_LENGTH:
+        if (c > LZSS_BLOCK_SIZE) {
+            cliFrameError();
+            break;
+        }
+        cliCompression.inputLength = c;
+        cliCompression.inputIndex = 0;
+        cliCompression.inputState = c ? CLI_FRAME_PAYLOAD : CLI_FRAME_CRC;
+        break;
+
+    case CLI_FRAME_PAYLOAD:
+        cliCompression.input[cliCompression.inputIndex++] = c;
+        if (cliCompression.inputIndex == cliCompression.inputLength) {
+            cliCompression.inputState = CLI_FRAME_CRC;
+        }
+        break;
+
+    case CLI_FRAME_CRC: {
+        uint8_t crc = crc8_dvb_s2(0, cliCompression.inputFlags);
+        crc = crc8_dvb_s2(crc, cliCompression.inputLength);
+        crc = crc8_dvb_s2_update(crc, cliCompression.input, cliCompression.inputLength);
+        const bool start = cliCompression.inputFlags & CLI_FRAME_START;
+        if (crc != c || (!start && !cliCompression.decoding)) {
+            cliFrameError();
+            break;
+        }
+
+        if (start) {
+            cliCompression.decoding = true;
+            cliCompressionStart();
+            lzssDecoderInit(&cliCompression.decoder);
+        }
+        lzssDecoderSetBlock(&cliCompression.decoder, cliCompression.input, cliCompression.inputLength);
+        cliCompression.inputState = CLI_FRAME_DECODING;
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    return true;
+}
+
+// Feed the frame received to the command line, returns false if it has to wait for a command to complete
+static bool cliDecodeFrame(void)
+{
+    int c;
+    while ((c = lzssDecoderGet(&cliCompression.decoder)) >= 0) {
+        if (!cliProcessChar(c)) {
+            return false;
+        }
+    }
+
+    cliCompression.inputState = CLI_FRAME_IDLE;
+    if (cliCompression.inputFlags & CLI_FRAME_END) {
+        cliCompressionEnd();
+        cliPrompt();
+    } else {
+        cliCompressionFlush(CLI_FRAME_SYNC);
+    }
+
+    return true;
+}
+#endif
+
+void cliProcess(void)
+{
+    if (!cliWriter) {
+        return;
+    }
+
+    // Be a little bit tricky.  Flush the last inputs buffer, if any.
+    bufWriterFlush(cliWriter);
+
+    // Finish a dump before reading any further input
+    if (configDump.state != DUMP_STATE_IDLE) {
+        printConfigResume();
+        if (configDump.state != DUMP_STATE_IDLE) {
+            return;
+        }
+
+        cliCommandComplete();
+    }
+
+#ifdef USE_CLI_COMPRESSION
+    if (cliCompression.inputState == CLI_FRAME_DECODING && !cliDecodeFrame()) {
+        return;
+    }
+#endif
+
+    while (serialRxBytesWaiting(cliPort)) {
+        uint8_t c = serialRead(cliPort);
+#ifdef USE_CLI_COMPRESSION
+        if (cliReadFrame(c)) {
+            if (cliCompression.inputState == CLI_FRAME_DECODING && !cliDecodeFrame()) {
+                return;
             }
-        } else if (bufferIndex < sizeof(cliBuffer) && c >= 32 && c <= 126) {
-            if (!bufferIndex && c == ' ')
-                continue; // Ignore leading spaces
-            cliBuffer[bufferIndex++] = c;
-            cliWrite(c);
+            continue;
+        }
+#endif
+        if (!cliProcessChar(c)) {
+            return;
         }
     }
 }
@@ -4786,9 +5505,10 @@ void cliEnter(serialPort_t *serialPort)
     cliMode = 1;
     cliPort = serialPort;
     setPrintfSerialPort(cliPort);
-    cliWriter = bufWriterInit(cliWriteBuffer, sizeof(cliWriteBuffer), (bufWrite_t)serialWriteBufShim, serialPort);
+    cliWriter = bufWriterInit(cliWriteBuffer, sizeof(cliWriteBuffer), cliWriteBufShim, serialPort);
 
     schedulerSetCalulateTaskStatistics(systemConfig()->task_statistics);
+    setTaskEnabled(TASK_CLI, true);
 
 #ifndef MINIMAL_CLI
     cliPrintLine("\r\nEntering CLI Mode, type 'exit' to return, or 'help'");
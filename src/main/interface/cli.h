@@ -25,6 +25,7 @@ extern uint8_t cliMode;
 struct clivalue_s;
 void *cliGetValuePointer(const struct clivalue_s *value);
 const void *cliGetDefaultPointer(const struct clivalue_s *value);
+void cliSetVar(const struct clivalue_s *var, const uint32_t value);
 
 struct serialConfig_s;
 void cliInit(const struct serialConfig_s *serialConfig);
@@ -42,6 +42,8 @@
 #include "common/utils.h"
 
 #include "config/config_eeprom.h"
+#include "config/config_snapshot.h"
+#include "config/config_transfer.h"
 #include "config/feature.h"
 
 #include "drivers/accgyro/accgyro.h"
@@ -56,6 +58,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_escserial.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 #include "drivers/transponder_ir.h"
 #include "drivers/usb_msc.h"
 #include "drivers/vtx_common.h"
@@ -72,6 +75,7 @@
 
 #include "flight/position.h"
 #include "flight/failsafe.h"
+#include "flight/gain_schedule.h"
 #include "flight/gps_rescue.h"
 #include "flight/imu.h"
 #include "flight/mixer.h"
@@ -79,8 +83,13 @@
 #include "flight/servos.h"
 
 #include "interface/msp.h"
+#include "interface/msp_batch.h"
 #include "interface/msp_box.h"
+#include "interface/msp_dataflash.h"
 #include "interface/msp_protocol.h"
+#include "interface/msp_protocol_v2_betaflight.h"
+#include "interface/msp_setting.h"
+#include "interface/msp_subscription.h"
 
 #include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
@@ -330,7 +339,7 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
         sbufWriteU8(dst, flags);
         sbufWriteU32(dst, geometry->sectors);
         sbufWriteU32(dst, geometry->totalSize);
-        sbufWriteU32(dst, flashfsGetOffset()); // Effectively the current number of bytes stored on the volume
+        sbufWriteU32(dst, flashfsGetUsedSize());
     } else
 #endif
 
@@ -344,11 +353,6 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
 }
 
 #ifdef USE_FLASHFS
-enum compressionType_e {
-    NO_COMPRESSION,
-    HUFFMAN
-};
-
 static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
 {
     STATIC_ASSERT(MSP_PORT_DATAFLASH_INFO_SIZE >= 16, MSP_PORT_DATAFLASH_INFO_SIZE_invalid);
@@ -359,8 +363,10 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
         readLen = bytesRemainingInBuf;
     }
     // size will be lower than that requested if we reach end of volume
-    const uint32_t flashfsSize = flashfsGetSize();
-    if (readLen > flashfsSize - address) {
+    const uint32_t flashfsSize = flashfsGetReadableSize();
+    if (address > flashfsSize) {
+        readLen = 0;
+    } else if (readLen > flashfsSize - address) {
         // truncate the request
         readLen = flashfsSize - address;
     }
@@ -1071,6 +1077,21 @@ static bool mspProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
 #endif
 #endif
 
+    case MSP_GAIN_SCHEDULE:
+        sbufWriteU8(dst, gainScheduleConfig()->enabled);
+        sbufWriteU8(dst, GAIN_SCHEDULE_THROTTLE_POINTS);
+        sbufWriteU8(dst, GAIN_SCHEDULE_VBAT_POINTS);
+        sbufWriteData(dst, gainScheduleConfig()->throttle, GAIN_SCHEDULE_THROTTLE_POINTS);
+        sbufWriteData(dst, gainScheduleConfig()->cellVoltage, GAIN_SCHEDULE_VBAT_POINTS);
+        for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+            sbufWriteData(dst, gainScheduleConfig()->gain[term], GAIN_SCHEDULE_TABLE_SIZE);
+        }
+        // active multipliers in 0.1% units
+        for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+            sbufWriteU16(dst, lrintf(gainScheduleGetMultiplier(term) * 1000));
+        }
+        break;
+
     case MSP_ACC_TRIM:
         sbufWriteU16(dst, accelerometerConfig()->accelerometerTrims.values.pitch);
         sbufWriteU16(dst, accelerometerConfig()->accelerometerTrims.values.roll);
@@ -1513,6 +1534,218 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
 }
 #endif
 
+#ifdef USE_MSP_DATAFLASH_STREAM
+static void mspFcDataflashStreamAttach(serialPort_t *port)
+{
+    if (!mspSerialStartStream(port, MSP2_BETAFLIGHT_DATAFLASH_STREAM_DATA, mspDataflashStreamFill)) {
+        mspDataflashStreamStop();
+    }
+}
+
+static mspResult_e mspFcDataflashStreamCommand(sbuf_t *dst, sbuf_t *src, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    if (sbufBytesRemaining(src) < 15) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const uint32_t address = sbufReadU32(src);
+    const uint32_t length = sbufReadU32(src);
+    const uint16_t frameSize = sbufReadU16(src);
+    const uint32_t window = sbufReadU32(src);
+    const uint8_t flags = sbufReadU8(src);
+
+    if (!mspSerialCanStartStream(mspDataflashStreamFill)) {
+        return MSP_RESULT_ERROR;
+    }
+
+    // Frames go out from the same buffer as replies, so they are never larger than a dataflash read reply
+    const uint16_t maxFrameSize = MSP_PORT_DATAFLASH_BUFFER_SIZE;
+    const uint16_t effectiveFrameSize = frameSize ? MIN(frameSize, maxFrameSize) : maxFrameSize;
+    const uint32_t streamLength = mspDataflashStreamStart(address, length, effectiveFrameSize, window, flags);
+
+    sbufWriteU32(dst, address);
+    sbufWriteU32(dst, streamLength);
+    sbufWriteU16(dst, effectiveFrameSize);
+
+    if (streamLength) {
+        // Frames start once this reply is on its way
+        *mspPostProcessFn = mspFcDataflashStreamAttach;
+    }
+
+    return MSP_RESULT_ACK;
+}
+#endif
+
+#ifdef USE_MSP_SUBSCRIPTION
+// Telemetry getters that take no arguments and whose replies fit MSP_SUBSCRIPTION_MESSAGE_SIZE_MAX
+static const uint8_t mspSubscribableCommands[] = {
+    MSP_STATUS, MSP_STATUS_EX, MSP_RAW_IMU, MSP_SERVO, MSP_MOTOR, MSP_RC, MSP_RAW_GPS, MSP_COMP_GPS,
+    MSP_ATTITUDE, MSP_ALTITUDE, MSP_ANALOG, MSP_BATTERY_STATE, MSP_DEBUG, MSP_VOLTAGE_METERS,
+};
+
+static bool mspIsSubscribableCommand(uint16_t cmdMSP)
+{
+    for (unsigned i = 0; i < ARRAYLEN(mspSubscribableCommands); i++) {
+        if (mspSubscribableCommands[i] == cmdMSP) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool mspFcSubscriptionSerialize(int16_t cmdMSP, sbuf_t *dst)
+{
+    mspPostProcessFnPtr mspPostProcessFn = NULL;
+
+    return mspCommonProcessOutCommand(cmdMSP, dst, &mspPostProcessFn) || mspProcessOutCommand(cmdMSP, dst);
+}
+
+static void mspFcSubscriptionAttach(serialPort_t *port)
+{
+    if (!mspSerialStartStream(port, MSP2_BETAFLIGHT_STREAM_DATA, mspSubscriptionFill)) {
+        mspSubscriptionClear();
+    }
+}
+
+/*
+ * Replaces the subscription set with the {command, rate} pairs in src, an empty request unsubscribes from everything.
+ * Replies with the rate granted to each command, zero if it was refused or the port has no stream free for it.
+ */
+static mspResult_e mspFcSubscribeCommand(sbuf_t *dst, sbuf_t *src, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    mspSubscriptionClear();
+
+    // Messages go out from the serial task, so they can not be pushed any faster than it runs
+    const uint16_t maxRateHz = serialConfig()->serial_update_rate_hz;
+    const bool canStream = mspSerialCanStartStream(mspSubscriptionFill);
+    while (sbufBytesRemaining(src) >= 4 && sbufBytesRemaining(dst) >= 4) {
+        const uint16_t cmdMSP = sbufReadU16(src);
+        uint16_t rateHz = MIN(sbufReadU16(src), maxRateHz);
+        if (!canStream || !mspIsSubscribableCommand(cmdMSP) || !mspSubscriptionAdd(cmdMSP, rateHz)) {
+            rateHz = 0;
+        }
+
+        sbufWriteU16(dst, cmdMSP);
+        sbufWriteU16(dst, rateHz);
+    }
+
+    if (mspSubscriptionIsActive()) {
+        // Frames start once this reply is on its way
+        *mspPostProcessFn = mspFcSubscriptionAttach;
+    }
+
+    return MSP_RESULT_ACK;
+}
+#endif
+
+#ifdef USE_CONFIG_TRANSFER
+/*
+ * Takes the offset of the first byte wanted from the config image, optionally followed by the most bytes wanted.
+ * Replies with the size of the image and the offset, followed by as much of the image from there as fits.
+ */
+static mspResult_e mspFcConfigReadCommand(sbuf_t *dst, sbuf_t *src)
+{
+    if (sbufBytesRemaining(src) < 4) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const uint32_t offset = sbufReadU32(src);
+    int length = MIN(sbufBytesRemaining(dst), MSP_PORT_REPLY_SIZE_MAX) - 8;
+    if (sbufBytesRemaining(src) >= 2) {
+        length = MIN(length, sbufReadU16(src));
+    }
+
+    sbufWriteU32(dst, configTransferImageSize());
+    sbufWriteU32(dst, offset);
+    sbufAdvance(dst, configTransferRead(offset, sbufPtr(dst), length));
+
+    return MSP_RESULT_ACK;
+}
+
+/*
+ * Takes the offset of a chunk of a config image followed by its data. Replies with the offset the next chunk must
+ * start at and whether the image is complete. A complete image is loaded and saved, a bad one must be sent again
+ * from offset 0.
+ */
+static mspResult_e mspFcConfigWriteCommand(sbuf_t *dst, sbuf_t *src)
+{
+    if (ARMING_FLAG(ARMED) || sbufBytesRemaining(src) < 4) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const uint32_t offset = sbufReadU32(src);
+    const int length = sbufBytesRemaining(src);
+    const configTransferResult_e result = configTransferWrite(offset, sbufPtr(src), length);
+    if (result == CONFIG_TRANSFER_ERROR) {
+        return MSP_RESULT_ERROR;
+    }
+
+    if (result == CONFIG_TRANSFER_COMPLETE) {
+        writeEEPROM();
+        readEEPROM();
+    }
+
+    sbufWriteU32(dst, offset + length);
+    sbufWriteU8(dst, result == CONFIG_TRANSFER_COMPLETE);
+
+    return MSP_RESULT_ACK;
+}
+#endif
+
+static mspResult_e mspFcProcessV2Command(int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    // potentially unused depending on compile options.
+    UNUSED(src);
+    UNUSED(dst);
+    UNUSED(mspPostProcessFn);
+
+    switch (cmdMSP) {
+#ifdef USE_MSP_DATAFLASH_STREAM
+    case MSP2_BETAFLIGHT_DATAFLASH_STREAM:
+        return mspFcDataflashStreamCommand(dst, src, mspPostProcessFn);
+
+    case MSP2_BETAFLIGHT_DATAFLASH_STREAM_ACK:
+        if (sbufBytesRemaining(src) < 4) {
+            return MSP_RESULT_ERROR;
+        }
+        mspDataflashStreamAck(sbufReadU32(src));
+
+        return MSP_RESULT_NO_REPLY;
+#endif
+#ifdef USE_MSP_SUBSCRIPTION
+    case MSP2_BETAFLIGHT_STREAM_SUBSCRIBE:
+        return mspFcSubscribeCommand(dst, src, mspPostProcessFn);
+#endif
+#ifdef USE_CLI
+    case MSP2_BETAFLIGHT_GET_SETTING:
+        return mspSettingGet(dst, src);
+
+    case MSP2_BETAFLIGHT_SET_SETTING:
+        return mspSettingSet(dst, src);
+#endif
+#ifdef USE_CONFIG_TRANSFER
+    case MSP2_BETAFLIGHT_CONFIG_READ:
+        return mspFcConfigReadCommand(dst, src);
+
+    case MSP2_BETAFLIGHT_CONFIG_WRITE:
+        return mspFcConfigWriteCommand(dst, src);
+#endif
+#ifdef USE_MSP_BATCH
+    case MSP2_BETAFLIGHT_BATCH:
+        {
+            // Give way to the main loop, the host sends whatever did not run in the next batch
+            const timeUs_t currentTimeUs = micros();
+            const timeDelta_t budgetUs = MIN(schedulerGetTimeToNextRealtimeUs(currentTimeUs), MSP_BATCH_TIME_BUDGET_US);
+
+            return mspBatchProcess(MSP2_BETAFLIGHT_BATCH, src, dst, mspFcProcessCommand, currentTimeUs + budgetUs, mspPostProcessFn);
+        }
+#endif
+    default:
+        // we do not know how to handle the (valid) message, indicate error MSP $X!
+        return MSP_RESULT_ERROR;
+    }
+}
+
 static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 {
     uint32_t i;
@@ -1572,6 +1805,22 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         }
 #endif
         break;
+    case MSP_SET_GAIN_SCHEDULE:
+        if (dataSize != 1 + GAIN_SCHEDULE_THROTTLE_POINTS + GAIN_SCHEDULE_VBAT_POINTS + GAIN_SCHEDULE_TERM_COUNT * GAIN_SCHEDULE_TABLE_SIZE) {
+            return MSP_RESULT_ERROR;
+        }
+        gainScheduleConfigMutable()->enabled = sbufReadU8(src);
+        sbufReadData(src, gainScheduleConfigMutable()->throttle, GAIN_SCHEDULE_THROTTLE_POINTS);
+        sbufAdvance(src, GAIN_SCHEDULE_THROTTLE_POINTS);
+        sbufReadData(src, gainScheduleConfigMutable()->cellVoltage, GAIN_SCHEDULE_VBAT_POINTS);
+        sbufAdvance(src, GAIN_SCHEDULE_VBAT_POINTS);
+        for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+            sbufReadData(src, gainScheduleConfigMutable()->gain[term], GAIN_SCHEDULE_TABLE_SIZE);
+            sbufAdvance(src, GAIN_SCHEDULE_TABLE_SIZE);
+        }
+        gainScheduleInit();
+        break;
+
     case MSP_SET_ACC_TRIM:
         accelerometerConfigMutable()->accelerometerTrims.values.pitch = sbufReadU16(src);
         accelerometerConfigMutable()->accelerometerTrims.values.roll  = sbufReadU16(src);
@@ -1588,6 +1837,7 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         break;
 
     case MSP_SET_PID:
+        configSnapshotTouch(PG_PID_PROFILE);
         for (int i = 0; i < PID_ITEM_COUNT; i++) {
             currentPidProfile->pid[i].P = sbufReadU8(src);
             currentPidProfile->pid[i].I = sbufReadU8(src);
@@ -1639,6 +1889,7 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         break;
 
     case MSP_SET_RC_TUNING:
+        configSnapshotTouch(PG_CONTROL_RATE_PROFILES);
         if (sbufBytesRemaining(src) >= 10) {
             value = sbufReadU8(src);
             if (currentControlRateProfile->rcRates[FD_PITCH] == currentControlRateProfile->rcRates[FD_ROLL]) {
@@ -1792,15 +2043,18 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         break;
 
     case MSP_SET_RESET_CURR_PID:
+        configSnapshotTouch(PG_PID_PROFILE);
         resetPidProfile(currentPidProfile);
         break;
     case MSP_SET_SENSOR_ALIGNMENT:
+        configSnapshotTouch(PG_GYRO_CONFIG);
         gyroConfigMutable()->gyro_align = sbufReadU8(src);
         accelerometerConfigMutable()->acc_align = sbufReadU8(src);
         compassConfigMutable()->mag_align = sbufReadU8(src);
         break;
 
     case MSP_SET_ADVANCED_CONFIG:
+        configSnapshotTouch(PG_GYRO_CONFIG);
         gyroConfigMutable()->gyro_sync_denom = sbufReadU8(src);
         pidConfigMutable()->pid_process_denom = sbufReadU8(src);
         motorConfigMutable()->dev.useUnsyncedPwm = sbufReadU8(src);
@@ -1832,6 +2086,8 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 
         break;
     case MSP_SET_FILTER_CONFIG:
+        configSnapshotTouch(PG_GYRO_CONFIG);
+        configSnapshotTouch(PG_PID_PROFILE);
         gyroConfigMutable()->gyro_lowpass_hz = sbufReadU8(src);
         currentPidProfile->dterm_lowpass_hz = sbufReadU16(src);
         currentPidProfile->yaw_lowpass_hz = sbufReadU16(src);
@@ -1865,6 +2121,7 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 
         break;
     case MSP_SET_PID_ADVANCED:
+        configSnapshotTouch(PG_PID_PROFILE);
         sbufReadU16(src);
         sbufReadU16(src);
         sbufReadU16(src); // was pidProfile.yaw_p_limit
@@ -2065,6 +2322,9 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 
 #ifdef USE_FLASHFS
     case MSP_DATAFLASH_ERASE:
+#ifdef USE_MSP_DATAFLASH_STREAM
+        mspDataflashStreamStop();
+#endif
         flashfsEraseCompletely();
         break;
 #endif
@@ -2539,7 +2799,10 @@ mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostPro
     // initialize reply by default
     reply->cmd = cmd->cmd;
 
-    if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
+    if (cmd->cmd > MSP_V2_FRAME_ID) {
+        // MSPv2 command IDs would alias MSPv1 ones once truncated
+        ret = mspFcProcessV2Command(cmd->cmd, src, dst, mspPostProcessFn);
+    } else if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
         ret = MSP_RESULT_ACK;
     } else if (mspProcessOutCommand(cmdMSP, dst)) {
         ret = MSP_RESULT_ACK;
@@ -2591,4 +2854,7 @@ void mspFcProcessReply(mspPacket_t *reply)
 void mspInit(void)
 {
     initActiveBoxIds();
+#ifdef USE_MSP_SUBSCRIPTION
+    mspSubscriptionInit(mspFcSubscriptionSerialize);
+#endif
 }
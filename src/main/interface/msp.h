@@ -58,6 +58,7 @@ struct serialPort_s;
 typedef void (*mspPostProcessFnPtr)(struct serialPort_s *port); // msp post process function, used for gracefully handling reboots, etc.
 typedef mspResult_e (*mspProcessCommandFnPtr)(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
 typedef void (*mspProcessReplyFnPtr)(mspPacket_t *cmd);
+typedef mspResult_e (*mspStreamFnPtr)(sbuf_t *dst); // fills the next frame of a stream the FC pushes unprompted
 
 
 void mspInit(void);
@@ -0,0 +1,110 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_MSP_BATCH
+
+#include "common/streambuf.h"
+#include "common/time.h"
+
+#include "drivers/time.h"
+
+#include "msp_batch.h"
+
+// command and payload size ahead of each request
+#define BATCH_REQUEST_HEADER_SIZE (sizeof(uint16_t) + sizeof(uint16_t))
+// command, result and payload size ahead of each reply
+#define BATCH_REPLY_HEADER_SIZE (sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t))
+
+/*
+ * Run the {command, size, payload} requests in src back to back and reply with the number of commands run, then
+ * command, result, size and payload of each. Stops at deadlineUs, when the reply is full, or after a command that
+ * has to act once its reply is sent; the host sends the rest again in another batch. The first command
+ * runs whatever the time, so every batch makes progress.
+ */
+mspResult_e mspBatchProcess(int16_t batchCmd, sbuf_t *src, sbuf_t *dst, mspProcessCommandFnPtr mspProcessCommandFn, timeUs_t deadlineUs, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    if (sbufBytesRemaining(dst) < (int)sizeof(uint16_t)) {
+        return MSP_RESULT_ERROR;
+    }
+
+    uint8_t * const countPtr = sbufPtr(dst);
+    sbufWriteU16(dst, 0);
+    uint16_t commandCount = 0;
+
+    while (sbufBytesRemaining(src) >= (int)BATCH_REQUEST_HEADER_SIZE) {
+        if (sbufBytesRemaining(dst) < (int)(BATCH_REPLY_HEADER_SIZE + MSP_BATCH_REPLY_SIZE_MAX)
+            || (commandCount > 0 && cmpTimeUs(micros(), deadlineUs) >= 0)) {
+            break;
+        }
+
+        const int16_t cmd = sbufReadU16(src);
+        const uint16_t size = sbufReadU16(src);
+        if (sbufBytesRemaining(src) < size) {
+            // Truncated request, nothing after it can be trusted
+            break;
+        }
+
+        mspPacket_t command = {
+            .buf = { .ptr = sbufPtr(src), .end = sbufPtr(src) + size, },
+            .cmd = cmd,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REQUEST,
+        };
+        sbufAdvance(src, size);
+
+        uint8_t * const replyStart = sbufPtr(dst);
+        mspPacket_t reply = {
+            .buf = { .ptr = replyStart + BATCH_REPLY_HEADER_SIZE, .end = dst->end, },
+            .cmd = -1,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+
+        mspPostProcessFnPtr commandPostProcessFn = NULL;
+        // Batches do not nest, a batch inside one would not be bound by the outer deadline
+        const mspResult_e result = cmd == batchCmd ? MSP_RESULT_ERROR : mspProcessCommandFn(&command, &reply, &commandPostProcessFn);
+        const uint16_t replySize = result == MSP_RESULT_NO_REPLY ? 0 : sbufPtr(&reply.buf) - (replyStart + BATCH_REPLY_HEADER_SIZE);
+
+        sbufWriteU16(dst, cmd);
+        sbufWriteU8(dst, (int8_t)result);
+        sbufWriteU16(dst, replySize);
+        sbufAdvance(dst, replySize);
+        commandCount++;
+
+        if (commandPostProcessFn) {
+            // Runs after the batch reply is sent, as it would after the command's own reply
+            *mspPostProcessFn = commandPostProcessFn;
+            break;
+        }
+    }
+
+    countPtr[0] = commandCount & 0xff;
+    countPtr[1] = commandCount >> 8;
+
+    return MSP_RESULT_ACK;
+}
+#endif // USE_MSP_BATCH
@@ -0,0 +1,34 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/streambuf.h"
+#include "common/time.h"
+
+#include "interface/msp.h"
+
+// Space kept free in the reply for each command. Every reply fits the reply buffer of a target without dataflash,
+// dataflash reads are clipped to the space left.
+#define MSP_BATCH_REPLY_SIZE_MAX        256
+// Longest a batch may run, even when no realtime task is about to be due
+#define MSP_BATCH_TIME_BUDGET_US        1000
+
+mspResult_e mspBatchProcess(int16_t batchCmd, sbuf_t *src, sbuf_t *dst, mspProcessCommandFnPtr mspProcessCommandFn, timeUs_t deadlineUs, mspPostProcessFnPtr *mspPostProcessFn);
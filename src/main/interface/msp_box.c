@@ -96,6 +96,8 @@ static const box_t boxes[CHECKBOX_ITEM_COUNT] = {
     { BOXACROTRAINER, "ACRO TRAINER", 47 },
     { BOXVTXCONTROLDISABLE, "DISABLE VTX CONTROL", 48},
     { BOXLAUNCHCONTROL, "LAUNCH CONTROL", 49 },
+    { BOXBLACKBOXBURST, "BLACKBOX BURST", 50 },
+    { BOXCONFIGSNAPSHOT, "CONFIG SNAPSHOT", 51 },
 };
 
 // mask of enabled IDs, calculated on startup based on enabled features. boxId_e is used as bit index
@@ -218,6 +220,9 @@ void initActiveBoxIds(void)
 #ifdef USE_FLASHFS
     BME(BOXBLACKBOXERASE);
 #endif
+#ifdef USE_BLACKBOX_BURST
+    BME(BOXBLACKBOXBURST);
+#endif
 #endif
 
     BME(BOXFPVANGLEMIX);
@@ -303,6 +308,10 @@ void initActiveBoxIds(void)
     BME(BOXLAUNCHCONTROL);
 #endif
 
+#ifdef USE_CONFIG_SNAPSHOT
+    BME(BOXCONFIGSNAPSHOT);
+#endif
+
 #undef BME
     // check that all enabled IDs are in boxes array (check may be skipped when using findBoxById() functions)
     for (boxId_e boxId = 0;  boxId < CHECKBOX_ITEM_COUNT; boxId++)
@@ -0,0 +1,230 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_MSP_DATAFLASH_STREAM
+
+#include "common/huffman.h"
+#include "common/maths.h"
+#include "common/streambuf.h"
+#include "common/utils.h"
+
+#include "io/flashfs.h"
+
+#include "msp_dataflash.h"
+
+// address, payload size and compression method, as in the MSP_DATAFLASH_READ reply
+#define DATAFLASH_STREAM_HEADER_SIZE (sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t))
+// Flash contents are fed to the encoder in chunks so an overflowing frame only gives back the last one
+#define DATAFLASH_STREAM_HUFFMAN_CHUNK_SIZE 32
+
+static struct {
+    bool active;
+    bool compress;
+    uint16_t frameSize;         // largest payload the host wants in one frame
+    uint32_t address;           // of the next byte to send
+    uint32_t endAddress;
+    uint32_t ackedAddress;      // everything before this has been received by the host
+    uint32_t window;            // bytes allowed in flight past ackedAddress
+#ifdef USE_HUFFMAN
+    uint32_t readAheadAddress;  // of readAhead[0]
+    uint16_t readAheadLength;
+#endif
+} stream;
+
+#ifdef USE_HUFFMAN
+static uint8_t readAhead[MSP_DATAFLASH_STREAM_READAHEAD_SIZE];
+#endif
+
+/**
+ * Start streaming length bytes from address, restarting any stream in progress. A host that lost a frame restarts
+ * from the end of the last one it received. Returns the number of bytes that will be sent, zero stops the stream.
+ */
+uint32_t mspDataflashStreamStart(uint32_t address, uint32_t length, uint16_t frameSize, uint32_t window, uint8_t flags)
+{
+    const uint32_t flashfsSize = flashfsGetReadableSize();
+
+    address = MIN(address, flashfsSize);
+    length = MIN(length, flashfsSize - address);
+
+    stream.active = length > 0;
+#ifdef USE_HUFFMAN
+    stream.compress = flags & MSP_DATAFLASH_STREAM_FLAG_COMPRESS;
+    stream.readAheadLength = 0;
+#else
+    stream.compress = false;
+    UNUSED(flags);
+#endif
+    stream.frameSize = frameSize ? MAX(frameSize, MSP_DATAFLASH_STREAM_MIN_FRAME_SIZE) : UINT16_MAX;
+    stream.address = address;
+    stream.endAddress = address + length;
+    stream.ackedAddress = address;
+    stream.window = window ? window : UINT32_MAX;
+
+    return length;
+}
+
+void mspDataflashStreamStop(void)
+{
+    stream.active = false;
+}
+
+void mspDataflashStreamAck(uint32_t address)
+{
+    // Only ever move forward, and never past what has been sent
+    if (address > stream.ackedAddress && address <= stream.address) {
+        stream.ackedAddress = address;
+    }
+}
+
+bool mspDataflashStreamIsActive(void)
+{
+    return stream.active;
+}
+
+#ifdef USE_HUFFMAN
+static uint32_t dataflashStreamEncode(sbuf_t *dst, int frameSpace, uint32_t readLimit)
+{
+    huffmanState_t state = {
+        .bytesWritten = 0,
+        .outByte = sbufPtr(dst) + sizeof(uint16_t) + sizeof(uint8_t) + HUFFMAN_INFO_SIZE,
+        // the encoder clears the byte after the last one it fills
+        .outBufLen = frameSpace - HUFFMAN_INFO_SIZE - 1,
+        .outBit = 0x80,
+    };
+    *state.outByte = 0;
+
+    uint32_t bytesEncoded = 0;
+    while (bytesEncoded < readLimit) {
+        const uint32_t address = stream.address + bytesEncoded;
+        if (address < stream.readAheadAddress || address >= stream.readAheadAddress + stream.readAheadLength) {
+            // One bulk read, the encoder then works from RAM while the previous frame is still being transmitted
+            const int bytesRead = flashfsReadAbs(address, readAhead, MIN(sizeof(readAhead), stream.endAddress - address));
+            stream.readAheadAddress = address;
+            stream.readAheadLength = MAX(bytesRead, 0);
+            if (stream.readAheadLength == 0) {
+                break;
+            }
+        }
+
+        const uint16_t offset = address - stream.readAheadAddress;
+        const int chunkLength = MIN(MIN(stream.readAheadLength - offset, DATAFLASH_STREAM_HUFFMAN_CHUNK_SIZE), (int)(readLimit - bytesEncoded));
+        const huffmanState_t savedState = state;
+        if (huffmanEncodeBufStreaming(&state, readAhead + offset, chunkLength, huffmanTable) == -1) {
+            // Frame is full, the chunk stays in the read-ahead for the next one
+            state = savedState;
+            break;
+        }
+        bytesEncoded += chunkLength;
+    }
+
+    if (bytesEncoded == 0) {
+        return 0;
+    }
+
+    if (state.outBit != 0x80) {
+        ++state.bytesWritten;
+    }
+
+    sbufWriteU16(dst, HUFFMAN_INFO_SIZE + state.bytesWritten);
+    sbufWriteU8(dst, HUFFMAN);
+    sbufWriteU16(dst, bytesEncoded);
+    sbufAdvance(dst, state.bytesWritten);
+
+    return bytesEncoded;
+}
+#endif
+
+static uint32_t dataflashStreamRead(sbuf_t *dst, int frameSpace, uint32_t readLimit)
+{
+    uint8_t *header = sbufPtr(dst);
+    sbufAdvance(dst, sizeof(uint16_t) + sizeof(uint8_t));
+
+    const int bytesRead = flashfsReadAbs(stream.address, sbufPtr(dst), MIN((uint32_t)frameSpace, readLimit));
+    if (bytesRead <= 0) {
+        return 0;
+    }
+    sbufAdvance(dst, bytesRead);
+
+    sbuf_t headerBuf = { .ptr = header, .end = header + sizeof(uint16_t) + sizeof(uint8_t) };
+    sbufWriteU16(&headerBuf, bytesRead);
+    sbufWriteU8(&headerBuf, NO_COMPRESSION);
+
+    return bytesRead;
+}
+
+/**
+ * Write the next frame of the stream into dst, sized to fit. Returns MSP_RESULT_ACK when a frame was written,
+ * MSP_RESULT_NO_REPLY when the window is full or there is no room, and MSP_RESULT_ERROR once the stream has ended.
+ */
+mspResult_e mspDataflashStreamFill(sbuf_t *dst)
+{
+    if (!stream.active) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const int frameSpace = MIN(sbufBytesRemaining(dst) - (int)DATAFLASH_STREAM_HEADER_SIZE, stream.frameSize);
+    if (frameSpace < MSP_DATAFLASH_STREAM_MIN_FRAME_SIZE) {
+        return MSP_RESULT_NO_REPLY;
+    }
+
+    if (stream.address == stream.endAddress) {
+        // An empty frame at the end address tells the host everything has been sent
+        sbufWriteU32(dst, stream.endAddress);
+        sbufWriteU16(dst, 0);
+        sbufWriteU8(dst, NO_COMPRESSION);
+        stream.active = false;
+
+        return MSP_RESULT_ACK;
+    }
+
+    const uint32_t bytesInFlight = stream.address - stream.ackedAddress;
+    if (bytesInFlight >= stream.window) {
+        return MSP_RESULT_NO_REPLY;
+    }
+    const uint32_t readLimit = MIN(stream.endAddress - stream.address, stream.window - bytesInFlight);
+
+    uint8_t *frameStart = sbufPtr(dst);
+    sbufWriteU32(dst, stream.address);
+
+    uint32_t bytesSent;
+#ifdef USE_HUFFMAN
+    if (stream.compress) {
+        bytesSent = dataflashStreamEncode(dst, frameSpace, readLimit);
+    } else
+#endif
+    {
+        bytesSent = dataflashStreamRead(dst, frameSpace, readLimit);
+    }
+
+    if (bytesSent == 0) {
+        // Flash not ready, try again next time
+        dst->ptr = frameStart;
+        return MSP_RESULT_NO_REPLY;
+    }
+    stream.address += bytesSent;
+
+    return MSP_RESULT_ACK;
+}
+#endif // USE_MSP_DATAFLASH_STREAM
@@ -0,0 +1,43 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/streambuf.h"
+
+#include "interface/msp.h"
+
+enum compressionType_e {
+    NO_COMPRESSION,
+    HUFFMAN
+};
+
+#define MSP_DATAFLASH_STREAM_FLAG_COMPRESS      (1 << 0)
+
+// Flash contents are fetched in reads of this size when compressing, then encoded from RAM
+#define MSP_DATAFLASH_STREAM_READAHEAD_SIZE     512
+// Smallest frame payload worth sending, always large enough to encode one chunk of the read-ahead
+#define MSP_DATAFLASH_STREAM_MIN_FRAME_SIZE     96
+
+uint32_t mspDataflashStreamStart(uint32_t address, uint32_t length, uint16_t frameSize, uint32_t window, uint8_t flags);
+void mspDataflashStreamStop(void);
+void mspDataflashStreamAck(uint32_t address);
+bool mspDataflashStreamIsActive(void);
+mspResult_e mspDataflashStreamFill(sbuf_t *dst);
@@ -0,0 +1,34 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// MSPv2 commands, these are only reachable through MSPv2 frames (native or encapsulated in MSPv1)
+
+#define MSP2_BETAFLIGHT_DATAFLASH_STREAM        0x3000  //in message  start, resume or stop streaming the dataflash contents
+#define MSP2_BETAFLIGHT_DATAFLASH_STREAM_ACK    0x3001  //in message  acknowledge streamed dataflash contents up to an address, no reply
+#define MSP2_BETAFLIGHT_DATAFLASH_STREAM_DATA   0x3002  //out message dataflash contents pushed by the FC while a stream is running
+#define MSP2_BETAFLIGHT_STREAM_SUBSCRIBE        0x3003  //in message  set the telemetry messages the FC pushes and their rates
+#define MSP2_BETAFLIGHT_STREAM_DATA             0x3004  //out message subscribed telemetry messages pushed by the FC, packed into one frame
+#define MSP2_BETAFLIGHT_BATCH                   0x3005  //in message  run several commands in one frame and reply with all of their replies
+#define MSP2_BETAFLIGHT_GET_SETTING             0x3006  //out message value of a CLI setting, addressed by index or name
+#define MSP2_BETAFLIGHT_SET_SETTING             0x3007  //in message  set a CLI setting, addressed by index or name
+#define MSP2_BETAFLIGHT_CONFIG_READ             0x3008  //out message chunk of the config image, laid out as stored in the EEPROM
+#define MSP2_BETAFLIGHT_CONFIG_WRITE            0x3009  //in message  chunk of a config image, loaded and saved once the whole image checks out
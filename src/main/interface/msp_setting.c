@@ -0,0 +1,181 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_CLI
+
+#include "common/maths.h"
+#include "common/streambuf.h"
+
+#include "config/config_snapshot.h"
+
+#include "interface/cli.h"
+#include "interface/settings.h"
+
+#include "msp_setting.h"
+
+static int mspSettingElementSize(const clivalue_t *value)
+{
+    switch (value->type & VALUE_TYPE_MASK) {
+    case VAR_UINT32:
+        return sizeof(uint32_t);
+    case VAR_UINT16:
+    case VAR_INT16:
+        return sizeof(uint16_t);
+    default:
+        return sizeof(uint8_t);
+    }
+}
+
+/*
+ * Settings are addressed by their index in valueTable, or by MSP_SETTING_BY_NAME followed by a null terminated name.
+ * Indexes only hold for one firmware build, so a host looks them up by name first.
+ */
+static const clivalue_t *mspReadSetting(sbuf_t *src, uint16_t *index)
+{
+    if (sbufBytesRemaining(src) < 2) {
+        return NULL;
+    }
+
+    *index = sbufReadU16(src);
+    if (*index != MSP_SETTING_BY_NAME) {
+        return *index < valueTableEntryCount ? &valueTable[*index] : NULL;
+    }
+
+    const char *name = (const char *)sbufPtr(src);
+    const unsigned nameLength = strnlen(name, sbufBytesRemaining(src));
+    sbufAdvance(src, MIN(nameLength + 1, (unsigned)sbufBytesRemaining(src)));
+
+    const clivalue_t *value = settingGetByName(name, nameLength);
+    if (value) {
+        *index = value - valueTable;
+    }
+    return value;
+}
+
+static uint32_t mspSettingReadScalar(const clivalue_t *value, const void *ptr)
+{
+    switch (value->type & VALUE_TYPE_MASK) {
+    case VAR_UINT32:
+        return *(const uint32_t *)ptr;
+    case VAR_UINT16:
+        return *(const uint16_t *)ptr;
+    case VAR_INT16:
+        return *(const int16_t *)ptr;
+    case VAR_INT8:
+        return *(const int8_t *)ptr;
+    default:
+        return *(const uint8_t *)ptr;
+    }
+}
+
+/*
+ * Replies with the index, type and element count of the setting, then its elements in their own size. Bits of a
+ * bitset are sent as one byte.
+ */
+mspResult_e mspSettingGet(sbuf_t *dst, sbuf_t *src)
+{
+    uint16_t index;
+    const clivalue_t *value = mspReadSetting(src, &index);
+    if (!value) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const void *ptr = cliGetValuePointer(value);
+    sbufWriteU16(dst, index);
+    sbufWriteU8(dst, value->type);
+
+    switch (value->type & VALUE_MODE_MASK) {
+    case MODE_ARRAY:
+        sbufWriteU8(dst, value->config.array.length);
+        sbufWriteData(dst, ptr, value->config.array.length * mspSettingElementSize(value));
+        break;
+    case MODE_BITSET:
+        sbufWriteU8(dst, 1);
+        sbufWriteU8(dst, (mspSettingReadScalar(value, ptr) >> value->config.bitpos) & 1);
+        break;
+    default:
+        sbufWriteU8(dst, 1);
+        sbufWriteData(dst, ptr, mspSettingElementSize(value));
+        break;
+    }
+
+    return MSP_RESULT_ACK;
+}
+
+/*
+ * Takes the setting followed by its value in the format of the MSP2_BETAFLIGHT_GET_SETTING reply elements, checked
+ * against the same limits as the CLI set command.
+ */
+mspResult_e mspSettingSet(sbuf_t *dst, sbuf_t *src)
+{
+    uint16_t index;
+    const clivalue_t *value = mspReadSetting(src, &index);
+    if (!value) {
+        return MSP_RESULT_ERROR;
+    }
+
+    if ((value->type & VALUE_MODE_MASK) == MODE_ARRAY) {
+        const int size = value->config.array.length * mspSettingElementSize(value);
+        if (sbufBytesRemaining(src) < size) {
+            return MSP_RESULT_ERROR;
+        }
+        configSnapshotTouch(value->pgn);
+        sbufReadData(src, cliGetValuePointer(value), size);
+    } else {
+        const int size = (value->type & VALUE_MODE_MASK) == MODE_BITSET ? 1 : mspSettingElementSize(value);
+        if (sbufBytesRemaining(src) < size) {
+            return MSP_RESULT_ERROR;
+        }
+
+        uint32_t newValue = 0;
+        sbufReadData(src, &newValue, size);
+        if ((value->type & VALUE_MODE_MASK) == MODE_BITSET) {
+            if (newValue > 1) {
+                return MSP_RESULT_ERROR;
+            }
+        } else if ((value->type & VALUE_MODE_MASK) == MODE_LOOKUP) {
+            const lookupTableEntry_t *tableEntry = &lookupTables[value->config.lookup.tableIndex];
+            if (newValue >= tableEntry->valueCount || !tableEntry->values[newValue]) {
+                return MSP_RESULT_ERROR;
+            }
+        } else if ((value->type & VALUE_TYPE_MASK) == VAR_UINT32) {
+            if (newValue > value->config.u32_max) {
+                return MSP_RESULT_ERROR;
+            }
+        } else {
+            const int32_t signedValue = (int32_t)mspSettingReadScalar(value, &newValue);
+            if (signedValue < value->config.minmax.min || signedValue > value->config.minmax.max) {
+                return MSP_RESULT_ERROR;
+            }
+        }
+        cliSetVar(value, newValue);
+    }
+
+    sbufWriteU16(dst, index);
+
+    return MSP_RESULT_ACK;
+}
+#endif // USE_CLI
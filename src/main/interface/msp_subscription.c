@@ -0,0 +1,162 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_MSP_SUBSCRIPTION
+
+#include "common/streambuf.h"
+#include "common/time.h"
+
+#include "drivers/time.h"
+
+#include "msp_subscription.h"
+
+// command and payload size ahead of each message
+#define SUBSCRIPTION_MESSAGE_HEADER_SIZE (sizeof(uint16_t) + sizeof(uint16_t))
+
+typedef struct mspSubscription_s {
+    int16_t cmd;
+    timeDelta_t periodUs;
+    timeUs_t nextDueUs;
+} mspSubscription_t;
+
+static mspSubscriptionSerializeFnPtr serialize;
+static mspSubscription_t subscriptions[MSP_SUBSCRIPTION_MAX_ENTRIES];
+static uint8_t subscriptionCount;
+static uint8_t nextIndex;       // packing starts here so messages left out of a full frame go first in the next one
+
+void mspSubscriptionInit(mspSubscriptionSerializeFnPtr serializeFn)
+{
+    serialize = serializeFn;
+    mspSubscriptionClear();
+}
+
+void mspSubscriptionClear(void)
+{
+    subscriptionCount = 0;
+    nextIndex = 0;
+}
+
+/**
+ * Push cmd at rateHz, replacing the rate of an existing subscription to it. A rate of zero unsubscribes.
+ * Returns false if the table is full.
+ */
+bool mspSubscriptionAdd(int16_t cmd, uint16_t rateHz)
+{
+    int index;
+    for (index = 0; index < subscriptionCount; index++) {
+        if (subscriptions[index].cmd == cmd) {
+            break;
+        }
+    }
+
+    if (rateHz == 0) {
+        if (index < subscriptionCount) {
+            subscriptionCount--;
+            memmove(&subscriptions[index], &subscriptions[index + 1], (subscriptionCount - index) * sizeof(mspSubscription_t));
+            nextIndex = 0;
+        }
+        return true;
+    }
+
+    if (index == subscriptionCount) {
+        if (subscriptionCount >= MSP_SUBSCRIPTION_MAX_ENTRIES) {
+            return false;
+        }
+        subscriptionCount++;
+    }
+
+    subscriptions[index].cmd = cmd;
+    subscriptions[index].periodUs = 1000000 / rateHz;
+    subscriptions[index].nextDueUs = micros();
+
+    return true;
+}
+
+bool mspSubscriptionIsActive(void)
+{
+    return subscriptionCount > 0;
+}
+
+/**
+ * Stream callback, packs every due message into one frame: the time followed by command, size and payload of
+ * each message. Returns MSP_RESULT_NO_REPLY when nothing is due and MSP_RESULT_ERROR once all subscriptions are gone.
+ */
+mspResult_e mspSubscriptionFill(sbuf_t *dst)
+{
+    if (subscriptionCount == 0 || !serialize) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const timeUs_t currentTimeUs = micros();
+    uint8_t * const frameStart = sbufPtr(dst);
+    int messageCount = 0;
+
+    if (sbufBytesRemaining(dst) < (int)sizeof(uint32_t)) {
+        return MSP_RESULT_NO_REPLY;
+    }
+    sbufWriteU32(dst, currentTimeUs);
+
+    const uint8_t startIndex = nextIndex;
+    for (int i = 0; i < subscriptionCount; i++) {
+        const uint8_t index = (startIndex + i) % subscriptionCount;
+        mspSubscription_t *subscription = &subscriptions[index];
+        if (cmpTimeUs(currentTimeUs, subscription->nextDueUs) < 0) {
+            continue;
+        }
+
+        if (sbufBytesRemaining(dst) < (int)(SUBSCRIPTION_MESSAGE_HEADER_SIZE + MSP_SUBSCRIPTION_MESSAGE_SIZE_MAX)) {
+            // Still due, goes first in the next frame
+            nextIndex = index;
+            break;
+        }
+
+        uint8_t * const messageStart = sbufPtr(dst);
+        sbufWriteU16(dst, subscription->cmd);
+        sbufWriteU16(dst, 0);
+        if (serialize(subscription->cmd, dst)) {
+            const uint16_t size = sbufPtr(dst) - messageStart - SUBSCRIPTION_MESSAGE_HEADER_SIZE;
+            messageStart[2] = size & 0xff;
+            messageStart[3] = size >> 8;
+            messageCount++;
+        } else {
+            dst->ptr = messageStart;
+        }
+
+        // Keep the schedule, but a message that fell behind is not sent in bursts to catch up
+        subscription->nextDueUs += subscription->periodUs;
+        if (cmpTimeUs(currentTimeUs, subscription->nextDueUs) >= 0) {
+            subscription->nextDueUs = currentTimeUs + subscription->periodUs;
+        }
+    }
+
+    if (messageCount == 0) {
+        dst->ptr = frameStart;
+        return MSP_RESULT_NO_REPLY;
+    }
+
+    return MSP_RESULT_ACK;
+}
+#endif // USE_MSP_SUBSCRIPTION
@@ -0,0 +1,38 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/streambuf.h"
+
+#include "interface/msp.h"
+
+#define MSP_SUBSCRIPTION_MAX_ENTRIES        16
+// Only messages whose reply never exceeds this can be subscribed to, so a due message is packed without a size check
+#define MSP_SUBSCRIPTION_MESSAGE_SIZE_MAX   64
+
+// Writes the reply to cmd, returns false if it can not be produced
+typedef bool (*mspSubscriptionSerializeFnPtr)(int16_t cmd, sbuf_t *dst);
+
+void mspSubscriptionInit(mspSubscriptionSerializeFnPtr serializeFn);
+void mspSubscriptionClear(void);
+bool mspSubscriptionAdd(int16_t cmd, uint16_t rateHz);
+bool mspSubscriptionIsActive(void);
+mspResult_e mspSubscriptionFill(sbuf_t *dst);
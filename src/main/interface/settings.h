@@ -39,6 +39,10 @@ typedef enum {
 #ifdef USE_BLACKBOX
     TABLE_BLACKBOX_DEVICE,
     TABLE_BLACKBOX_MODE,
+#ifdef USE_BLACKBOX_COLUMNAR
+    TABLE_BLACKBOX_FORMAT,
+#endif
+    TABLE_BLACKBOX_FIELD_RATE,
 #endif
     TABLE_CURRENT_METER,
     TABLE_VOLTAGE_METER,
@@ -202,6 +206,8 @@ extern const lookupTableEntry_t lookupTables[];
 extern const uint16_t valueTableEntryCount;
 
 extern const clivalue_t valueTable[];
+
+const clivalue_t *settingGetByName(const char *name, unsigned nameLength);
 //extern const uint8_t lookupTablesEntryCount;
 
 extern const char * const lookupTableGyroHardware[];
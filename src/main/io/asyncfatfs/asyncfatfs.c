@@ -92,6 +92,8 @@
 #define AFATFS_FILE_MODE_CREATE           16
 // The file's directory entry should be locked in cache so we can read it with no latency:
 #define AFATFS_FILE_MODE_RETAIN_DIRECTORY 32
+// Contiguous file takes superclusters from the freefile in large runs and gives the unused ones back on close:
+#define AFATFS_FILE_MODE_PREALLOCATE      64
 
 // Open the cache sector for read access (it will be read from disk)
 #define AFATFS_CACHE_READ         1
@@ -110,6 +112,15 @@
 // When allocating a freefile, leave this many clusters un-allocated for regular files to use
 #define AFATFS_FREEFILE_LEAVE_CLUSTERS 100
 
+/*
+ * How much space a file opened in preallocated mode takes from the freefile at a time. Between these allocations the
+ * file is written as one run of consecutive sectors with no FAT or directory updates. If power is lost, the file is
+ * left claiming up to this much space beyond its data.
+ */
+#ifndef AFATFS_PREALLOCATE_SIZE
+#define AFATFS_PREALLOCATE_SIZE (64 * 1024 * 1024)
+#endif
+
 // Filename in 8.3 format:
 #define AFATFS_FREESPACE_FILENAME "FREESPAC.E"
 
@@ -259,6 +270,7 @@ typedef enum {
 
 typedef struct afatfsAppendSupercluster_t {
     uint32_t previousCluster;
+    uint32_t superclusterCount;
     uint32_t fatRewriteStartCluster;
     uint32_t fatRewriteEndCluster;
     afatfsAppendSuperclusterPhase_e phase;
@@ -327,8 +339,23 @@ typedef struct afatfsDeleteFile_t {
     afatfsCallback_t callback;
 } afatfsUnlinkFile_t;
 
+typedef enum {
+    AFATFS_CLOSE_FILE_PHASE_INITIAL = 0,
+#ifdef AFATFS_USE_FREEFILE
+    AFATFS_CLOSE_FILE_PHASE_TERMINATE_FAT_CHAIN = 0,
+    AFATFS_CLOSE_FILE_PHASE_ERASE_UNUSED_FAT_CHAIN,
+    AFATFS_CLOSE_FILE_PHASE_PREPEND_TO_FREEFILE,
+#endif
+    AFATFS_CLOSE_FILE_PHASE_UPDATE_DIRECTORY
+} afatfsCloseFilePhase_e;
+
 typedef struct afatfsCloseFile_t {
     afatfsCallback_t callback;
+#ifdef AFATFS_USE_FREEFILE
+    uint32_t unusedStartCluster; // First of the preallocated superclusters to give back to the freefile
+    uint32_t fatRewriteStartCluster;
+#endif
+    afatfsCloseFilePhase_e phase;
 } afatfsCloseFile_t;
 
 typedef enum {
@@ -1668,9 +1695,9 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
 
             // We can go ahead and write to that space before the FAT and directory are updated
             file->cursorCluster = afatfs.freeFile.firstCluster;
-            file->physicalSize += afatfs_superClusterSize();
+            file->physicalSize += opState->superclusterCount * afatfs_superClusterSize();
 
-            /* Remove the first supercluster from the freefile
+            /* Remove the first superclusters from the freefile
              *
              * Even if the freefile becomes empty, we still don't set its first cluster to zero. This is so that
              * afatfs_fileGetNextCluster() can tell where a contiguous file ends (at the start of the freefile).
@@ -1678,13 +1705,13 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
              * Note that normally the freefile can't become empty because it is allocated as a non-integer number
              * of superclusters to avoid precisely this situation.
              */
-            afatfs.freeFile.firstCluster += afatfs_fatEntriesPerSector();
-            afatfs.freeFile.logicalSize -= afatfs_superClusterSize();
-            afatfs.freeFile.physicalSize -= afatfs_superClusterSize();
+            afatfs.freeFile.firstCluster += opState->superclusterCount * afatfs_fatEntriesPerSector();
+            afatfs.freeFile.logicalSize -= opState->superclusterCount * afatfs_superClusterSize();
+            afatfs.freeFile.physicalSize -= opState->superclusterCount * afatfs_superClusterSize();
 
-            // The new supercluster needs to have its clusters chained contiguously and marked with a terminator at the end
+            // The new superclusters need to have their clusters chained contiguously and marked with a terminator at the end
             opState->fatRewriteStartCluster = file->cursorCluster;
-            opState->fatRewriteEndCluster = opState->fatRewriteStartCluster + afatfs_fatEntriesPerSector();
+            opState->fatRewriteEndCluster = afatfs.freeFile.firstCluster;
 
             if (opState->previousCluster == 0) {
                 // This is the new first cluster in the file so we need to update the directory entry
@@ -1732,7 +1759,8 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
 
 /**
  * Attempt to queue up an operation to append the first supercluster of the freefile to the given `file` (file's cursor
- * must be at end-of-file).
+ * must be at end-of-file). A file in preallocated mode takes up to AFATFS_PREALLOCATE_SIZE worth of superclusters
+ * instead.
  *
  * The new cluster number will be set into the file's cursorCluster.
  *
@@ -1765,6 +1793,13 @@ static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file)
     opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT;
     opState->previousCluster = file->cursorPreviousCluster;
 
+    if ((file->mode & AFATFS_FILE_MODE_PREALLOCATE) != 0) {
+        opState->superclusterCount = MIN(afatfs.freeFile.logicalSize, (uint32_t) AFATFS_PREALLOCATE_SIZE) / superClusterSize;
+        opState->superclusterCount = MAX(opState->superclusterCount, 1U);
+    } else {
+        opState->superclusterCount = 1;
+    }
+
     return afatfs_appendSuperclusterContinue(file);
 }
 
@@ -1896,11 +1931,12 @@ static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file)
             cacheFlags |= AFATFS_CACHE_READ;
         }
 
-        // In contiguous append mode, we'll pre-erase the whole supercluster
+        /*
+         * In contiguous append mode, we'll pre-erase the rest of the allocated space (the rest of the supercluster, or
+         * of the preallocated run of superclusters)
+         */
         if ((file->mode & (AFATFS_FILE_MODE_APPEND | AFATFS_FILE_MODE_CONTIGUOUS)) == (AFATFS_FILE_MODE_APPEND | AFATFS_FILE_MODE_CONTIGUOUS)) {
-            uint32_t cursorOffsetInSupercluster = file->cursorOffset & (afatfs_superClusterSize() - 1);
-
-            eraseBlockCount = afatfs_fatEntriesPerSector() * afatfs.sectorsPerCluster - cursorOffsetInSupercluster / AFATFS_SECTOR_SIZE;
+            eraseBlockCount = (file->physicalSize - offsetOfStartOfSector) / AFATFS_SECTOR_SIZE;
         } else {
             eraseBlockCount = 0;
         }
@@ -2690,7 +2726,7 @@ static void afatfs_createFileContinue(afatfsFile_t *file)
 #endif
             } else {
                 // We can't guarantee that the existing file contents are contiguous
-                file->mode &= ~AFATFS_FILE_MODE_CONTIGUOUS;
+                file->mode &= ~(AFATFS_FILE_MODE_CONTIGUOUS | AFATFS_FILE_MODE_PREALLOCATE);
 
                 // Seek to the end of the file if it is in append mode
                 if ((file->mode & AFATFS_FILE_MODE_APPEND) != 0) {
@@ -2834,6 +2870,68 @@ static void afatfs_fcloseContinue(afatfsFilePtr_t file)
 {
     afatfsCacheBlockDescriptor_t *descriptor;
     afatfsCloseFile_t *opState = &file->operation.state.closeFile;
+#ifdef AFATFS_USE_FREEFILE
+    afatfsOperationStatus_e status;
+    uint32_t freeFileGrow;
+#endif
+
+    doMore:
+
+    switch (opState->phase) {
+#ifdef AFATFS_USE_FREEFILE
+        case AFATFS_CLOSE_FILE_PHASE_TERMINATE_FAT_CHAIN:
+            if (opState->unusedStartCluster == 0) {
+                // Nothing to give back to the freefile
+                opState->phase = AFATFS_CLOSE_FILE_PHASE_UPDATE_DIRECTORY;
+                goto doMore;
+            }
+
+            file->physicalSize = roundUpTo(file->logicalSize, afatfs_superClusterSize());
+
+            if (opState->fatRewriteStartCluster == opState->unusedStartCluster) {
+                // Nothing was written, so the file gives up all of its clusters and we must drop them from its directory entry first
+                file->firstCluster = 0;
+                status = afatfs_saveDirectoryEntry(file, AFATFS_SAVE_DIRECTORY_NORMAL);
+            } else {
+                // Terminate the file's chain at the end of the last supercluster which holds data
+                status = afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_TERMINATED_CHAIN, &opState->fatRewriteStartCluster, opState->unusedStartCluster);
+            }
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->fatRewriteStartCluster = opState->unusedStartCluster;
+                opState->phase = AFATFS_CLOSE_FILE_PHASE_ERASE_UNUSED_FAT_CHAIN;
+                goto doMore;
+            }
+        break;
+        case AFATFS_CLOSE_FILE_PHASE_ERASE_UNUSED_FAT_CHAIN:
+            // Prepare the unused clusters to be added back on to the beginning of the freefile
+            status = afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_UNTERMINATED_CHAIN, &opState->fatRewriteStartCluster, afatfs.freeFile.firstCluster);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                freeFileGrow = (afatfs.freeFile.firstCluster - opState->unusedStartCluster) * afatfs_clusterSize();
+
+                afatfs.freeFile.firstCluster = opState->unusedStartCluster;
+                afatfs.freeFile.logicalSize += freeFileGrow;
+                afatfs.freeFile.physicalSize += freeFileGrow;
+
+                opState->phase = AFATFS_CLOSE_FILE_PHASE_PREPEND_TO_FREEFILE;
+                goto doMore;
+            }
+        break;
+        case AFATFS_CLOSE_FILE_PHASE_PREPEND_TO_FREEFILE:
+            if (afatfs_saveDirectoryEntry(&afatfs.freeFile, AFATFS_SAVE_DIRECTORY_NORMAL) == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_CLOSE_FILE_PHASE_UPDATE_DIRECTORY;
+                goto doMore;
+            }
+        break;
+#endif
+        case AFATFS_CLOSE_FILE_PHASE_UPDATE_DIRECTORY:
+        break;
+    }
+
+    if (opState->phase != AFATFS_CLOSE_FILE_PHASE_UPDATE_DIRECTORY) {
+        return;
+    }
 
     /*
      * Directories don't update their parent directory entries over time, because their fileSize field in the directory
@@ -2895,8 +2993,26 @@ bool afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback)
     } else {
         afatfs_fileUpdateFilesize(file);
 
+        afatfsCloseFile_t *opState = &file->operation.state.closeFile;
+
         file->operation.operation = AFATFS_FILE_OPERATION_CLOSE;
-        file->operation.state.closeFile.callback = callback;
+        opState->callback = callback;
+        opState->phase = AFATFS_CLOSE_FILE_PHASE_INITIAL;
+
+#ifdef AFATFS_USE_FREEFILE
+        opState->unusedStartCluster = 0;
+
+        if ((file->mode & AFATFS_FILE_MODE_PREALLOCATE) != 0 && file->firstCluster != 0) {
+            // Superclusters past the one holding the end of the data go back to the freefile (which begins where we end)
+            uint32_t usedEndCluster = file->firstCluster + roundUpTo(file->logicalSize, afatfs_superClusterSize()) / afatfs_clusterSize();
+
+            if (usedEndCluster < afatfs.freeFile.firstCluster) {
+                opState->unusedStartCluster = usedEndCluster;
+                opState->fatRewriteStartCluster = MAX(usedEndCluster - afatfs_fatEntriesPerSector(), file->firstCluster);
+            }
+        }
+#endif
+
         afatfs_fcloseContinue(file);
         return true;
     }
@@ -2986,6 +3102,10 @@ bool afatfs_chdir(afatfsFilePtr_t directory)
  * ws   If the file is already non-empty or freefile support is not compiled in then it will fall back to non-contiguous
  *      operation.
  *
+ * ap - Like "as", but the file takes up to AFATFS_PREALLOCATE_SIZE of the freefile at a time, so that it can be
+ *      streamed to the card as one long multiple-block write with no FAT or directory updates in between. The unused
+ *      superclusters are given back to the freefile when the file is closed.
+ *
  * All other mode strings are illegal. In particular, don't add "b" to the end of the mode string.
  *
  * Returns false if the the open failed really early (out of file handles).
@@ -3018,6 +3138,11 @@ bool afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t c
         case 's':
 #ifdef AFATFS_USE_FREEFILE
             fileMode |= AFATFS_FILE_MODE_CONTIGUOUS | AFATFS_FILE_MODE_RETAIN_DIRECTORY;
+#endif
+        break;
+        case 'p':
+#ifdef AFATFS_USE_FREEFILE
+            fileMode |= AFATFS_FILE_MODE_CONTIGUOUS | AFATFS_FILE_MODE_RETAIN_DIRECTORY | AFATFS_FILE_MODE_PREALLOCATE;
 #endif
         break;
     }
@@ -36,44 +36,122 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
 #include "drivers/flash.h"
 
 #include "io/flashfs.h"
+#include "io/flashfs_log.h"
 
-static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
+// How long a synchronous write waits for the device to finish a page program before issuing the next one anyway
+#define FLASHFS_PROGRAM_TIMEOUT_MILLIS 6
 
-/* The position of our head and tail in the circular flash write buffer.
- *
- * The head is the index that a byte would be inserted into on writing, while the tail is the index of the
- * oldest byte that has yet to be written to flash.
+/*
+ * Writes are gathered in a pair of buffers. One buffer accepts new data while the other is being programmed into
+ * the device, and they swap roles when the filling buffer is full and the programming one has been handed over
+ * completely.
  *
- * When the circular buffer is empty, head == tail
+ * Each buffer ends on a FLASHFS_WRITE_BUFFER_SIZE boundary of the device address space, so with a buffer size of
+ * several pages every full buffer is programmed as a run of whole, back-to-back pages.
  */
-static uint8_t bufferHead = 0, bufferTail = 0;
+typedef struct flashfsWriteBuffer_s {
+    uint8_t data[FLASHFS_WRITE_BUFFER_SIZE];
+    uint32_t address;   // Device address of data[0]
+    uint16_t length;    // Bytes held
+    uint16_t capacity;  // Bytes the buffer may hold before it reaches the next buffer boundary
+} flashfsWriteBuffer_t;
+
+typedef enum {
+    FLASHFS_PROGRAM_IDLE = 0,
+    FLASHFS_PROGRAM_BUSY    // The programming buffer still has pages to hand to the device
+} flashfsProgramState_e;
 
-// The position of the buffer's tail in the overall flash address space:
+static flashfsWriteBuffer_t flashfsWriteBuffer[2];
+
+static uint8_t fillBufferIndex = 0;
+static flashfsProgramState_e programState = FLASHFS_PROGRAM_IDLE;
+
+// Bytes of the programming buffer that the device has already been given
+static uint16_t programOffset = 0;
+
+// The device address the next programmed byte goes to:
 static uint32_t tailAddress = 0;
 
-static void flashfsClearBuffer(void)
+/**
+ * In log-structured mode positions are offsets into the ring of log data, which wrap around at its end.
+ */
+static uint32_t flashfsWrapAddress(uint32_t address)
+{
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled() && address >= flashfsLogAreaSize()) {
+        return address - flashfsLogAreaSize();
+    }
+#endif
+
+    return address;
+}
+
+static uint32_t flashfsPhysicalAddress(uint32_t address)
+{
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        return flashfsLogPhysicalAddress(address);
+    }
+#endif
+
+    return address;
+}
+
+static flashfsWriteBuffer_t *flashfsFillBuffer(void)
+{
+    return &flashfsWriteBuffer[fillBufferIndex];
+}
+
+static flashfsWriteBuffer_t *flashfsProgramBuffer(void)
 {
-    bufferTail = bufferHead = 0;
+    return &flashfsWriteBuffer[fillBufferIndex ^ 1];
+}
+
+static void flashfsStartFillBuffer(uint32_t address)
+{
+    flashfsWriteBuffer_t *buffer = flashfsFillBuffer();
+
+    buffer->address = flashfsWrapAddress(address);
+    buffer->length = 0;
+    buffer->capacity = FLASHFS_WRITE_BUFFER_SIZE - address % FLASHFS_WRITE_BUFFER_SIZE;
 }
 
 static bool flashfsBufferIsEmpty(void)
 {
-    return bufferTail == bufferHead;
+    return programState == FLASHFS_PROGRAM_IDLE && flashfsFillBuffer()->length == 0;
 }
 
+/**
+ * Throw away everything buffered and continue writing from the given address.
+ */
 static void flashfsSetTailAddress(uint32_t address)
 {
+    programState = FLASHFS_PROGRAM_IDLE;
+    programOffset = 0;
     tailAddress = address;
+
+    flashfsStartFillBuffer(address);
 }
 
 void flashfsEraseCompletely(void)
 {
-    flashEraseCompletely();
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        // Only the index is erased, the data sectors are recycled in the background
+        flashfsSetTailAddress(flashfsLogFormat(flashfsGetOffset()));
+        return;
+    }
+#endif
 
-    flashfsClearBuffer();
+    flashEraseCompletely();
 
     flashfsSetTailAddress(0);
 }
@@ -125,20 +203,15 @@ uint32_t flashfsGetSize(void)
     return flashGetGeometry()->totalSize;
 }
 
-static uint32_t flashfsTransmitBufferUsed(void)
-{
-    if (bufferHead >= bufferTail)
-        return bufferHead - bufferTail;
-
-    return FLASHFS_WRITE_BUFFER_SIZE - bufferTail + bufferHead;
-}
-
 /**
  * Get the size of the largest single write that flashfs could ever accept without blocking or data loss.
+ *
+ * The filling buffer always has at least one byte free once the other buffer is idle, so a whole buffer's worth
+ * always fits eventually.
  */
 uint32_t flashfsGetWriteBufferSize(void)
 {
-    return FLASHFS_WRITE_BUFFER_USABLE;
+    return FLASHFS_WRITE_BUFFER_SIZE;
 }
 
 /**
@@ -146,7 +219,10 @@ uint32_t flashfsGetWriteBufferSize(void)
  */
 uint32_t flashfsGetWriteBufferFreeSpace(void)
 {
-    return flashfsGetWriteBufferSize() - flashfsTransmitBufferUsed();
+    const flashfsWriteBuffer_t *buffer = flashfsFillBuffer();
+
+    // A full filling buffer always ends on a buffer boundary, so the idle buffer takes over with its whole capacity
+    return buffer->capacity - buffer->length + (programState == FLASHFS_PROGRAM_IDLE ? FLASHFS_WRITE_BUFFER_SIZE : 0);
 }
 
 const flashGeometry_t* flashfsGetGeometry(void)
@@ -155,127 +231,70 @@ const flashGeometry_t* flashfsGetGeometry(void)
 }
 
 /**
- * Write the given buffers to flash sequentially at the current tail address, advancing the tail address after
- * each write.
- *
- * In synchronous mode, waits for the flash to become ready before writing so that every byte requested can be written.
+ * Hand the next page (or the part of it that the programming buffer holds) to the device.
  *
- * In asynchronous mode, if the flash is busy, then the write is aborted and the routine returns immediately.
- * In this case the returned number of bytes written will be less than the total amount requested.
- *
- * Modifies the supplied buffer pointers and sizes to reflect how many bytes remain in each of them.
- *
- * bufferCount: the number of buffers provided
- * buffers: an array of pointers to the beginning of buffers
- * bufferSizes: an array of the sizes of those buffers
- * sync: true if we should wait for the device to be idle before writes, otherwise if the device is busy the
- *       write will be aborted and this routine will return immediately.
- *
- * Returns the number of bytes written
+ * The device is polled for its status once. If it's still busy with the previous program or erase, an asynchronous
+ * step returns straight away, while a synchronous one waits (with a timeout) for it to become ready.
  */
-static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, bool sync)
+static void flashfsProgramStep(bool sync)
 {
-    uint32_t bytesTotal = 0;
-
-    int i;
-
-    for (i = 0; i < bufferCount; i++) {
-        bytesTotal += bufferSizes[i];
-    }
-
-    if (!sync && !flashIsReady()) {
-        return 0;
+    if (programState == FLASHFS_PROGRAM_IDLE) {
+        return;
     }
 
-    uint32_t bytesTotalRemaining = bytesTotal;
-
-    uint16_t pageSize = flashfsGetGeometry()->pageSize;
-
-    while (bytesTotalRemaining > 0) {
-        uint32_t bytesTotalThisIteration;
-        uint32_t bytesRemainThisIteration;
-
-        /*
-         * Each page needs to be saved in a separate program operation, so
-         * if we would cross a page boundary, only write up to the boundary in this iteration:
-         */
-        if (tailAddress % pageSize + bytesTotalRemaining > pageSize) {
-            bytesTotalThisIteration = pageSize - tailAddress % pageSize;
-        } else {
-            bytesTotalThisIteration = bytesTotalRemaining;
-        }
-
-        // Are we at EOF already? Abort.
-        if (flashfsIsEOF()) {
-            // May as well throw away any buffered data
-            flashfsClearBuffer();
+    bool ready = flashIsReady();
 
-            break;
+    if (!ready) {
+        if (!sync) {
+            return;
         }
+        ready = flashWaitForReady(FLASHFS_PROGRAM_TIMEOUT_MILLIS);
+    }
 
-        flashPageProgramBegin(tailAddress);
-
-        bytesRemainThisIteration = bytesTotalThisIteration;
-
-        for (i = 0; i < bufferCount; i++) {
-            if (bufferSizes[i] > 0) {
-                // Is buffer larger than our write limit? Write our limit out of it
-                if (bufferSizes[i] >= bytesRemainThisIteration) {
-                    flashPageProgramContinue(buffers[i], bytesRemainThisIteration);
-
-                    buffers[i] += bytesRemainThisIteration;
-                    bufferSizes[i] -= bytesRemainThisIteration;
+#ifdef USE_FLASHFS_LOG
+    // Index updates and erasing ahead of the data come first, and are never issued to a busy device
+    if (flashfsLogIsEnabled() && (!ready || flashfsLogService(tailAddress))) {
+        return;
+    }
+#endif
 
-                    bytesRemainThisIteration = 0;
-                    break;
-                } else {
-                    // We'll still have more to write after finishing this buffer off
-                    flashPageProgramContinue(buffers[i], bufferSizes[i]);
+    const flashfsWriteBuffer_t *buffer = flashfsProgramBuffer();
 
-                    bytesRemainThisIteration -= bufferSizes[i];
+    // Are we at EOF already? May as well throw away any buffered data
+    if (flashfsIsEOF()) {
+        programState = FLASHFS_PROGRAM_IDLE;
+        flashfsStartFillBuffer(flashfsFillBuffer()->address);
 
-                    buffers[i] += bufferSizes[i];
-                    bufferSizes[i] = 0;
-                }
-            }
-        }
+        return;
+    }
 
-        flashPageProgramFinish();
+    // Each page needs to be saved in a separate program operation, so don't cross a page boundary
+    const uint16_t pageSize = flashfsGetGeometry()->pageSize;
+    const uint32_t length = MIN((uint32_t)(buffer->length - programOffset), pageSize - tailAddress % pageSize);
 
-        bytesTotalRemaining -= bytesTotalThisIteration;
+    flashPageProgram(flashfsPhysicalAddress(tailAddress), buffer->data + programOffset, length);
 
-        // Advance the cursor in the file system to match the bytes we wrote
-        flashfsSetTailAddress(tailAddress + bytesTotalThisIteration);
+    programOffset += length;
+    tailAddress = flashfsWrapAddress(tailAddress + length);
 
-        /*
-         * We'll have to wait for that write to complete before we can issue the next one, so if
-         * the user requested asynchronous writes, break now.
-         */
-        if (!sync)
-            break;
+    if (programOffset == buffer->length) {
+        programState = FLASHFS_PROGRAM_IDLE;
     }
-
-    return bytesTotal - bytesTotalRemaining;
 }
 
-/*
- * Since the buffered data might wrap around the end of the circular buffer, we can have two segments of data to write,
- * an initial portion and a possible wrapped portion.
- *
- * This routine will fill the details of those buffers into the provided arrays, which must be at least 2 elements long.
+/**
+ * Swap the buffers over, so the filling buffer is programmed while the idle one starts accepting data.
  */
-static void flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t bufferSizes[])
+static void flashfsQueueFillBuffer(void)
 {
-    buffers[0] = flashWriteBuffer + bufferTail;
-    buffers[1] = flashWriteBuffer + 0;
+    const flashfsWriteBuffer_t *buffer = flashfsFillBuffer();
+    const uint32_t nextAddress = buffer->address + buffer->length;
 
-    if (bufferHead >= bufferTail) {
-        bufferSizes[0] = bufferHead - bufferTail;
-        bufferSizes[1] = 0;
-    } else {
-        bufferSizes[0] = FLASHFS_WRITE_BUFFER_SIZE - bufferTail;
-        bufferSizes[1] = bufferHead;
-    }
+    programOffset = 0;
+    programState = FLASHFS_PROGRAM_BUSY;
+    fillBufferIndex ^= 1;
+
+    flashfsStartFillBuffer(nextAddress);
 }
 
 /**
@@ -283,76 +302,80 @@ static void flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t buffer
  */
 uint32_t flashfsGetOffset(void)
 {
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
-
     // Dirty data in the buffers contributes to the offset
 
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+    const flashfsWriteBuffer_t *buffer = flashfsFillBuffer();
 
-    return tailAddress + bufferSizes[0] + bufferSizes[1];
+    return flashfsWrapAddress(buffer->address + buffer->length);
 }
 
 /**
- * Called after bytes have been written from the buffer to advance the position of the tail by the given amount.
+ * Get the number of bytes stored on the volume, which readers find from address zero. In log-structured mode that's
+ * the logs back to back, rather than the ring and its index.
  */
-static void flashfsAdvanceTailInBuffer(uint32_t delta)
+uint32_t flashfsGetUsedSize(void)
 {
-    bufferTail += delta;
-
-    // Wrap tail around the end of the buffer
-    if (bufferTail >= FLASHFS_WRITE_BUFFER_SIZE) {
-        bufferTail -= FLASHFS_WRITE_BUFFER_SIZE;
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        return flashfsLogUsedSize(flashfsGetOffset());
     }
+#endif
 
-    if (flashfsBufferIsEmpty()) {
-        flashfsClearBuffer(); // Bring buffer pointers back to the start to be tidier
+    return flashfsGetOffset();
+}
+
+/**
+ * Get the size of the volume as readers see it, the whole device, or just the logs in log-structured mode.
+ */
+uint32_t flashfsGetReadableSize(void)
+{
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        return flashfsGetUsedSize();
     }
+#endif
+
+    return flashfsGetSize();
 }
 
 /**
- * If the flash is ready to accept writes, flush the buffer to it.
+ * Advance any programming in progress and, once the device has taken the whole programming buffer, queue the filling
+ * buffer if it's full. A partially filled buffer is only queued when `force` is set, so that buffers normally reach
+ * the device as whole runs of pages.
  *
- * Returns true if all data in the buffer has been flushed to the device, or false if
- * there is still data to be written (call flush again later).
+ * Never waits for the device.
+ *
+ * Returns true if all data in the buffers has been handed to the device, or false if there is still data to be
+ * written (call flush again later).
  */
-bool flashfsFlushAsync(void)
+bool flashfsFlushAsync(bool force)
 {
-    if (flashfsBufferIsEmpty()) {
-        return true; // Nothing to flush
-    }
+    flashfsProgramStep(false);
 
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
-    uint32_t bytesWritten;
+    const flashfsWriteBuffer_t *buffer = flashfsFillBuffer();
 
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 2, false);
-    flashfsAdvanceTailInBuffer(bytesWritten);
+    if (programState == FLASHFS_PROGRAM_IDLE && buffer->length > 0 && (force || buffer->length == buffer->capacity)) {
+        flashfsQueueFillBuffer();
+        flashfsProgramStep(false);
+    }
 
     return flashfsBufferIsEmpty();
 }
 
 /**
- * Wait for the flash to become ready and begin flushing any buffered data to flash.
+ * Wait for the flash to become ready and hand all buffered data to it.
  *
- * The flash will still be busy some time after this sync completes, but space will
- * be freed up to accept more writes in the write buffer.
+ * The flash will still be busy some time after this sync completes, but both buffers will be free to accept more
+ * writes.
  */
 void flashfsFlushSync(void)
 {
-    if (flashfsBufferIsEmpty()) {
-        return; // Nothing to flush
+    while (!flashfsBufferIsEmpty()) {
+        if (programState == FLASHFS_PROGRAM_IDLE) {
+            flashfsQueueFillBuffer();
+        }
+        flashfsProgramStep(true);
     }
-
-    uint8_t const * buffers[2];
-    uint32_t bufferSizes[2];
-
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    flashfsWriteBuffers(buffers, bufferSizes, 2, true);
-
-    // We've written our entire buffer now:
-    flashfsClearBuffer();
 }
 
 void flashfsSeekAbs(uint32_t offset)
@@ -370,103 +393,55 @@ void flashfsSeekRel(int32_t offset)
 }
 
 /**
- * Write the given byte asynchronously to the flash. If the buffer overflows, data is silently discarded.
+ * Write the given byte asynchronously to the flash. If the buffers are full, the byte is silently discarded.
  */
 void flashfsWriteByte(uint8_t byte)
 {
-    flashWriteBuffer[bufferHead++] = byte;
-
-    if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
-        bufferHead = 0;
-    }
-
-    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        flashfsFlushAsync();
-    }
+    flashfsWrite(&byte, 1, false);
 }
 
 /**
  * Write the given buffer to the flash either synchronously or asynchronously depending on the 'sync' parameter.
  *
- * If writing asynchronously, data will be silently discarded if the buffer overflows.
- * If writing synchronously, the routine will block waiting for the flash to become ready so will never drop data.
+ * If writing asynchronously, the whole write is silently discarded if it doesn't fit in the buffers.
+ * If writing synchronously, the routine will block waiting for the flash to take buffered pages, so will never drop
+ * data.
  */
 void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
 {
-    uint8_t const * buffers[3];
-    uint32_t bufferSizes[3];
-
-    // There could be two dirty buffers to write out already:
-    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-
-    // Plus the buffer the user supplied:
-    buffers[2] = data;
-    bufferSizes[2] = len;
-
-    /*
-     * Would writing this data to our buffer cause our buffer to reach the flush threshold? If so try to write through
-     * to the flash now
-     */
-    if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        uint32_t bytesWritten;
-
-        // Attempt to write all three buffers through to the flash asynchronously
-        bytesWritten = flashfsWriteBuffers(buffers, bufferSizes, 3, false);
-
-        if (bufferSizes[0] == 0 && bufferSizes[1] == 0) {
-            // We wrote all the data that was previously buffered
-            flashfsClearBuffer();
-
-            if (bufferSizes[2] == 0) {
-                // And we wrote all the data the user supplied! Job done!
-                return;
-            }
-        } else {
-            // We only wrote a portion of the old data, so advance the tail to remove the bytes we did write from the buffer
-            flashfsAdvanceTailInBuffer(bytesWritten);
-        }
-
-        // Is the remainder of the data to be written too big to fit in the buffers?
-        if (bufferSizes[0] + bufferSizes[1] + bufferSizes[2] > FLASHFS_WRITE_BUFFER_USABLE) {
-            if (sync) {
-                // Write it through synchronously
-                flashfsWriteBuffers(buffers, bufferSizes, 3, true);
-                flashfsClearBuffer();
-            } else {
-                /*
-                 * Silently drop the data the user asked to write (i.e. no-op) since we can't buffer it and they
-                 * requested async.
-                 */
-            }
+    if (!sync && len > flashfsGetWriteBufferFreeSpace()) {
+        // Try to make room, but a partial write would only corrupt the stream
+        flashfsFlushAsync(false);
 
+        if (len > flashfsGetWriteBufferFreeSpace()) {
             return;
         }
-
-        // Fall through and add the remainder of the incoming data to our buffer
-        data = buffers[2];
-        len = bufferSizes[2];
     }
 
-    // Buffer up the data the user supplied instead of writing it right away
+    while (len > 0) {
+        flashfsWriteBuffer_t *buffer = flashfsFillBuffer();
 
-    // First write the portion before we wrap around the end of the circular buffer
-    unsigned int bufferBytesBeforeWrap = FLASHFS_WRITE_BUFFER_SIZE - bufferHead;
-
-    unsigned int firstPortion = len < bufferBytesBeforeWrap ? len : bufferBytesBeforeWrap;
-
-    memcpy(flashWriteBuffer + bufferHead, data, firstPortion);
-
-    bufferHead += firstPortion;
+        if (buffer->length == buffer->capacity) {
+            if (programState == FLASHFS_PROGRAM_IDLE) {
+                flashfsQueueFillBuffer();
+            } else {
+                // Only a synchronous write can get here, the free space check guarantees an asynchronous one fits
+                flashfsProgramStep(true);
+            }
+            continue;
+        }
 
-    data += firstPortion;
-    len -= firstPortion;
+        const unsigned int bytesToCopy = MIN(len, (unsigned int)(buffer->capacity - buffer->length));
 
-    // If we wrap the head around, write the remainder to the start of the buffer (if any)
-    if (bufferHead == FLASHFS_WRITE_BUFFER_SIZE) {
-        memcpy(flashWriteBuffer + 0, data, len);
+        memcpy(buffer->data + buffer->length, data, bytesToCopy);
+        buffer->length += bytesToCopy;
 
-        bufferHead = len;
+        data += bytesToCopy;
+        len -= bytesToCopy;
     }
+
+    // Keep the device busy with whatever is ready for it
+    flashfsFlushAsync(false);
 }
 
 /**
@@ -478,6 +453,15 @@ int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
 {
     int bytesRead;
 
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        flashfsFlushSync();
+
+        // The logs are read back to back, so readers never see the index or the stale data in the ring
+        return flashfsLogReadVolume(tailAddress, address, buffer, len);
+    }
+#endif
+
     // Did caller try to read past the end of the volume?
     if (address + len > flashfsGetSize()) {
         // Truncate their request
@@ -568,9 +552,50 @@ int flashfsIdentifyStartOfFreeSpace(void)
  */
 bool flashfsIsEOF(void)
 {
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        return flashfsLogIsFull(tailAddress);
+    }
+#endif
+
     return tailAddress >= flashfsGetSize();
 }
 
+/**
+ * Mark the start of a log at the current offset, for the log-structured mode's index.
+ */
+void flashfsBeginLog(void)
+{
+#ifdef USE_FLASHFS_LOG
+    flashfsLogBegin(flashfsGetOffset());
+#endif
+}
+
+/**
+ * Mark the end of the log at the current offset, or drop it from the index if it isn't worth keeping.
+ */
+void flashfsEndLog(bool retain)
+{
+#ifdef USE_FLASHFS_LOG
+    flashfsLogEnd(flashfsGetOffset(), retain);
+#else
+    UNUSED(retain);
+#endif
+}
+
+/**
+ * Call regularly while nothing is being written. In log-structured mode this erases sectors ahead of the write
+ * position in the background, so that logging doesn't have to stop for an erase later.
+ */
+void flashfsEraseAhead(void)
+{
+#ifdef USE_FLASHFS_LOG
+    if (flashfsBufferIsEmpty()) {
+        flashfsLogEraseAhead(tailAddress);
+    }
+#endif
+}
+
 void flashfsClose(void)
 {
     switch(flashfsGetGeometry()->flashType) {
@@ -578,6 +603,7 @@ void flashfsClose(void)
         break;
 
     case FLASH_TYPE_NAND:
+        flashfsFlushSync();
         flashFlush();
 
         // Advance tailAddress to next page boundary.
@@ -595,6 +621,14 @@ void flashfsInit(void)
 {
     // If we have a flash chip present at all
     if (flashfsGetSize() > 0) {
+#ifdef USE_FLASHFS_LOG
+        const uint32_t position = flashfsLogInit();
+        if (flashfsLogIsEnabled()) {
+            // The index says where to carry on, no need to search for the free space
+            flashfsSetTailAddress(position);
+            return;
+        }
+#endif
         // Start the file pointer off at the beginning of free space so caller can start writing immediately
         flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
     }
@@ -20,17 +20,21 @@
 
 #pragma once
 
+// Size of each of the two write buffers, a power of two
+#ifdef USE_FLASHFS_PAGE_COALESCE
+// Four 256 byte pages, programmed back-to-back once the buffer is full
+#define FLASHFS_WRITE_BUFFER_SIZE 1024
+#else
 #define FLASHFS_WRITE_BUFFER_SIZE 128
-#define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
-
-// Automatically trigger a flush when this much data is in the buffer
-#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+#endif
 
 void flashfsEraseCompletely(void);
 void flashfsEraseRange(uint32_t start, uint32_t end);
 
 uint32_t flashfsGetSize(void);
 uint32_t flashfsGetOffset(void);
+uint32_t flashfsGetUsedSize(void);
+uint32_t flashfsGetReadableSize(void);
 uint32_t flashfsGetWriteBufferFreeSpace(void);
 uint32_t flashfsGetWriteBufferSize(void);
 int flashfsIdentifyStartOfFreeSpace(void);
@@ -45,7 +49,7 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync);
 
 int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 
-bool flashfsFlushAsync(void);
+bool flashfsFlushAsync(bool force);
 void flashfsFlushSync(void);
 
 void flashfsClose(void);
@@ -54,3 +58,7 @@ bool flashfsIsSupported(void);
 
 bool flashfsIsReady(void);
 bool flashfsIsEOF(void);
+
+void flashfsBeginLog(void);
+void flashfsEndLog(bool retain);
+void flashfsEraseAhead(void);
@@ -0,0 +1,878 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Log-structured flashfs layout.
+ *
+ * The first two sectors of the device hold an append-only index of the logs, and the rest of the device is a ring of
+ * log data. Sectors are erased ahead of the write position in the background while nothing is being logged, and the
+ * oldest logs are recycled as the ring comes around to them, so every data sector is erased equally often.
+ *
+ * Every index record carries the write position and the erase front (the end of the erased run ahead of the write
+ * position), so the newest record gives the state of the ring, and the logs are found by reading the index backwards
+ * from its end. When the index sector fills up the live state is written to the other one, a record at a time like any
+ * other index update, with the format record that makes it current written last. Until then the full index stays as
+ * it is, so a power loss at any point leaves a whole index on the device.
+ *
+ * Readers see the logs back to back, oldest first, as if they had been written from the start of the volume.
+ *
+ * Positions are offsets into the data area, which starts at the third sector of the device.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_FLASHFS_LOG
+
+#include "common/crc.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/flash.h"
+
+#include "io/flashfs.h"
+#include "io/flashfs_log.h"
+
+#include "pg/flash.h"
+
+#define FLASHFS_INDEX_MAGIC 0xB5
+
+// Sectors at the start of the device taking turns to hold the index
+#define FLASHFS_INDEX_SECTORS 2
+
+// Index records queued while the device is busy
+#define FLASHFS_INDEX_PENDING_MAX 4
+
+// Index records read at once while walking the index, a NOR page
+#define FLASHFS_INDEX_READ_RECORDS 16
+
+// Bytes checked at the start of a page to decide if it's erased
+#define FLASHFS_ERASED_TEST_SIZE 16
+
+typedef enum {
+    FLASHFS_INDEX_FORMAT = 1,
+    FLASHFS_INDEX_LOG_START,
+    FLASHFS_INDEX_LOG_END,
+    FLASHFS_INDEX_LOG_DELETE,
+    FLASHFS_INDEX_ERASED
+} flashfsIndexRecordType_e;
+
+typedef struct flashfsIndexRecord_s {
+    uint8_t magic;          // Erased flash reads 0xFF
+    uint8_t type;
+    uint16_t sequence;
+    uint32_t position;      // The write position, which is also the start of the log for LOG_START and its end for LOG_END
+    uint32_t eraseFront;
+    uint16_t generation;    // Of the index sector, the newer one with a valid format record is current
+    uint8_t flags;
+    uint8_t crc;
+} flashfsIndexRecord_t;
+
+STATIC_ASSERT(sizeof(flashfsIndexRecord_t) == 16, flashfsIndexRecord_t_size);
+
+typedef enum {
+    FLASHFS_FOUND_START = (1 << 0),
+    FLASHFS_FOUND_END = (1 << 1),
+    FLASHFS_FOUND_DELETED = (1 << 2)
+} flashfsFoundFlags_e;
+
+static struct {
+    bool enabled;
+    bool logOpen;
+    bool indexRewriting;    // The live state is being written to the other index sector
+    bool indexStale;        // Records were lost from the pending queue, so the index needs writing from scratch
+    bool rewriteEnd;        // The start of the log being written is in the new index, its end is next
+    uint8_t indexSector;    // Holding the current index
+    uint8_t pendingCount;
+    uint8_t logCount;
+    uint16_t sequence;      // Of the newest log
+    uint16_t generation;    // Of the current index
+    uint16_t recordCount;   // Slots in use in the current index
+    uint16_t rewriteCount;  // Slots written in the new one
+    uint16_t recordSlots;
+    uint16_t rewriteSequence;   // Of the oldest log not written to the new index yet
+    uint32_t sectorSize;
+    uint32_t areaSize;
+    uint32_t eraseAhead;
+    uint32_t eraseFront;
+    uint32_t openStart;
+    flashfsIndexRecord_t pending[FLASHFS_INDEX_PENDING_MAX];
+    flashfsLog_t logs[FLASHFS_LOG_MAX];     // Oldest first
+} flashLog;
+
+bool flashfsLogIsEnabled(void)
+{
+    return flashLog.enabled;
+}
+
+uint32_t flashfsLogAreaSize(void)
+{
+    return flashLog.areaSize;
+}
+
+uint32_t flashfsLogPhysicalAddress(uint32_t position)
+{
+    return FLASHFS_INDEX_SECTORS * flashLog.sectorSize + position;
+}
+
+static uint32_t flashfsLogIndexAddress(uint8_t sector, uint16_t slot)
+{
+    return sector * flashLog.sectorSize + slot * sizeof(flashfsIndexRecord_t);
+}
+
+static uint32_t ringAdvance(uint32_t position, uint32_t delta)
+{
+    position += delta;
+    if (position >= flashLog.areaSize) {
+        position -= flashLog.areaSize;
+    }
+
+    return position;
+}
+
+static uint32_t ringDistance(uint32_t from, uint32_t to)
+{
+    return to >= from ? to - from : to + flashLog.areaSize - from;
+}
+
+static void flashfsLogMakeRecord(flashfsIndexRecord_t *record, flashfsIndexRecordType_e type, uint16_t sequence, uint32_t position, uint8_t flags)
+{
+    memset(record, 0, sizeof(*record));
+
+    record->magic = FLASHFS_INDEX_MAGIC;
+    record->type = type;
+    record->sequence = sequence;
+    record->position = position;
+    record->eraseFront = flashLog.eraseFront;
+    record->generation = flashLog.generation;
+    record->flags = flags;
+    record->crc = crc8_dvb_s2_update(0, record, offsetof(flashfsIndexRecord_t, crc));
+}
+
+static bool flashfsLogRecordIsValid(const flashfsIndexRecord_t *record)
+{
+    return record->magic == FLASHFS_INDEX_MAGIC && record->crc == crc8_dvb_s2_update(0, record, offsetof(flashfsIndexRecord_t, crc));
+}
+
+static void flashfsLogWriteRecord(const flashfsIndexRecord_t *record)
+{
+    flashPageProgram(flashfsLogIndexAddress(flashLog.indexSector, flashLog.recordCount), (const uint8_t *)record, sizeof(*record));
+    flashLog.recordCount++;
+}
+
+static void flashfsLogQueueRecord(flashfsIndexRecordType_e type, uint16_t sequence, uint32_t position, uint8_t flags)
+{
+    if (flashLog.indexStale) {
+        // The live state written back to the index will include this change
+        return;
+    }
+
+    flashfsIndexRecord_t *record;
+
+    if (type == FLASHFS_INDEX_ERASED && flashLog.pendingCount > 0 && flashLog.pending[flashLog.pendingCount - 1].type == FLASHFS_INDEX_ERASED) {
+        // The newer erase front supersedes the queued one
+        record = &flashLog.pending[flashLog.pendingCount - 1];
+    } else if (flashLog.pendingCount < FLASHFS_INDEX_PENDING_MAX) {
+        record = &flashLog.pending[flashLog.pendingCount++];
+    } else {
+        flashLog.indexStale = true;
+        flashLog.pendingCount = 0;
+        return;
+    }
+
+    flashfsLogMakeRecord(record, type, sequence, position, flags);
+}
+
+/**
+ * Start writing the live state to the other index sector. Changes from here on are queued, and follow the live state
+ * into the new index once it's current.
+ */
+static void flashfsLogStartRewrite(void)
+{
+    flashEraseSector(flashfsLogIndexAddress(flashLog.indexSector ^ 1, 0));
+
+    flashLog.indexRewriting = true;
+    flashLog.indexStale = false;
+    flashLog.pendingCount = 0;
+    flashLog.rewriteEnd = false;
+    flashLog.rewriteSequence = flashLog.logCount > 0 ? flashLog.logs[0].sequence : flashLog.sequence + 1;
+    // The first slot is left for the format record
+    flashLog.rewriteCount = 1;
+}
+
+static bool flashfsLogIsOpen(int index)
+{
+    return flashLog.logOpen && index == flashLog.logCount - 1 && flashLog.logs[index].sequence == flashLog.sequence;
+}
+
+/**
+ * Write the next record of the live state to the new index: the start and end of each log, oldest first, then the
+ * format record in the first slot, which makes it the current index. Logs are tracked by sequence, as the table can
+ * change between records.
+ */
+static void flashfsLogRewriteIndex(uint32_t position)
+{
+    const uint8_t sector = flashLog.indexSector ^ 1;
+    flashfsIndexRecord_t record;
+
+    int index;
+    for (index = 0; index < flashLog.logCount && (int16_t)(flashLog.logs[index].sequence - flashLog.rewriteSequence) < 0; index++);
+
+    if (index == flashLog.logCount) {
+        flashLog.generation++;
+        flashfsLogMakeRecord(&record, FLASHFS_INDEX_FORMAT, flashLog.sequence, position, 0);
+        flashPageProgram(flashfsLogIndexAddress(sector, 0), (const uint8_t *)&record, sizeof(record));
+
+        flashLog.indexSector = sector;
+        flashLog.recordCount = flashLog.rewriteCount;
+        flashLog.indexRewriting = false;
+        return;
+    }
+
+    const flashfsLog_t *log = &flashLog.logs[index];
+
+    if (log->sequence != flashLog.rewriteSequence) {
+        // The log that was half written back has been recycled or deleted since
+        flashLog.rewriteSequence = log->sequence;
+        flashLog.rewriteEnd = false;
+    }
+
+    if (flashLog.rewriteEnd) {
+        flashfsLogMakeRecord(&record, FLASHFS_INDEX_LOG_END, log->sequence, ringAdvance(log->start, log->length), log->flags);
+        flashLog.rewriteSequence++;
+        flashLog.rewriteEnd = false;
+    } else {
+        flashfsLogMakeRecord(&record, FLASHFS_INDEX_LOG_START, log->sequence, log->start, log->flags);
+        if (flashfsLogIsOpen(index)) {
+            // Its end is queued like any other once it's closed
+            flashLog.rewriteSequence++;
+        } else {
+            flashLog.rewriteEnd = true;
+        }
+    }
+    flashPageProgram(flashfsLogIndexAddress(sector, flashLog.rewriteCount), (const uint8_t *)&record, sizeof(record));
+    flashLog.rewriteCount++;
+}
+
+static bool flashfsLogHasDataIn(const flashfsLog_t *log, uint32_t sector)
+{
+    return ringDistance(sector, log->start) < flashLog.sectorSize || ringDistance(log->start, sector) < log->length;
+}
+
+static void flashfsLogRemove(int index)
+{
+    flashLog.logCount--;
+    memmove(&flashLog.logs[index], &flashLog.logs[index + 1], (flashLog.logCount - index) * sizeof(flashLog.logs[0]));
+}
+
+/**
+ * Erase the sector at the erase front, recycling the logs that had data in it.
+ */
+static void flashfsLogEraseNextSector(uint32_t position)
+{
+    const uint32_t sector = flashLog.eraseFront;
+
+    flashEraseSector(flashfsLogPhysicalAddress(sector));
+    flashLog.eraseFront = ringAdvance(sector, flashLog.sectorSize);
+
+    for (int i = flashLog.logCount - 1; i >= 0; i--) {
+        if (flashfsLogHasDataIn(&flashLog.logs[i], sector)) {
+            flashfsLogRemove(i);
+        }
+    }
+
+    // Recorded once the erase completes, so an interrupted erase is never taken as done
+    flashfsLogQueueRecord(FLASHFS_INDEX_ERASED, flashLog.sequence, position, 0);
+}
+
+/**
+ * Write pending index records, one per call.
+ *
+ * Returns true if the device was given something to do.
+ */
+static bool flashfsLogServiceIndex(uint32_t position)
+{
+    if (flashLog.indexRewriting) {
+        flashfsLogRewriteIndex(position);
+        return true;
+    }
+
+    if (flashLog.indexStale || (flashLog.pendingCount > 0 && flashLog.recordCount >= flashLog.recordSlots)) {
+        flashfsLogStartRewrite();
+        return true;
+    }
+
+    if (flashLog.pendingCount > 0) {
+        flashfsLogWriteRecord(&flashLog.pending[0]);
+
+        flashLog.pendingCount--;
+        memmove(&flashLog.pending[0], &flashLog.pending[1], flashLog.pendingCount * sizeof(flashLog.pending[0]));
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Called by flashfs when the device is ready and data is about to be programmed at the given position. Index
+ * records take priority, then the sector at the position is erased if it hasn't been already.
+ *
+ * Returns true if the device was given something to do, in which case the data has to wait.
+ */
+bool flashfsLogService(uint32_t position)
+{
+    if (flashfsLogServiceIndex(position)) {
+        return true;
+    }
+
+    if (position == flashLog.eraseFront) {
+        // Nothing left erased ahead, so logging has to wait for this one
+        flashfsLogEraseNextSector(position);
+        return true;
+    }
+
+    return false;
+}
+
+static bool flashfsLogSectorInUse(uint32_t sector)
+{
+    for (int i = 0; i < flashLog.logCount; i++) {
+        if (flashfsLogHasDataIn(&flashLog.logs[i], sector)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * The run to keep erased ahead of the write position even if old logs have to be recycled for it: the configured
+ * share of the ring, or room for a log as long as the longest one kept, whichever is more.
+ */
+static uint32_t flashfsLogEraseAheadBudget(void)
+{
+    uint32_t budget = flashLog.eraseAhead;
+
+    for (int i = 0; i < flashLog.logCount; i++) {
+        budget = MAX(budget, flashLog.logs[i].length);
+    }
+
+    return budget;
+}
+
+/**
+ * Call while nothing is being written, one sector erase at a time. Erases every sector ahead of the write position
+ * that no log has data in, and recycles the oldest logs past that as far as the erase ahead budget.
+ */
+void flashfsLogEraseAhead(uint32_t position)
+{
+    if (!flashLog.enabled || !flashIsReady() || flashfsLogServiceIndex(position)) {
+        return;
+    }
+
+    const uint32_t erased = ringDistance(position, flashLog.eraseFront);
+
+    // Never erase into the sector holding the write position from behind
+    if (erased + flashLog.sectorSize + position % flashLog.sectorSize > flashLog.areaSize - flashLog.sectorSize) {
+        return;
+    }
+
+    if (erased < flashfsLogEraseAheadBudget() || !flashfsLogSectorInUse(flashLog.eraseFront)) {
+        flashfsLogEraseNextSector(position);
+    }
+}
+
+/**
+ * True when the open log has filled the whole ring, and would have to recycle its own start to carry on.
+ */
+bool flashfsLogIsFull(uint32_t position)
+{
+    return flashLog.logOpen && ringDistance(flashLog.openStart, position) + flashLog.sectorSize >= flashLog.areaSize;
+}
+
+void flashfsLogBegin(uint32_t position)
+{
+    if (!flashLog.enabled) {
+        return;
+    }
+
+    if (flashLog.logOpen) {
+        flashfsLogEnd(position, true);
+    }
+
+    if (flashLog.logCount == FLASHFS_LOG_MAX) {
+        flashfsLogRemove(0);
+    }
+
+    flashLog.sequence++;
+
+    flashfsLog_t *log = &flashLog.logs[flashLog.logCount++];
+    log->start = position;
+    log->length = 0;
+    log->sequence = flashLog.sequence;
+    log->flags = 0;
+
+    flashLog.logOpen = true;
+    flashLog.openStart = position;
+
+    flashfsLogQueueRecord(FLASHFS_INDEX_LOG_START, log->sequence, position, 0);
+}
+
+/**
+ * Close the open log at the given position, or delete it if it isn't worth keeping.
+ */
+void flashfsLogEnd(uint32_t position, bool retain)
+{
+    if (!flashLog.enabled || !flashLog.logOpen) {
+        return;
+    }
+
+    flashLog.logOpen = false;
+
+    // The open log is the newest, unless the ring has already recycled it
+    const int index = flashLog.logCount - 1;
+    if (index < 0 || flashLog.logs[index].sequence != flashLog.sequence) {
+        return;
+    }
+
+    if (retain) {
+        flashLog.logs[index].length = ringDistance(flashLog.logs[index].start, position);
+        flashfsLogQueueRecord(FLASHFS_INDEX_LOG_END, flashLog.sequence, position, 0);
+    } else {
+        flashfsLogRemove(index);
+        flashfsLogQueueRecord(FLASHFS_INDEX_LOG_DELETE, flashLog.sequence, position, 0);
+    }
+}
+
+int flashfsLogCount(void)
+{
+    return flashLog.logCount;
+}
+
+/**
+ * Return the logs oldest first, or NULL past the end.
+ */
+const flashfsLog_t *flashfsLogGet(int index)
+{
+    if (index < 0 || index >= flashLog.logCount) {
+        return NULL;
+    }
+
+    return &flashLog.logs[index];
+}
+
+/**
+ * Forget a log. Its sectors are recycled when the ring comes around to them.
+ */
+bool flashfsLogDelete(uint16_t sequence)
+{
+    for (int i = 0; i < flashLog.logCount; i++) {
+        if (flashLog.logs[i].sequence == sequence) {
+            if (flashLog.logOpen && i == flashLog.logCount - 1) {
+                return false;
+            }
+
+            flashfsLogRemove(i);
+            flashfsLogQueueRecord(FLASHFS_INDEX_LOG_DELETE, sequence, flashfsGetOffset(), 0);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * The length of the log at the given index, the open log runs up to the write position.
+ */
+static uint32_t flashfsLogLength(int index, uint32_t position)
+{
+    const flashfsLog_t *log = &flashLog.logs[index];
+
+    return flashfsLogIsOpen(index) ? ringDistance(log->start, position) : log->length;
+}
+
+/**
+ * Get the number of bytes in all the logs, given the write position.
+ */
+uint32_t flashfsLogUsedSize(uint32_t position)
+{
+    uint32_t size = 0;
+
+    for (int i = 0; i < flashLog.logCount; i++) {
+        size += flashfsLogLength(i, position);
+    }
+
+    return size;
+}
+
+/**
+ * Read `len` bytes from the given address in the logs, taken back to back and oldest first, given the write
+ * position. The caller flushes any data still buffered first.
+ *
+ * Returns the number of bytes actually read, which is only less than requested past the end of the newest log.
+ */
+int flashfsLogReadVolume(uint32_t position, uint32_t address, uint8_t *buffer, unsigned int len)
+{
+    int bytesRead = 0;
+    int index = 0;
+
+    while (len > 0 && index < flashLog.logCount) {
+        const uint32_t length = flashfsLogLength(index, position);
+
+        if (address >= length) {
+            address -= length;
+            index++;
+            continue;
+        }
+
+        // Don't read past the end of the log, or around the end of the ring
+        const uint32_t start = ringAdvance(flashLog.logs[index].start, address);
+        const int chunk = MIN(MIN(len, length - address), flashLog.areaSize - start);
+        const int chunkRead = flashReadBytes(flashfsLogPhysicalAddress(start), buffer, chunk);
+
+        if (chunkRead <= 0) {
+            break;
+        }
+
+        bytesRead += chunkRead;
+        buffer += chunkRead;
+        address += chunkRead;
+        len -= chunkRead;
+
+        if (chunkRead < chunk) {
+            break;
+        }
+    }
+
+    return bytesRead;
+}
+
+/**
+ * Forget every log and carry on from the next sector boundary, with nothing ahead known to be erased. Only the next
+ * index sector is erased, the data sectors are recycled as the ring comes around to them.
+ *
+ * Returns the position to write from.
+ */
+uint32_t flashfsLogFormat(uint32_t position)
+{
+    if (position % flashLog.sectorSize) {
+        position = ringAdvance(position - position % flashLog.sectorSize, flashLog.sectorSize);
+    }
+
+    flashLog.logCount = 0;
+    flashLog.logOpen = false;
+    flashLog.eraseFront = position;
+
+    flashfsLogStartRewrite();
+
+    return position;
+}
+
+static bool flashfsLogReadRecords(uint8_t sector, uint16_t slot, flashfsIndexRecord_t *records, int count)
+{
+    const int length = count * sizeof(*records);
+
+    return flashReadBytes(flashfsLogIndexAddress(sector, slot), (uint8_t *)records, length) == length;
+}
+
+/**
+ * Find the current index, the newer of the index sectors with a valid format record.
+ *
+ * Returns false if neither has one.
+ */
+static bool flashfsLogFindIndex(void)
+{
+    bool found = false;
+
+    for (int sector = 0; sector < FLASHFS_INDEX_SECTORS; sector++) {
+        flashfsIndexRecord_t record;
+
+        if (!flashfsLogReadRecords(sector, 0, &record, 1) || !flashfsLogRecordIsValid(&record) || record.type != FLASHFS_INDEX_FORMAT) {
+            continue;
+        }
+        if (!found || (int16_t)(record.generation - flashLog.generation) > 0) {
+            flashLog.indexSector = sector;
+            flashLog.generation = record.generation;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+static bool flashfsLogPageIsErased(uint32_t position)
+{
+    union {
+        uint8_t bytes[FLASHFS_ERASED_TEST_SIZE];
+        uint32_t ints[FLASHFS_ERASED_TEST_SIZE / sizeof(uint32_t)];
+    } test;
+
+    if (flashReadBytes(flashfsLogPhysicalAddress(position), test.bytes, sizeof(test)) < (int)sizeof(test)) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < ARRAYLEN(test.ints); i++) {
+        if (test.ints[i] != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Find the end of a log that was never closed, by searching the erased run after the last known write position for
+ * its first erased page.
+ */
+static uint32_t flashfsLogFindEnd(uint32_t position)
+{
+    const uint32_t pageSize = flashGetGeometry()->pageSize;
+    const uint32_t first = position % pageSize ? ringAdvance(position - position % pageSize, pageSize) : position;
+
+    if (ringDistance(position, flashLog.eraseFront) < ringDistance(position, first)) {
+        return position;
+    }
+
+    int left = 0;
+    int right = ringDistance(first, flashLog.eraseFront) / pageSize;
+    int result = right;
+
+    while (left < right) {
+        const int mid = (left + right) / 2;
+
+        if (flashfsLogPageIsErased(ringAdvance(first, mid * pageSize))) {
+            result = mid;
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+
+    return ringAdvance(first, result * pageSize);
+}
+
+/**
+ * Rebuild the ring state and the log table from the index.
+ *
+ * Returns false if there's no valid index.
+ */
+static bool flashfsLogReadIndex(uint32_t *position)
+{
+    flashfsIndexRecord_t records[FLASHFS_INDEX_READ_RECORDS];
+    uint8_t found[FLASHFS_LOG_MAX];
+    int foundCount = 0;
+
+    if (!flashfsLogFindIndex()) {
+        return false;
+    }
+
+    // Records are only ever appended, so the first free slot can be found with a binary search
+    int left = 1;
+    int right = flashLog.recordSlots;
+
+    while (left < right) {
+        const int mid = (left + right) / 2;
+
+        if (!flashfsLogReadRecords(flashLog.indexSector, mid, records, 1)) {
+            return false;
+        }
+        if (records[0].magic == 0xFF) {
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+    flashLog.recordCount = left;
+
+    // Walk the index backwards, newest record first. The log table is filled newest first too, and reversed after.
+    bool haveState = false;
+    bool haveSequence = false;
+    bool done = false;
+    int slot = flashLog.recordCount;
+
+    while (slot > 0 && !done) {
+        const int count = MIN(slot, FLASHFS_INDEX_READ_RECORDS);
+        slot -= count;
+
+        if (!flashfsLogReadRecords(flashLog.indexSector, slot, records, count)) {
+            return false;
+        }
+
+        for (int i = count - 1; i >= 0; i--) {
+            const flashfsIndexRecord_t *record = &records[i];
+
+            if (!flashfsLogRecordIsValid(record)) {
+                // Torn by a power loss
+                continue;
+            }
+
+            if (!haveState) {
+                *position = record->position;
+                flashLog.eraseFront = record->eraseFront;
+                haveState = true;
+            }
+
+            if (!haveSequence && (record->type == FLASHFS_INDEX_FORMAT || record->type == FLASHFS_INDEX_LOG_START)) {
+                flashLog.sequence = record->sequence;
+                haveSequence = true;
+            }
+
+            if (record->type != FLASHFS_INDEX_LOG_START && record->type != FLASHFS_INDEX_LOG_END && record->type != FLASHFS_INDEX_LOG_DELETE) {
+                continue;
+            }
+
+            int index;
+            for (index = 0; index < foundCount && flashLog.logs[index].sequence != record->sequence; index++);
+
+            if (index == foundCount) {
+                if (foundCount == FLASHFS_LOG_MAX) {
+                    continue;
+                }
+                memset(&flashLog.logs[index], 0, sizeof(flashLog.logs[index]));
+                flashLog.logs[index].sequence = record->sequence;
+                found[index] = 0;
+                foundCount++;
+            }
+
+            flashfsLog_t *log = &flashLog.logs[index];
+
+            switch (record->type) {
+            case FLASHFS_INDEX_LOG_START:
+                if (!(found[index] & FLASHFS_FOUND_START)) {
+                    log->start = record->position;
+                    log->flags |= record->flags;
+                    found[index] |= FLASHFS_FOUND_START;
+                }
+                break;
+            case FLASHFS_INDEX_LOG_END:
+                if (!(found[index] & FLASHFS_FOUND_END)) {
+                    // The start is further back in the index, the length is worked out once it's found
+                    log->length = record->position;
+                    log->flags |= record->flags;
+                    found[index] |= FLASHFS_FOUND_END;
+                }
+                break;
+            default:
+                found[index] |= FLASHFS_FOUND_DELETED;
+                break;
+            }
+        }
+
+        // Stop once the table is full and every log in it has been traced back to its start
+        done = foundCount == FLASHFS_LOG_MAX;
+        for (int i = 0; i < foundCount && done; i++) {
+            done = found[i] & FLASHFS_FOUND_START;
+        }
+    }
+
+    if (!haveState) {
+        return false;
+    }
+
+    // A log without an end that is still the newest one was cut short by a power loss
+    bool recovered = false;
+    if (foundCount > 0 && (found[0] & (FLASHFS_FOUND_START | FLASHFS_FOUND_END | FLASHFS_FOUND_DELETED)) == FLASHFS_FOUND_START) {
+        *position = flashfsLogFindEnd(*position);
+        flashLog.logs[0].length = *position;
+        flashLog.logs[0].flags |= FLASHFS_LOG_FLAG_RECOVERED;
+        found[0] |= FLASHFS_FOUND_END;
+        recovered = true;
+    }
+
+    /*
+     * The logs lie back to back behind the write position. Keep them newest first until one overlaps a newer log or
+     * reaches past the erased run, which means the ring has come around to it, and to every older log too.
+     */
+    const uint32_t dataLength = *position == flashLog.eraseFront ? flashLog.areaSize : ringDistance(flashLog.eraseFront, *position);
+    uint32_t behind = 0;
+    uint32_t newerStart = *position;
+    int kept = 0;
+
+    for (int i = 0; i < foundCount; i++) {
+        flashfsLog_t log = flashLog.logs[i];
+
+        if (!(found[i] & FLASHFS_FOUND_START) || (found[i] & FLASHFS_FOUND_DELETED)) {
+            continue;
+        }
+
+        // The length field holds the end position until now
+        const uint32_t end = found[i] & FLASHFS_FOUND_END ? log.length : newerStart;
+        log.length = ringDistance(log.start, end);
+
+        const uint32_t endBehind = ringDistance(end, *position);
+        if (endBehind < behind || endBehind + log.length > dataLength) {
+            break;
+        }
+
+        behind = endBehind + log.length;
+        newerStart = log.start;
+        flashLog.logs[kept++] = log;
+    }
+
+    // Oldest first from here on
+    for (int i = 0; i < kept / 2; i++) {
+        const flashfsLog_t log = flashLog.logs[i];
+        flashLog.logs[i] = flashLog.logs[kept - 1 - i];
+        flashLog.logs[kept - 1 - i] = log;
+    }
+    flashLog.logCount = kept;
+
+    if (recovered && kept > 0 && flashLog.logs[kept - 1].sequence == flashLog.sequence) {
+        flashfsLogQueueRecord(FLASHFS_INDEX_LOG_END, flashLog.sequence, *position, FLASHFS_LOG_FLAG_RECOVERED);
+    }
+
+    return true;
+}
+
+/**
+ * Read the index when log-structured mode is configured, formatting the device if it doesn't have one yet.
+ *
+ * Returns the position to carry on writing from.
+ */
+uint32_t flashfsLogInit(void)
+{
+    const flashGeometry_t *geometry = flashGetGeometry();
+
+    memset(&flashLog, 0, sizeof(flashLog));
+
+    // The index takes two sectors, and the ring needs at least two
+    flashLog.enabled = flashConfig()->logStructured && geometry->totalSize > 0 && geometry->sectors >= FLASHFS_INDEX_SECTORS + 2;
+    if (!flashLog.enabled) {
+        return 0;
+    }
+
+    flashLog.sectorSize = geometry->sectorSize;
+    flashLog.areaSize = geometry->totalSize - FLASHFS_INDEX_SECTORS * geometry->sectorSize;
+    flashLog.recordSlots = MIN(geometry->sectorSize / sizeof(flashfsIndexRecord_t), (size_t)UINT16_MAX);
+    flashLog.eraseAhead = flashLog.areaSize / 100 * flashConfig()->eraseAheadPercent;
+
+    uint32_t position;
+    if (!flashfsLogReadIndex(&position) || position >= flashLog.areaSize || flashLog.eraseFront >= flashLog.areaSize) {
+        return flashfsLogFormat(0);
+    }
+
+    return position;
+}
+#endif // USE_FLASHFS_LOG
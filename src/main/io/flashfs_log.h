@@ -0,0 +1,57 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The most recent logs that are kept track of, older ones are left for the ring to recycle
+#define FLASHFS_LOG_MAX 32
+
+typedef enum {
+    FLASHFS_LOG_FLAG_RECOVERED = (1 << 0),  // The log wasn't closed, its end was found by searching for erased pages
+} flashfsLogFlags_e;
+
+typedef struct flashfsLog_s {
+    uint32_t start;     // Position of the first byte in the log area
+    uint32_t length;
+    uint16_t sequence;  // Log number, increases with every log started
+    uint8_t flags;
+} flashfsLog_t;
+
+bool flashfsLogIsEnabled(void);
+uint32_t flashfsLogAreaSize(void);
+uint32_t flashfsLogPhysicalAddress(uint32_t position);
+
+uint32_t flashfsLogInit(void);
+uint32_t flashfsLogFormat(uint32_t position);
+bool flashfsLogService(uint32_t position);
+void flashfsLogEraseAhead(uint32_t position);
+bool flashfsLogIsFull(uint32_t position);
+
+void flashfsLogBegin(uint32_t position);
+void flashfsLogEnd(uint32_t position, bool retain);
+
+int flashfsLogCount(void);
+const flashfsLog_t *flashfsLogGet(int index);
+bool flashfsLogDelete(uint16_t sequence);
+uint32_t flashfsLogUsedSize(uint32_t position);
+int flashfsLogReadVolume(uint32_t position, uint32_t address, uint8_t *buffer, unsigned int len);
@@ -1498,7 +1498,7 @@ static void osdGetBlackboxStatusString(char * buff)
         if (storageDeviceIsWorking) {
             const flashGeometry_t *geometry = flashfsGetGeometry();
             storageTotal = geometry->totalSize / 1024;
-            storageUsed = flashfsGetOffset() / 1024;
+            storageUsed = flashfsGetUsedSize() / 1024;
         }
         break;
 #endif
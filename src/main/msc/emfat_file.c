@@ -29,6 +29,7 @@
 #include "emfat_file.h"
 
 #include "io/flashfs.h"
+#include "io/flashfs_log.h"
 
 #define FILESYSTEM_SIZE_MB 256
 
@@ -284,9 +285,34 @@ static void emfat_add_log(emfat_entry_t *entry, int number, uint32_t offset, uin
     entry->readcb = bblog_read_proc;
 }
 
+#ifdef USE_FLASHFS_LOG
+// The index knows where each log is, as they're read back to back
+static int emfat_list_logs(emfat_entry_t *entry, int maxCount)
+{
+    uint32_t offset = 0;
+    int logCount;
+
+    // Nothing is logged in mass storage mode, so every log is closed
+    for (logCount = 0; logCount < flashfsLogCount() && logCount < maxCount; logCount++) {
+        const flashfsLog_t *log = flashfsLogGet(logCount);
+
+        emfat_add_log(entry++, logCount, offset, log->length);
+        offset += log->length;
+    }
+
+    return logCount;
+}
+#endif
+
 static int emfat_find_log(emfat_entry_t *entry, int maxCount)
 {
-    uint32_t limit  = flashfsIdentifyStartOfFreeSpace();
+#ifdef USE_FLASHFS_LOG
+    if (flashfsLogIsEnabled()) {
+        return emfat_list_logs(entry, maxCount);
+    }
+#endif
+
+    uint32_t limit  = flashfsGetUsedSize();
     uint32_t lastOffset = 0;
     uint32_t currOffset = 0;
     int fileNumber = 0;
@@ -341,7 +367,7 @@ void emfat_init_files(void)
         // allow downloading the entire log in one file
         entries[entryIndex] = entriesPredefined[PREDEFINED_ENTRY_COUNT];
         entry = &entries[entryIndex];
-        entry->curr_size = flashfsIdentifyStartOfFreeSpace();
+        entry->curr_size = flashfsGetUsedSize();
         entry->max_size = entry->curr_size;
         ++entryIndex;
     }
@@ -350,7 +376,7 @@ void emfat_init_files(void)
     entries[entryIndex] = entriesPredefined[PREDEFINED_ENTRY_COUNT + 1];
     entry = &entries[entryIndex];
     // used space is doubled because of the individual files plus the single complete file
-    entry->curr_size = (FILESYSTEM_SIZE_MB * 1024 * 1024) - (flashfsIdentifyStartOfFreeSpace() * 2);
+    entry->curr_size = (FILESYSTEM_SIZE_MB * 1024 * 1024) - (flashfsGetUsedSize() * 2);
     entry->max_size = entry->curr_size;
 
     emfat_init(&emfat, "BETAFLT", entries);
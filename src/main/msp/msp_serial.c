@@ -26,6 +26,7 @@
 
 #include "build/debug.h"
 
+#include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/utils.h"
 #include "common/crc.h"
@@ -41,6 +42,12 @@
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
 
+// Shared by replies and stream frames, both are built and sent within one call
+static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+
+// Bounds the time spent streaming in one call when the transmit buffer drains as fast as it is filled
+#define MSP_STREAM_MAX_FRAMES_PER_CALL 8
+
 static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort, bool sharedWithTelemetry)
 {
     memset(mspPortToReset, 0, sizeof(mspPort_t));
@@ -277,6 +284,18 @@ static int mspSerialSendFrame(mspPort_t *msp, const uint8_t * hdr, int hdrLen, c
     if (!isSerialTransmitBufferEmpty(msp->port) && ((int)serialTxBytesFree(msp->port) < totalFrameLength))
         return 0;
 
+    // Copy the frame into the transmit buffer in one go when it fits before the buffer wraps
+    int txSpace;
+    uint8_t * const txPtr = serialReserveTx(msp->port, &txSpace);
+    if (txPtr && txSpace >= totalFrameLength) {
+        memcpy(txPtr, hdr, hdrLen);
+        memcpy(txPtr + hdrLen, data, dataLen);
+        memcpy(txPtr + hdrLen + dataLen, crc, crcLen);
+        serialCommitTx(msp->port, totalFrameLength);
+
+        return totalFrameLength;
+    }
+
     // Transmit frame
     serialBeginWrite(msp->port);
     serialWriteBuf(msp->port, hdr, hdrLen);
@@ -287,16 +306,22 @@ static int mspSerialSendFrame(mspPort_t *msp, const uint8_t * hdr, int hdrLen, c
     return totalFrameLength;
 }
 
-static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e mspVersion)
+/*
+ * Build the header and checksums framing the payload in packet->buf. Returns the header length, zero for an unknown
+ * version.
+ */
+static int mspSerialEncodeHeader(mspPacket_t *packet, mspVersion_e mspVersion, uint8_t *hdrBuf, uint8_t *crcBuf, int *crcLenPtr)
 {
     static const uint8_t mspMagic[MSP_VERSION_COUNT] = MSP_VERSION_MAGIC_INITIALIZER;
     const int dataLen = sbufBytesRemaining(&packet->buf);
-    uint8_t hdrBuf[16] = { '$', mspMagic[mspVersion], packet->result == MSP_RESULT_ERROR ? '!' : '>'};
-    uint8_t crcBuf[2];
     uint8_t checksum;
     int hdrLen = 3;
     int crcLen = 0;
 
+    hdrBuf[0] = '$';
+    hdrBuf[1] = mspMagic[mspVersion];
+    hdrBuf[2] = packet->result == MSP_RESULT_ERROR ? '!' : '>';
+
     #define V1_CHECKSUM_STARTPOS 3
     if (mspVersion == MSP_V1) {
         mspHeaderV1_t * hdrV1 = (mspHeaderV1_t *)&hdrBuf[hdrLen];
@@ -376,14 +401,94 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
         return 0;
     }
 
+    *crcLenPtr = crcLen;
+    return hdrLen;
+}
+
+static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e mspVersion)
+{
+    uint8_t hdrBuf[16];
+    uint8_t crcBuf[2];
+    int crcLen;
+
+    const int hdrLen = mspSerialEncodeHeader(packet, mspVersion, hdrBuf, crcBuf, &crcLen);
+    if (hdrLen == 0) {
+        return 0;
+    }
+
     // Send the frame
-    return mspSerialSendFrame(msp, hdrBuf, hdrLen, sbufPtr(&packet->buf), dataLen, crcBuf, crcLen);
+    return mspSerialSendFrame(msp, hdrBuf, hdrLen, sbufPtr(&packet->buf), sbufBytesRemaining(&packet->buf), crcBuf, crcLen);
 }
 
-static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+// Header length of a frame too short to need a jumbo header
+static int mspSerialHeaderSize(mspVersion_e mspVersion)
+{
+    switch (mspVersion) {
+    case MSP_V1:
+        return 3 + sizeof(mspHeaderV1_t);
+    case MSP_V2_OVER_V1:
+        return 3 + sizeof(mspHeaderV1_t) + sizeof(mspHeaderV2_t);
+    case MSP_V2_NATIVE:
+        return 3 + sizeof(mspHeaderV2_t);
+    default:
+        return 0;
+    }
+}
+
+/*
+ * Point buf at the payload of a frame built directly in the port's transmit buffer, saving the copy from outBuf.
+ * Returns false if the port can not be written in place or there is not room for minDataLen before the buffer wraps,
+ * the frame then has to be built in outBuf. A reply may be as long as MSP_PORT_REPLY_SIZE_MAX, more than a UART
+ * transmit buffer holds, so on a UART replies are built in outBuf and only copied in place once their size is known.
+ */
+static bool mspSerialBeginInPlace(mspPort_t *msp, mspVersion_e mspVersion, int minDataLen, sbuf_t *buf)
+{
+    int txSpace;
+    uint8_t * const txPtr = serialReserveTx(msp->port, &txSpace);
+    const int hdrLen = mspSerialHeaderSize(mspVersion);
+    // Keep room to move the payload up for a jumbo header, and for both checksums of MSPv2 over MSPv1
+    const int trailerLen = sizeof(mspHeaderJUMBO_t) + 2;
+
+    if (!txPtr || hdrLen == 0 || txSpace < hdrLen + minDataLen + trailerLen) {
+        return false;
+    }
+
+    buf->ptr = txPtr + hdrLen;
+    buf->end = txPtr + txSpace - trailerLen;
+    return true;
+}
+
+/*
+ * Frame the payload built in place by mspSerialBeginInPlace() and send it.
+ */
+static int mspSerialEndInPlace(mspPort_t *msp, mspPacket_t *packet, mspVersion_e mspVersion)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+    uint8_t hdrBuf[16];
+    uint8_t crcBuf[2];
+    int crcLen;
 
+    const int hdrLen = mspSerialEncodeHeader(packet, mspVersion, hdrBuf, crcBuf, &crcLen);
+    const int dataLen = sbufBytesRemaining(&packet->buf);
+    uint8_t * const frame = sbufPtr(&packet->buf) - mspSerialHeaderSize(mspVersion);
+
+    if (hdrLen != mspSerialHeaderSize(mspVersion)) {
+        // Jumbo frame, the payload moves up to make room for the longer header
+        memmove(frame + hdrLen, sbufPtr(&packet->buf), dataLen);
+    }
+    memcpy(frame, hdrBuf, hdrLen);
+    memcpy(frame + hdrLen + dataLen, crcBuf, crcLen);
+
+    const int totalFrameLength = hdrLen + dataLen + crcLen;
+    serialCommitTx(msp->port, totalFrameLength);
+
+    return totalFrameLength;
+}
+
+// Port whose command is being processed, so a command can check it is able to stream its replies
+static mspPort_t *mspCommandPort;
+
+static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
     mspPacket_t reply = {
         .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
         .cmd = -1,
@@ -391,6 +496,7 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
         .result = 0,
         .direction = MSP_DIRECTION_REPLY,
     };
+    const bool inPlace = mspSerialBeginInPlace(msp, msp->mspVersion, MSP_PORT_REPLY_SIZE_MAX, &reply.buf);
     uint8_t *outBufHead = reply.buf.ptr;
 
     mspPacket_t command = {
@@ -402,11 +508,17 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
 
     mspPostProcessFnPtr mspPostProcessFn = NULL;
+    mspCommandPort = msp;
     const mspResult_e status = mspProcessCommandFn(&command, &reply, &mspPostProcessFn);
+    mspCommandPort = NULL;
 
     if (status != MSP_RESULT_NO_REPLY) {
         sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
-        mspSerialEncode(msp, &reply, msp->mspVersion);
+        if (inPlace) {
+            mspSerialEndInPlace(msp, &reply, msp->mspVersion);
+        } else {
+            mspSerialEncode(msp, &reply, msp->mspVersion);
+        }
     }
 
     return mspPostProcessFn;
@@ -466,6 +578,103 @@ static void mspSerialProcessReceivedReply(mspPort_t *msp, mspProcessReplyFnPtr m
     msp->c_state = MSP_IDLE;
 }
 
+/*
+ * Send frames from a stream for as long as the transmit buffer has room, sizing each one to fit.
+ * The next frame is built while the previous one drains.
+ */
+static void mspSerialProcessStream(mspPort_t *msp, mspStream_t *stream)
+{
+    for (int frameCount = 0; stream->fn && frameCount < MSP_STREAM_MAX_FRAMES_PER_CALL; frameCount++) {
+        // As with replies, a frame larger than the transmit buffer may only go out once it is empty
+        int frameSpace = sizeof(outBuf);
+        if (!isSerialTransmitBufferEmpty(msp->port)) {
+            frameSpace = MIN(frameSpace, (int)serialTxBytesFree(msp->port) - MSP_MAX_HEADER_SIZE - 2);
+            if (frameSpace <= 0) {
+                break;
+            }
+        }
+
+        mspPacket_t frame = {
+            .buf = { .ptr = outBuf, .end = outBuf + frameSpace, },
+            .cmd = stream->cmd,
+            .flags = 0,
+            .result = MSP_RESULT_ACK,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+        // In place whenever the transmit buffer has as much room before it wraps, and then frames may use all of it
+        const bool inPlace = mspSerialBeginInPlace(msp, stream->mspVersion, frameSpace, &frame.buf);
+        uint8_t * const frameHead = frame.buf.ptr;
+
+        const mspResult_e status = stream->fn(&frame.buf);
+        if (status == MSP_RESULT_NO_REPLY) {
+            break;
+        } else if (status != MSP_RESULT_ACK) {
+            stream->fn = NULL;
+            break;
+        }
+
+        sbufSwitchToReader(&frame.buf, frameHead);
+        if (inPlace) {
+            mspSerialEndInPlace(msp, &frame, stream->mspVersion);
+        } else {
+            mspSerialEncode(msp, &frame, stream->mspVersion);
+        }
+    }
+}
+
+/*
+ * True if the command being processed came in on a port with a stream slot free for streamFn. Commands that arrive
+ * any other way, e.g. over telemetry, have no port to stream on.
+ */
+bool mspSerialCanStartStream(mspStreamFnPtr streamFn)
+{
+    if (!mspCommandPort) {
+        return false;
+    }
+
+    for (int i = 0; i < MSP_MAX_STREAMS_PER_PORT; i++) {
+        if (!mspCommandPort->streams[i].fn || mspCommandPort->streams[i].fn == streamFn) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Attach a stream to the MSP port on serialPort, replacing the same stream on any port. The port sends frames as
+ * cmd replies whenever streamFn has one ready, until it reports the end of the stream. Returns false if the port
+ * already runs as many streams as it can.
+ */
+bool mspSerialStartStream(struct serialPort_s *serialPort, int16_t cmd, mspStreamFnPtr streamFn)
+{
+    mspStream_t *freeStream = NULL;
+    mspVersion_e mspVersion = MSP_V1;
+
+    for (uint8_t portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        for (int i = 0; i < MSP_MAX_STREAMS_PER_PORT; i++) {
+            mspStream_t * const stream = &mspPort->streams[i];
+            if (stream->fn == streamFn) {
+                stream->fn = NULL;
+            }
+            if (!stream->fn && !freeStream && mspPort->port && mspPort->port == serialPort) {
+                freeStream = stream;
+                mspVersion = mspPort->mspVersion;
+            }
+        }
+    }
+
+    if (!freeStream) {
+        return false;
+    }
+
+    freeStream->fn = streamFn;
+    freeStream->cmd = cmd;
+    freeStream->mspVersion = mspVersion;
+    return true;
+}
+
 /*
  * Process MSP commands from serial ports configured as MSP ports.
  *
@@ -514,6 +723,12 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         else {
             mspProcessPendingRequest(mspPort);
         }
+
+        for (int i = 0; i < MSP_MAX_STREAMS_PER_PORT; i++) {
+            if (mspPort->streams[i].fn) {
+                mspSerialProcessStream(mspPort, &mspPort->streams[i]);
+            }
+        }
     }
 }
 
@@ -72,6 +72,9 @@ typedef enum {
 #endif
 #define MSP_PORT_DATAFLASH_INFO_SIZE 16
 #define MSP_PORT_OUTBUF_SIZE (MSP_PORT_DATAFLASH_BUFFER_SIZE + MSP_PORT_DATAFLASH_INFO_SIZE)
+#elif defined(USE_MSP_BATCH)
+// Room for several replies in one batch reply
+#define MSP_PORT_OUTBUF_SIZE 1024
 #else
 #define MSP_PORT_OUTBUF_SIZE 256
 #endif
@@ -92,6 +95,17 @@ typedef struct __attribute__((packed)) {
 } mspHeaderV2_t;
 
 #define MSP_MAX_HEADER_SIZE     9
+// Longest reply to any command but a dataflash read, which is clipped to the space left
+#define MSP_PORT_REPLY_SIZE_MAX 256
+
+// A dataflash download and a telemetry subscription can run on the same port
+#define MSP_MAX_STREAMS_PER_PORT 2
+
+typedef struct mspStream_s {
+    mspStreamFnPtr fn;          // null when the slot is free
+    int16_t cmd;
+    mspVersion_e mspVersion;
+} mspStream_t;
 
 struct serialPort_s;
 typedef struct mspPort_s {
@@ -109,6 +123,7 @@ typedef struct mspPort_s {
     uint8_t checksum1;
     uint8_t checksum2;
     bool sharedWithTelemetry;
+    mspStream_t streams[MSP_MAX_STREAMS_PER_PORT];
 } mspPort_t;
 
 void mspSerialInit(void);
@@ -117,5 +132,7 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
 void mspSerialAllocatePorts(void);
 void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
 void mspSerialReleaseSharedTelemetryPorts(void);
+bool mspSerialCanStartStream(mspStreamFnPtr streamFn);
+bool mspSerialStartStream(struct serialPort_s *serialPort, int16_t cmd, mspStreamFnPtr streamFn);
 int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction);
 uint32_t mspSerialTxBytesFree(void);
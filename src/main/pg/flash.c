@@ -33,11 +33,13 @@
 
 #include "flash.h"
 
-PG_REGISTER_WITH_RESET_FN(flashConfig_t, flashConfig, PG_FLASH_CONFIG, 0);
+PG_REGISTER_WITH_RESET_FN(flashConfig_t, flashConfig, PG_FLASH_CONFIG, 2);
 
 void pgResetFn_flashConfig(flashConfig_t *flashConfig)
 {
     flashConfig->csTag = IO_TAG(FLASH_CS_PIN);
     flashConfig->spiDevice = SPI_DEV_TO_CFG(spiDeviceByInstance(FLASH_SPI_INSTANCE));
+    flashConfig->logStructured = 0;
+    flashConfig->eraseAheadPercent = 25;
 }
 #endif
@@ -29,6 +29,8 @@
 typedef struct flashConfig_s {
     ioTag_t csTag;
     uint8_t spiDevice;
+    uint8_t logStructured;      // Keep an index of logs and use the rest of the device as a ring, see io/flashfs_log.c
+    uint8_t eraseAheadPercent;  // Share of the ring kept erased ahead of the write position in log-structured mode
 } flashConfig_t;
 
 PG_DECLARE(flashConfig_t, flashConfig);
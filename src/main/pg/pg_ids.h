@@ -136,7 +136,9 @@
 #define PG_RCDEVICE_CONFIG 539
 #define PG_GYRO_DEVICE_CONFIG 540
 #define PG_MCO_CONFIG 541
-#define PG_BETAFLIGHT_END 541
+#define PG_GAIN_SCHEDULE_CONFIG 542
+#define PG_CONFIG_SNAPSHOT 543
+#define PG_BETAFLIGHT_END 543
 
 
 // OSD configuration (subject to change)
@@ -57,6 +57,7 @@ typedef struct rxConfig_s {
     uint8_t rc_smoothing_input_type;        // Input filter type (0 = PT1, 1 = BIQUAD)
     uint8_t rc_smoothing_derivative_type;   // Derivative filter type (0 = OFF, 1 = PT1, 2 = BIQUAD)
     uint8_t rc_smoothing_auto_factor;       // Used to adjust the "smoothness" determined by the auto cutoff calculations
+    uint8_t rx_fast_path;                   // Decode new RC frames from the PID loop instead of waiting for the RX task
 } rxConfig_t;
 
 PG_DECLARE(rxConfig_t, rxConfig);
@@ -124,6 +124,40 @@ STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
     return crc;
 }
 
+static uint16_t crsfChannelToUs(uint16_t value)
+{
+    /* conversion from RC value to PWM
+     *       RC     PWM
+     * min  172 ->  988us
+     * mid  992 -> 1500us
+     * max 1811 -> 2012us
+     * scale factor = (2012-988) / (1811-172) = 0.62477120195241
+     * offset = 988 - 172 * 0.62477120195241 = 880.53935326418548
+     */
+    return (0.62477120195241f * value) + 881;
+}
+
+// Hand the flight channels of a complete RC frame over for the PID loop fast path
+static void crsfSignalFrameReady(void)
+{
+    if (crsfFrameCRC() != crsfFrame.frame.payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE]) {
+        return;
+    }
+
+    const crsfPayloadRcChannelsPacked_t* const rcChannels = (crsfPayloadRcChannelsPacked_t*)&crsfFrame.frame.payload;
+    const uint16_t flightChannels[RX_MAPPABLE_CHANNEL_COUNT] = {
+        crsfChannelToUs(rcChannels->chan0),
+        crsfChannelToUs(rcChannels->chan1),
+        crsfChannelToUs(rcChannels->chan2),
+        crsfChannelToUs(rcChannels->chan3),
+        crsfChannelToUs(rcChannels->chan4),
+        crsfChannelToUs(rcChannels->chan5),
+        crsfChannelToUs(rcChannels->chan6),
+        crsfChannelToUs(rcChannels->chan7),
+    };
+    rxSignalFrameReady(flightChannels);
+}
+
 // Receive ISR callback, called back from serial port
 STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
 {
@@ -154,7 +188,9 @@ STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
         crsfFrameDone = crsfFramePosition < fullFrameLength ? false : true;
         if (crsfFrameDone) {
             crsfFramePosition = 0;
-            if (crsfFrame.frame.type != CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+            if (crsfFrame.frame.type == CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+                crsfSignalFrameReady();
+            } else {
                 const uint8_t crc = crsfFrameCRC();
                 if (crc == crsfFrame.bytes[fullFrameLength - 1]) {
                     switch (crsfFrame.frame.type)
@@ -227,15 +263,7 @@ STATIC_UNIT_TESTED uint8_t crsfFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
 STATIC_UNIT_TESTED uint16_t crsfReadRawRC(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan)
 {
     UNUSED(rxRuntimeConfig);
-    /* conversion from RC value to PWM
-     *       RC     PWM
-     * min  172 ->  988us
-     * mid  992 -> 1500us
-     * max 1811 -> 2012us
-     * scale factor = (2012-988) / (1811-172) = 0.62477120195241
-     * offset = 988 - 172 * 0.62477120195241 = 880.53935326418548
-     */
-    return (0.62477120195241f * crsfChannelData[chan]) + 881;
+    return crsfChannelToUs(crsfChannelData[chan]);
 }
 
 void crsfRxWriteTelemetryData(const void *data, int len)
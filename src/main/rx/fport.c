@@ -159,6 +159,18 @@ static void reportFrameError(uint8_t errorReason) {
     DEBUG_SET(DEBUG_FPORT, DEBUG_FPORT_FRAME_LAST_ERROR, errorReason);
 }
 
+static bool checkChecksum(uint8_t *data, uint8_t length);
+
+// Hand the flight channels of a complete control frame over for the PID loop fast path
+static void fportSignalFrameReady(fportBuffer_t *buffer)
+{
+    const fportFrame_t *frame = (const fportFrame_t *)&buffer->data[1];
+    if (buffer->data[0] == FPORT_FRAME_PAYLOAD_LENGTH_CONTROL && buffer->length == FPORT_FRAME_PAYLOAD_LENGTH_CONTROL + 2
+        && frame->type == FPORT_FRAME_TYPE_CONTROL && checkChecksum(buffer->data, buffer->length)) {
+        sbusChannelsSignalFrameReady(&frame->data.controlData.channels);
+    }
+}
+
 // Receive ISR callback
 static void fportDataReceive(uint16_t c, void *data)
 {
@@ -186,6 +198,7 @@ static void fportDataReceive(uint16_t c, void *data)
             const uint8_t nextWriteIndex = (rxBufferWriteIndex + 1) % NUM_RX_BUFFERS;
             if (nextWriteIndex != rxBufferReadIndex) {
                 rxBuffer[rxBufferWriteIndex].length = framePosition - 1;
+                fportSignalFrameReady(&rxBuffer[rxBufferWriteIndex]);
                 rxBufferWriteIndex = nextWriteIndex;
             }
 
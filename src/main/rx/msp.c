@@ -57,6 +57,7 @@ void rxMspFrameReceive(uint16_t *frame, int channelCount)
     }
 
     rxMspFrameDone = true;
+    rxSignalFrameReady(mspFrame);
 }
 
 static uint8_t rxMspFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
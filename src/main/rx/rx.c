@@ -86,6 +86,18 @@ rssiSource_e rssiSource;
 static bool rxDataProcessingRequired = false;
 static bool auxiliaryProcessingRequired = false;
 
+// Flight channels of the latest frame, as the driver handed them over when the frame was complete
+static volatile uint16_t rxFrameChannels[RX_MAPPABLE_CHANNEL_COUNT];
+static volatile bool rxFrameChannelsValid = false;
+static volatile uint32_t rxFrameReadyCount = 0;
+static volatile timeUs_t rxFrameReadyAtUs = 0;
+static uint32_t rxTaskFrame = 0;            // latest frame TASK_RX took up
+static uint32_t rxFastPathFrame = 0;        // latest frame the fast path applied
+static bool rxFastPathPending = false;
+static bool rxFastPathApplied = false;
+static bool rxFastPathDelivered = false;
+static int16_t rxFastPathData[NON_AUX_CHANNEL_COUNT];
+
 static bool rxSignalReceived = false;
 static bool rxFlightChannelsValid = false;
 static bool rxIsInFailsafeMode = true;
@@ -402,6 +414,8 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
     {
         const uint8_t frameStatus = rxRuntimeConfig.rcFrameStatusFn(&rxRuntimeConfig);
         if (frameStatus & RX_FRAME_COMPLETE) {
+            // a frame signalled while the status was read is taken as seen, it is processed here next time
+            rxTaskFrame = rxFrameReadyCount;
             rxIsInFailsafeMode = (frameStatus & RX_FRAME_FAILSAFE) != 0;
             bool rxFrameDropped = (frameStatus & RX_FRAME_DROPPED) != 0;
             signalReceived = !(rxIsInFailsafeMode || rxFrameDropped);
@@ -580,6 +594,8 @@ bool calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs)
 
     rxDataProcessingRequired = false;
     rxNextUpdateAtUs = currentTimeUs + DELAY_33_HZ;
+    rxFastPathApplied = false;
+    rxFastPathDelivered = false;
 
     // only proceed when no more samples to skip and suspend period is over
     if (skipRxSamples || currentTimeUs <= suspendRxSignalUntil) {
@@ -593,11 +609,85 @@ bool calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs)
     readRxChannelsApplyRanges();
     detectAndApplySignalLossBehaviour();
 
+    // no newer frame came in since the fast path applied one, and the failsafe processing above did not change
+    // the sticks it applied
+    rxFastPathApplied = rxFastPathPending && rxFastPathFrame == rxTaskFrame;
+    rxFastPathDelivered = rxFastPathApplied && memcmp(rcData, rxFastPathData, sizeof(rxFastPathData)) == 0;
+    rxFastPathPending = false;
+
     rcSampleIndex++;
 
     return true;
 }
 
+// Called by the rx drivers, usually from the serial receive ISR, once a complete frame has been buffered. channels
+// holds the first RX_MAPPABLE_CHANNEL_COUNT channels of the frame in microseconds, or is NULL if the frame carries
+// no sticks to fly on, e.g. when the receiver flagged it as failsafe.
+void rxSignalFrameReady(const uint16_t *channels)
+{
+    if (channels) {
+        for (int channel = 0; channel < RX_MAPPABLE_CHANNEL_COUNT; channel++) {
+            rxFrameChannels[channel] = channels[channel];
+        }
+    }
+    rxFrameChannelsValid = channels != NULL;
+    rxFrameReadyAtUs = micros();
+    rxFrameReadyCount++;
+}
+
+timeUs_t rxGetFrameReadyTimeUs(void)
+{
+    return rxFrameReadyAtUs;
+}
+
+// Apply the flight channels the driver handed over with a frame, run from the PID loop so new sticks do not have
+// to wait for TASK_RX. Only while the link is healthy; the frame status, aux channels, failsafe and mode processing
+// are left to TASK_RX, which still takes the frame up.
+bool rxFastPathUpdate(timeUs_t currentTimeUs)
+{
+    const uint32_t frame = rxFrameReadyCount;
+    if (frame == rxFastPathFrame || frame == rxTaskFrame || !rxFrameChannelsValid) {
+        return false;
+    }
+
+    if (!rxSignalReceived || rxIsInFailsafeMode || !rxFlightChannelsValid || IS_RC_MODE_ACTIVE(BOXFAILSAFE)
+        || skipRxSamples || currentTimeUs <= suspendRxSignalUntil) {
+        return false;
+    }
+
+    int16_t sample[NON_AUX_CHANNEL_COUNT];
+    for (int channel = 0; channel < NON_AUX_CHANNEL_COUNT; channel++) {
+        sample[channel] = applyRxChannelRangeConfiguraton(rxFrameChannels[rxConfig()->rcmap[channel]], rxChannelRangeConfigs(channel));
+        if (!isPulseValid(sample[channel])) {
+            // leave invalid pulses to the signal loss handling in TASK_RX
+            return false;
+        }
+    }
+
+    if (frame != rxFrameReadyCount) {
+        // a newer frame came in while the channels were read, it is picked up next time
+        return false;
+    }
+
+    memcpy(rcData, sample, sizeof(sample));
+    memcpy(rxFastPathData, sample, sizeof(sample));
+    rxFastPathFrame = frame;
+    rxFastPathPending = true;
+
+    return true;
+}
+
+// True if the frame TASK_RX just processed was already applied, and timed, by the fast path
+bool rxFastPathFrameApplied(void)
+{
+    return rxFastPathApplied;
+}
+
+bool rxFastPathFrameDelivered(void)
+{
+    return rxFastPathDelivered;
+}
+
 void parseRcChannels(const char *input, rxConfig_t *rxConfig)
 {
     for (const char *c = input; *c; c++) {
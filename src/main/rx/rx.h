@@ -153,6 +153,11 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
 bool rxIsReceivingSignal(void);
 bool rxAreFlightChannelsValid(void);
 bool calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+void rxSignalFrameReady(const uint16_t *channels);
+timeUs_t rxGetFrameReadyTimeUs(void);
+bool rxFastPathUpdate(timeUs_t currentTimeUs);
+bool rxFastPathFrameApplied(void);
+bool rxFastPathFrameDelivered(void);
 
 struct rxConfig_s;
 
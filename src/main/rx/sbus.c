@@ -135,6 +135,7 @@ static void sbusDataReceive(uint16_t c, void *data)
         } else {
             sbusFrameData->done = true;
             DEBUG_SET(DEBUG_SBUS, DEBUG_SBUS_FRAME_TIME, sbusFrameTime);
+            sbusChannelsSignalFrameReady(&sbusFrameData->frame.frame.channels);
         }
     }
 }
@@ -87,11 +87,37 @@ uint8_t sbusChannelsDecode(rxRuntimeConfig_t *rxRuntimeConfig, const sbusChannel
     return RX_FRAME_COMPLETE;
 }
 
-static uint16_t sbusChannelsReadRawRC(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan)
+static uint16_t sbusChannelToUs(uint16_t value)
 {
     // Linear fitting values read from OpenTX-ppmus and comparing with values received by X4R
     // http://www.wolframalpha.com/input/?i=linear+fit+%7B173%2C+988%7D%2C+%7B1812%2C+2012%7D%2C+%7B993%2C+1500%7D
-    return (5 * rxRuntimeConfig->channelData[chan] / 8) + 880;
+    return (5 * value / 8) + 880;
+}
+
+// Hand the flight channels of a complete frame over for the PID loop fast path, called from the receive ISR
+void sbusChannelsSignalFrameReady(const sbusChannels_t *channels)
+{
+    if (channels->flags & (SBUS_FLAG_FAILSAFE_ACTIVE | SBUS_FLAG_SIGNAL_LOSS)) {
+        rxSignalFrameReady(NULL);
+        return;
+    }
+
+    const uint16_t flightChannels[RX_MAPPABLE_CHANNEL_COUNT] = {
+        sbusChannelToUs(channels->chan0),
+        sbusChannelToUs(channels->chan1),
+        sbusChannelToUs(channels->chan2),
+        sbusChannelToUs(channels->chan3),
+        sbusChannelToUs(channels->chan4),
+        sbusChannelToUs(channels->chan5),
+        sbusChannelToUs(channels->chan6),
+        sbusChannelToUs(channels->chan7),
+    };
+    rxSignalFrameReady(flightChannels);
+}
+
+static uint16_t sbusChannelsReadRawRC(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan)
+{
+    return sbusChannelToUs(rxRuntimeConfig->channelData[chan]);
 }
 
 void sbusChannelsInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
@@ -51,6 +51,7 @@ typedef struct sbusChannels_s {
 #define SBUS_CHANNEL_DATA_LENGTH sizeof(sbusChannels_t)
 
 uint8_t sbusChannelsDecode(rxRuntimeConfig_t *rxRuntimeConfig, const sbusChannels_t *channels);
+void sbusChannelsSignalFrameReady(const sbusChannels_t *channels);
 
 void sbusChannelsInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
 
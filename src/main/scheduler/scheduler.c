@@ -201,6 +201,23 @@ timeDelta_t getTaskDeltaTime(cfTaskId_e taskId)
     }
 }
 
+/*
+ * Time left before the first realtime task is due, zero if one already is. Long running work in a lower priority
+ * task can use this to yield before it delays the main loop.
+ */
+timeDelta_t schedulerGetTimeToNextRealtimeUs(timeUs_t currentTimeUs)
+{
+    timeDelta_t timeToNextRealtimeUs = INT32_MAX;
+    // The queue is sorted by priority, realtime tasks come first
+    for (int i = 0; taskQueueArray[i] != NULL && taskQueueArray[i]->staticPriority >= TASK_PRIORITY_REALTIME; i++) {
+        const cfTask_t *task = taskQueueArray[i];
+        const timeDelta_t timeToTaskUs = cmpTimeUs(task->lastExecutedAt + task->desiredPeriod, currentTimeUs);
+        timeToNextRealtimeUs = MIN(timeToNextRealtimeUs, MAX(timeToTaskUs, 0));
+    }
+
+    return timeToNextRealtimeUs;
+}
+
 void schedulerSetCalulateTaskStatistics(bool calculateTaskStatisticsToUse)
 {
     calculateTaskStatistics = calculateTaskStatisticsToUse;
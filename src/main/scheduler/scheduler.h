@@ -132,6 +132,14 @@ typedef enum {
     TASK_PINIOBOX,
 #endif
 
+#ifdef USE_BLACKBOX
+    TASK_BLACKBOX,
+#endif
+
+#ifdef USE_CLI
+    TASK_CLI,
+#endif
+
     /* Count of real tasks */
     TASK_COUNT,
 
@@ -174,6 +182,7 @@ void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t *taskInfo);
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros);
 void setTaskEnabled(cfTaskId_e taskId, bool newEnabledState);
 timeDelta_t getTaskDeltaTime(cfTaskId_e taskId);
+timeDelta_t schedulerGetTimeToNextRealtimeUs(timeUs_t currentTimeUs);
 void schedulerSetCalulateTaskStatistics(bool calculateTaskStatistics);
 void schedulerResetTaskStatistics(cfTaskId_e taskId);
 void schedulerResetTaskMaxExecutionTime(cfTaskId_e taskId);
@@ -1182,6 +1182,11 @@ int16_t gyroRateDps(int axis)
     return lrintf(gyro.gyroADCf[axis] / ACTIVE_GYRO->gyroDev.scale);
 }
 
+const int16_t *gyroGetRawADC(void)
+{
+    return ACTIVE_GYRO->gyroDev.gyroADCRaw;
+}
+
 bool gyroOverflowDetected(void)
 {
 #ifdef USE_GYRO_OVERFLOW_CHECK
@@ -44,6 +44,7 @@
 #define EEPROM_FILENAME "eeprom.bin"
 #define EEPROM_IN_RAM
 #define EEPROM_SIZE     32768
+#define FLASH_PAGE_SIZE (0x400)
 
 #define U_ID_0 0
 #define U_ID_1 1
@@ -90,6 +91,21 @@
 
 #define USE_PARAMETER_GROUPS
 
+// Features targets opt in to when they have the RAM to spare
+#define USE_BLACKBOX_BURST
+#define USE_BLACKBOX_COLUMNAR
+#define USE_BLACKBOX_SERIAL_FRAMING
+#define BLACKBOX_WORKSPACE_SIZE 12288
+#define USE_FLASHFS_PAGE_COALESCE
+#define USE_FLASHFS_LOG
+#define USE_MSP_DATAFLASH_STREAM
+#define USE_MSP_SUBSCRIPTION
+#define USE_MSP_BATCH
+#define USE_CONFIG_TRANSFER
+#define USE_EEPROM_LOG
+#define USE_CLI_COMPRESSION
+#define USE_CONFIG_SNAPSHOT
+
 #undef STACK_CHECK // I think SITL don't need this
 #undef USE_DASHBOARD
 #undef USE_TELEMETRY_LTM
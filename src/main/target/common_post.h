@@ -181,6 +181,18 @@
 #define USE_FLASH_CHIP
 #endif
 
+#if !defined(USE_FLASHFS) || !defined(USE_FLASH_CHIP)
+#undef USE_FLASHFS_LOG
+#endif
+
+#if !defined(USE_FLASHFS)
+#undef USE_MSP_DATAFLASH_STREAM
+#endif
+
+#if defined(USE_CLI_COMPRESSION)
+#define USE_LZSS
+#endif
+
 #if defined(USE_MAX7456)
 #define USE_OSD
 #endif
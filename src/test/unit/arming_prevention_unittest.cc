@@ -810,6 +810,9 @@ extern "C" {
     void gyroStartCalibration(bool) {}
     bool isFirstArmingGyroCalibrationRunning(void) { return false; }
     void pidController(const pidProfile_t *, const rollAndPitchTrims_t *, timeUs_t) {}
+    void pidUpdateDtermAtGyroRate(void) {}
+    const int16_t *gyroGetRawADC(void) { return NULL; }
+    void blackboxBurstCapture(timeUs_t, const int16_t *) {}
     void pidStabilisationState(pidStabilisationState_e) {}
     void mixTable(timeUs_t , uint8_t) {};
     void writeMotors(void) {};
@@ -832,6 +835,12 @@ extern "C" {
     void mspSerialAllocatePorts(void) {}
     void gyroReadTemperature(void) {}
     void updateRcCommands(void) {}
+    void rcProcessNewFrame(timeUs_t, bool) {}
+    void gainScheduleUpdate(void) {}
+    bool rxFastPathUpdate(timeUs_t) { return false; }
+    bool rxFastPathFrameApplied(void) { return false; }
+    bool rxFastPathFrameDelivered(void) { return false; }
+    timeUs_t rxGetFrameReadyTimeUs(void) { return 0; }
     void applyAltHold(void) {}
     void resetYawAxis(void) {}
     int16_t calculateThrottleAngleCorrection(uint8_t) { return 0; }
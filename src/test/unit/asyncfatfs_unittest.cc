@@ -0,0 +1,681 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "drivers/sdcard.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+    #include "io/asyncfatfs/fat_standard.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * An in-memory SD card holding a 32MB FAT16 volume. Every command keeps the card busy for a while, modelled on the
+ * timings of a typical card: single block writes are slow, while blocks streamed in a multiple block write are cheap,
+ * and cheaper still when the card was told to pre-erase them. Ending a multiple block write early costs a busy period.
+ */
+#define SIM_SECTOR_SIZE         512
+#define SIM_SECTORS             65536
+#define SIM_PARTITION_START     64
+#define SIM_RESERVED_SECTORS    4
+#define SIM_ROOT_ENTRIES        512
+#define SIM_SECTORS_PER_CLUSTER 4
+#define SIM_CLUSTER_SIZE        (SIM_SECTORS_PER_CLUSTER * SIM_SECTOR_SIZE)
+#define SIM_SUPERCLUSTER_SIZE   ((SIM_SECTOR_SIZE / 2) * SIM_CLUSTER_SIZE)
+
+#define SIM_COMMAND_US            50
+#define SIM_READ_US               400
+#define SIM_SINGLE_WRITE_US       1500
+#define SIM_MULTI_WRITE_US        600
+#define SIM_PRE_ERASED_WRITE_US   150
+#define SIM_STOP_TRANSMISSION_US  1000
+
+static uint8_t simCard[SIM_SECTORS * SIM_SECTOR_SIZE];
+static uint16_t simFATSectors;
+
+static uint32_t simTimeUs;
+static uint32_t simBusyUntilUs;
+static uint32_t simCommandUs; // Command overhead charged to the next data block
+
+static bool simMultiWrite;
+static uint32_t simMultiWriteNextBlock;
+static uint32_t simMultiWriteBlocksRemain;
+static uint32_t simEraseStart;
+static uint32_t simEraseEnd;
+
+static struct {
+    bool active;
+    sdcardBlockOperation_e operation;
+    uint32_t blockIndex;
+    uint8_t *buffer;
+    sdcard_operationCompleteCallback_c callback;
+    uint32_t callbackData;
+} simPending;
+
+typedef struct simCounters_s {
+    int singleWrites;
+    int multiWriteStarts;
+    int multiWriteBlocks;
+    int preErasedBlocks;
+    int multiWriteAborts;  // ended by a non-consecutive write or a read rather than by running out of blocks
+    int reads;
+    uint32_t busyUs;
+} simCounters_t;
+
+static simCounters_t sim;
+
+static void simBusy(uint32_t durationUs)
+{
+    simBusyUntilUs = simTimeUs + durationUs;
+    sim.busyUs += durationUs;
+}
+
+static bool simIsBusy(void)
+{
+    return simPending.active || simTimeUs < simBusyUntilUs;
+}
+
+static void simAbortMultiWrite(void)
+{
+    simMultiWrite = false;
+    sim.multiWriteAborts++;
+    simBusy(SIM_STOP_TRANSMISSION_US);
+}
+
+static void simWriteLE16(uint8_t *p, uint16_t value)
+{
+    p[0] = value & 0xFF;
+    p[1] = value >> 8;
+}
+
+static void simWriteLE32(uint8_t *p, uint32_t value)
+{
+    simWriteLE16(p, value & 0xFFFF);
+    simWriteLE16(p + 2, value >> 16);
+}
+
+static uint32_t simRootDirectorySector(void)
+{
+    return SIM_PARTITION_START + SIM_RESERVED_SECTORS + 2 * simFATSectors;
+}
+
+static uint32_t simClusterSector(uint32_t cluster)
+{
+    return simRootDirectorySector() + SIM_ROOT_ENTRIES * FAT_DIRECTORY_ENTRY_SIZE / SIM_SECTOR_SIZE + (cluster - 2) * SIM_SECTORS_PER_CLUSTER;
+}
+
+static uint16_t simFATEntry(uint32_t cluster)
+{
+    const uint8_t *fat = &simCard[(SIM_PARTITION_START + SIM_RESERVED_SECTORS) * SIM_SECTOR_SIZE];
+
+    return fat[cluster * 2] | (fat[cluster * 2 + 1] << 8);
+}
+
+static void simFormat(void)
+{
+    memset(simCard, 0, sizeof(simCard));
+
+    const uint32_t partitionSectors = SIM_SECTORS - SIM_PARTITION_START;
+    const uint32_t rootSectors = SIM_ROOT_ENTRIES * FAT_DIRECTORY_ENTRY_SIZE / SIM_SECTOR_SIZE;
+
+    // Smallest FAT that covers the clusters left over once the FATs themselves are accounted for
+    simFATSectors = 1;
+    while (true) {
+        const uint32_t clusters = (partitionSectors - SIM_RESERVED_SECTORS - rootSectors - 2 * simFATSectors) / SIM_SECTORS_PER_CLUSTER;
+        if ((clusters + 2) * 2 <= simFATSectors * SIM_SECTOR_SIZE) {
+            break;
+        }
+        simFATSectors++;
+    }
+
+    uint8_t *mbr = simCard;
+    mbr[446 + 4] = MBR_PARTITION_TYPE_FAT16_LBA;
+    simWriteLE32(&mbr[446 + 8], SIM_PARTITION_START);
+    simWriteLE32(&mbr[446 + 12], partitionSectors);
+    mbr[510] = 0x55;
+    mbr[511] = 0xAA;
+
+    uint8_t *volume = &simCard[SIM_PARTITION_START * SIM_SECTOR_SIZE];
+    volume[0] = 0xEB;
+    volume[1] = 0x3C;
+    volume[2] = 0x90;
+    simWriteLE16(&volume[11], SIM_SECTOR_SIZE);
+    volume[13] = SIM_SECTORS_PER_CLUSTER;
+    simWriteLE16(&volume[14], SIM_RESERVED_SECTORS);
+    volume[16] = 2;
+    simWriteLE16(&volume[17], SIM_ROOT_ENTRIES);
+    volume[21] = 0xF8;
+    simWriteLE16(&volume[22], simFATSectors);
+    simWriteLE32(&volume[32], partitionSectors);
+    volume[38] = 0x29;
+    memcpy(&volume[54], "FAT16   ", 8);
+    volume[510] = FAT_VOLUME_ID_SIGNATURE_1;
+    volume[511] = FAT_VOLUME_ID_SIGNATURE_2;
+
+    for (int fat = 0; fat < 2; fat++) {
+        uint8_t *entries = &simCard[(SIM_PARTITION_START + SIM_RESERVED_SECTORS + fat * simFATSectors) * SIM_SECTOR_SIZE];
+        simWriteLE16(&entries[0], 0xFFF8);
+        simWriteLE16(&entries[2], 0xFFFF);
+    }
+}
+
+static void simReset(void)
+{
+    simFormat();
+
+    simTimeUs = 0;
+    simBusyUntilUs = 0;
+    simCommandUs = 0;
+    simMultiWrite = false;
+    memset(&simPending, 0, sizeof(simPending));
+    memset(&sim, 0, sizeof(sim));
+}
+
+static const fatDirectoryEntry_t *simFindDirectoryEntry(const char *fatName)
+{
+    const fatDirectoryEntry_t *entries = (const fatDirectoryEntry_t *) &simCard[simRootDirectorySector() * SIM_SECTOR_SIZE];
+
+    for (int i = 0; i < SIM_ROOT_ENTRIES; i++) {
+        if (memcmp(entries[i].filename, fatName, FAT_FILENAME_LENGTH) == 0) {
+            return &entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Follow the file's chain through the first FAT, returning the number of clusters in it. Fails the test if the chain
+ * isn't one run of consecutive clusters.
+ */
+static uint32_t simContiguousChainLength(uint32_t firstCluster)
+{
+    uint32_t length = 0;
+
+    for (uint32_t cluster = firstCluster; cluster != 0; ) {
+        const uint16_t next = simFATEntry(cluster);
+        length++;
+        if (next >= 0xFFF8) {
+            break;
+        }
+        EXPECT_EQ(cluster + 1, next) << "chain breaks after cluster " << cluster;
+        if (next != cluster + 1) {
+            break;
+        }
+        cluster = next;
+    }
+
+    return length;
+}
+
+// Let the card and the filesystem run for a while
+static void simRun(uint32_t durationUs)
+{
+    const uint32_t stepUs = 50;
+
+    for (uint32_t elapsedUs = 0; elapsedUs < durationUs; elapsedUs += stepUs) {
+        simTimeUs += stepUs;
+        afatfs_poll();
+    }
+}
+
+static afatfsFilePtr_t openedFile;
+static bool openDone;
+static bool closeDone;
+
+static void fileOpened(afatfsFilePtr_t file)
+{
+    openedFile = file;
+    openDone = true;
+}
+
+static void fileClosed(void)
+{
+    closeDone = true;
+}
+
+static void mount(void)
+{
+    afatfs_init();
+
+    for (int i = 0; i < 100000 && afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_INITIALIZATION; i++) {
+        simRun(100);
+    }
+
+    ASSERT_EQ(AFATFS_FILESYSTEM_STATE_READY, afatfs_getFilesystemState());
+}
+
+static void unmount(void)
+{
+    while (!afatfs_destroy(false)) {
+        simRun(100);
+    }
+}
+
+static afatfsFilePtr_t openFile(const char *filename, const char *mode)
+{
+    openDone = false;
+    openedFile = NULL;
+    afatfs_fopen(filename, mode, fileOpened);
+
+    for (int i = 0; i < 10000 && !openDone; i++) {
+        simRun(100);
+    }
+
+    return openedFile;
+}
+
+static void closeFile(afatfsFilePtr_t file)
+{
+    closeDone = false;
+    while (!afatfs_fclose(file, fileClosed)) {
+        simRun(100);
+    }
+
+    for (int i = 0; i < 10000 && !closeDone; i++) {
+        simRun(100);
+    }
+    EXPECT_TRUE(closeDone);
+}
+
+static uint8_t patternByte(uint32_t offset)
+{
+    return (offset * 7 + (offset >> 9)) & 0xFF;
+}
+
+/**
+ * Append `length` bytes to the file as a logger would: a chunk every `intervalUs`, holding on to whatever the cache
+ * can't take yet until it can. Counters are captured in `warmedUp` once the first 64KB have been written.
+ */
+static void streamToFile(afatfsFilePtr_t file, uint32_t length, uint32_t chunkSize, uint32_t intervalUs, simCounters_t *warmedUp)
+{
+    uint8_t chunk[512];
+    uint32_t written = 0;
+
+    while (written < length) {
+        const uint32_t chunkLength = MIN(chunkSize, length - written);
+        for (uint32_t i = 0; i < chunkLength; i++) {
+            chunk[i] = patternByte(written + i);
+        }
+
+        uint32_t accepted = 0;
+        for (int tries = 0; accepted < chunkLength; tries++) {
+            ASSERT_LT(tries, 100000);
+            accepted += afatfs_fwrite(file, chunk + accepted, chunkLength - accepted);
+            if (accepted < chunkLength) {
+                simRun(50);
+            }
+        }
+
+        if (written < 65536 && written + chunkLength >= 65536 && warmedUp) {
+            *warmedUp = sim;
+        }
+        written += chunkLength;
+
+        simRun(intervalUs);
+    }
+}
+
+static void expectFileMatches(const char *filename, uint32_t length)
+{
+    afatfsFilePtr_t file = openFile(filename, "r");
+    ASSERT_TRUE(file != NULL);
+
+    uint8_t buffer[512];
+    uint32_t offset = 0;
+
+    for (int tries = 0; !afatfs_feof(file); tries++) {
+        ASSERT_LT(tries, 1000000);
+
+        const uint32_t bytesRead = afatfs_fread(file, buffer, sizeof(buffer));
+        for (uint32_t i = 0; i < bytesRead; i++) {
+            ASSERT_EQ(patternByte(offset + i), buffer[i]) << "at offset " << offset + i;
+        }
+        offset += bytesRead;
+
+        if (bytesRead == 0) {
+            simRun(50);
+        }
+    }
+
+    EXPECT_EQ(length, offset);
+
+    closeFile(file);
+}
+
+TEST(AsyncFatFsTest, PreallocatedFileStreamsWithoutMetadataWrites)
+{
+    simReset();
+    mount();
+
+    const uint32_t freeSpace = afatfs_getContiguousFreeSpace();
+    ASSERT_GT(freeSpace, 16U * 1024 * 1024);
+
+    afatfsFilePtr_t file = openFile("stream.bin", "ap");
+    ASSERT_TRUE(file != NULL);
+
+    // 6MB at 512KB/s, inside one preallocation
+    const uint32_t length = 6 * 1024 * 1024 + 1000;
+    simCounters_t warmedUp;
+    streamToFile(file, length, 512, 1000, &warmedUp);
+
+    // Once streaming, every block went out in the one pre-erased multiple block write
+    EXPECT_EQ(warmedUp.singleWrites, sim.singleWrites);
+    EXPECT_EQ(warmedUp.multiWriteStarts, sim.multiWriteStarts);
+    EXPECT_EQ(warmedUp.multiWriteAborts, sim.multiWriteAborts);
+    EXPECT_EQ(sim.multiWriteBlocks - warmedUp.multiWriteBlocks, sim.preErasedBlocks - warmedUp.preErasedBlocks);
+
+    closeFile(file);
+
+    // The superclusters past the end of the data went back to the freefile
+    const uint32_t usedSize = (length + SIM_SUPERCLUSTER_SIZE - 1) / SIM_SUPERCLUSTER_SIZE * SIM_SUPERCLUSTER_SIZE;
+    EXPECT_EQ(freeSpace - usedSize, afatfs_getContiguousFreeSpace());
+
+    unmount();
+
+    // What's on the card is a well formed file followed by the freefile
+    const fatDirectoryEntry_t *entry = simFindDirectoryEntry("STREAM  BIN");
+    ASSERT_TRUE(entry != NULL);
+    EXPECT_EQ(length, entry->fileSize);
+
+    const uint32_t firstCluster = entry->firstClusterLow;
+    EXPECT_EQ(usedSize / SIM_CLUSTER_SIZE, simContiguousChainLength(firstCluster));
+
+    // The data landed in the clusters the directory entry points at
+    const uint8_t *data = &simCard[simClusterSector(firstCluster) * SIM_SECTOR_SIZE];
+    for (uint32_t i = 0; i < SIM_CLUSTER_SIZE; i++) {
+        ASSERT_EQ(patternByte(i), data[i]) << "at offset " << i;
+    }
+
+    const fatDirectoryEntry_t *freeFileEntry = simFindDirectoryEntry("FREESPACE  ");
+    ASSERT_TRUE(freeFileEntry != NULL);
+    EXPECT_EQ(firstCluster + usedSize / SIM_CLUSTER_SIZE, freeFileEntry->firstClusterLow);
+    EXPECT_EQ(freeSpace - usedSize, freeFileEntry->fileSize);
+    EXPECT_EQ((freeSpace - usedSize) / SIM_CLUSTER_SIZE, simContiguousChainLength(freeFileEntry->firstClusterLow));
+
+    mount();
+    EXPECT_EQ(freeSpace - usedSize, afatfs_getContiguousFreeSpace());
+    expectFileMatches("stream.bin", length);
+    unmount();
+}
+
+TEST(AsyncFatFsTest, SuperclusterFileUpdatesMetadataWhileStreaming)
+{
+    simReset();
+    mount();
+
+    afatfsFilePtr_t file = openFile("stream.bin", "as");
+    ASSERT_TRUE(file != NULL);
+
+    const uint32_t length = 6 * 1024 * 1024 + 1000;
+    simCounters_t warmedUp;
+    streamToFile(file, length, 512, 1000, &warmedUp);
+
+    // Each new supercluster interrupts the stream to update the FAT and directory
+    EXPECT_GE(sim.singleWrites - warmedUp.singleWrites, 10);
+    EXPECT_GE(sim.multiWriteStarts - warmedUp.multiWriteStarts, 10);
+    const uint32_t superclusterBusyUs = sim.busyUs;
+
+    closeFile(file);
+    unmount();
+
+    // The same stream written in preallocated mode keeps the card busy for less time
+    simReset();
+    mount();
+
+    file = openFile("stream.bin", "ap");
+    ASSERT_TRUE(file != NULL);
+    streamToFile(file, length, 512, 1000, NULL);
+    EXPECT_LT(sim.busyUs, superclusterBusyUs);
+
+    closeFile(file);
+    expectFileMatches("stream.bin", length);
+    unmount();
+}
+
+TEST(AsyncFatFsTest, PreallocatedFileGrowsPastOnePreallocation)
+{
+    simReset();
+    mount();
+
+    const uint32_t freeSpace = afatfs_getContiguousFreeSpace();
+
+    afatfsFilePtr_t file = openFile("stream.bin", "ap");
+    ASSERT_TRUE(file != NULL);
+
+    // Past the 8MB the test build preallocates at a time
+    const uint32_t length = 10 * 1024 * 1024;
+    simCounters_t warmedUp;
+    streamToFile(file, length, 512, 500, &warmedUp);
+
+    // One more run of superclusters was taken along the way
+    EXPECT_EQ(warmedUp.multiWriteStarts + 2, sim.multiWriteStarts);
+
+    closeFile(file);
+    EXPECT_EQ(freeSpace - length, afatfs_getContiguousFreeSpace());
+
+    unmount();
+
+    const fatDirectoryEntry_t *entry = simFindDirectoryEntry("STREAM  BIN");
+    ASSERT_TRUE(entry != NULL);
+    EXPECT_EQ(length / SIM_CLUSTER_SIZE, simContiguousChainLength(entry->firstClusterLow));
+
+    mount();
+    expectFileMatches("stream.bin", length);
+    unmount();
+}
+
+TEST(AsyncFatFsTest, DeletedPreallocatedFileReturnsAllSpace)
+{
+    simReset();
+    mount();
+
+    const uint32_t freeSpace = afatfs_getContiguousFreeSpace();
+
+    afatfsFilePtr_t file = openFile("stream.bin", "ap");
+    ASSERT_TRUE(file != NULL);
+    streamToFile(file, 100000, 512, 1000, NULL);
+
+    closeDone = false;
+    while (!afatfs_funlink(file, fileClosed)) {
+        simRun(100);
+    }
+    for (int i = 0; i < 10000 && !closeDone; i++) {
+        simRun(100);
+    }
+    ASSERT_TRUE(closeDone);
+
+    EXPECT_EQ(freeSpace, afatfs_getContiguousFreeSpace());
+
+    // A short file only keeps the one supercluster it needs
+    file = openFile("short.bin", "ap");
+    ASSERT_TRUE(file != NULL);
+    streamToFile(file, 100, 100, 1000, NULL);
+    closeFile(file);
+
+    EXPECT_EQ(freeSpace - SIM_SUPERCLUSTER_SIZE, afatfs_getContiguousFreeSpace());
+
+    unmount();
+    mount();
+    EXPECT_EQ(freeSpace - SIM_SUPERCLUSTER_SIZE, afatfs_getContiguousFreeSpace());
+    expectFileMatches("short.bin", 100);
+    unmount();
+}
+
+// STUBS
+
+extern "C" {
+
+void sdcard_init(const sdcardConfig_t *config)
+{
+    UNUSED(config);
+}
+
+bool sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (simIsBusy()) {
+        return false;
+    }
+
+    if (simMultiWrite) {
+        simAbortMultiWrite();
+        return false;
+    }
+
+    sim.reads++;
+    simBusy(SIM_COMMAND_US + SIM_READ_US);
+
+    simPending.active = true;
+    simPending.operation = SDCARD_BLOCK_OPERATION_READ;
+    simPending.blockIndex = blockIndex;
+    simPending.buffer = buffer;
+    simPending.callback = callback;
+    simPending.callbackData = callbackData;
+
+    return true;
+}
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    if (simIsBusy()) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    if (simMultiWrite) {
+        if (blockIndex == simMultiWriteNextBlock) {
+            return SDCARD_OPERATION_SUCCESS;
+        }
+        simAbortMultiWrite();
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    // ACMD23 then CMD25, the data follows with the next write
+    sim.multiWriteStarts++;
+    simCommandUs = 2 * SIM_COMMAND_US;
+    simMultiWrite = true;
+    simMultiWriteNextBlock = blockIndex;
+    simMultiWriteBlocksRemain = blockCount;
+    simEraseStart = blockIndex;
+    simEraseEnd = blockIndex + blockCount;
+
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (simIsBusy()) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    EXPECT_LT(blockIndex, (uint32_t)SIM_SECTORS);
+    EXPECT_NE(0U, blockIndex);
+
+    uint32_t durationUs;
+
+    if (simMultiWrite) {
+        if (blockIndex != simMultiWriteNextBlock) {
+            simAbortMultiWrite();
+            return SDCARD_OPERATION_BUSY;
+        }
+
+        sim.multiWriteBlocks++;
+        if (blockIndex >= simEraseStart && blockIndex < simEraseEnd) {
+            sim.preErasedBlocks++;
+            durationUs = simCommandUs + SIM_PRE_ERASED_WRITE_US;
+        } else {
+            durationUs = simCommandUs + SIM_MULTI_WRITE_US;
+        }
+        simCommandUs = 0;
+
+        simMultiWriteNextBlock++;
+        if (--simMultiWriteBlocksRemain == 0) {
+            simMultiWrite = false;
+            durationUs += SIM_STOP_TRANSMISSION_US;
+        }
+    } else {
+        sim.singleWrites++;
+        durationUs = SIM_COMMAND_US + SIM_SINGLE_WRITE_US;
+    }
+
+    simBusy(durationUs);
+
+    simPending.active = true;
+    simPending.operation = SDCARD_BLOCK_OPERATION_WRITE;
+    simPending.blockIndex = blockIndex;
+    simPending.buffer = buffer;
+    simPending.callback = callback;
+    simPending.callbackData = callbackData;
+
+    return SDCARD_OPERATION_IN_PROGRESS;
+}
+
+bool sdcard_poll(void)
+{
+    if (simPending.active && simTimeUs >= simBusyUntilUs) {
+        uint8_t *block = &simCard[simPending.blockIndex * SIM_SECTOR_SIZE];
+
+        if (simPending.operation == SDCARD_BLOCK_OPERATION_READ) {
+            memcpy(simPending.buffer, block, SIM_SECTOR_SIZE);
+        } else {
+            memcpy(block, simPending.buffer, SIM_SECTOR_SIZE);
+        }
+
+        simPending.active = false;
+        if (simPending.callback) {
+            simPending.callback(simPending.operation, simPending.blockIndex, simPending.buffer, simPending.callbackData);
+        }
+    }
+
+    return !simIsBusy();
+}
+
+bool sdcard_isInserted(void)
+{
+    return true;
+}
+
+bool sdcard_isInitialized(void)
+{
+    return true;
+}
+
+bool sdcard_isFunctional(void)
+{
+    return true;
+}
+
+const sdcardMetadata_t* sdcard_getMetadata(void)
+{
+    return NULL;
+}
+
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback)
+{
+    UNUSED(callback);
+}
+
+}
@@ -0,0 +1,149 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_burst.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static blackboxBurstSample_t ring[1024];
+static timeUs_t sampleTimeUs;
+
+// Start with the ring the blackbox would provide for the window at 8kHz
+static void startBurst(uint16_t windowMs, uint8_t preTriggerPercent)
+{
+    blackboxBurstStart(ring, blackboxBurstWindowSamples(windowMs, 125), preTriggerPercent);
+}
+
+// Feed samples 125us apart, each axis carrying the sample number so the order can be checked
+static void captureSamples(int first, int count)
+{
+    for (int i = first; i < first + count; i++) {
+        const int16_t gyroADCRaw[XYZ_AXIS_COUNT] = { (int16_t)i, (int16_t)-i, (int16_t)(i * 2) };
+        blackboxBurstCapture(sampleTimeUs, gyroADCRaw);
+        sampleTimeUs += 125;
+    }
+}
+
+static void expectSamplesFrom(int first)
+{
+    const uint16_t count = blackboxBurstSampleCount();
+    for (int i = 0; i < count; i++) {
+        const blackboxBurstSample_t *sample = blackboxBurstGetSample(i);
+        ASSERT_NE(nullptr, sample);
+        EXPECT_EQ(first + i, sample->gyroADCRaw[X]);
+        EXPECT_EQ(-(first + i), sample->gyroADCRaw[Y]);
+        EXPECT_EQ(2 * (first + i), sample->gyroADCRaw[Z]);
+        if (i) {
+            EXPECT_EQ(125, sample->deltaUs);
+        }
+    }
+    EXPECT_EQ(nullptr, blackboxBurstGetSample(count));
+}
+
+TEST(BlackboxBurstTest, DisabledWithoutWindow)
+{
+    startBurst(0, 25);
+    EXPECT_FALSE(blackboxBurstIsRecording());
+    blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_SWITCH);
+    captureSamples(0, 10);
+    EXPECT_FALSE(blackboxBurstFreeze());
+    EXPECT_EQ(0, blackboxBurstSampleCount());
+}
+
+TEST(BlackboxBurstTest, NoCaptureWithoutTrigger)
+{
+    startBurst(100, 25);
+    EXPECT_TRUE(blackboxBurstIsRecording());
+    captureSamples(0, 2000);
+    EXPECT_FALSE(blackboxBurstFreeze());
+    EXPECT_EQ(0, blackboxBurstSampleCount());
+}
+
+TEST(BlackboxBurstTest, KeepsPreTriggerHistory)
+{
+    // 100ms at 8kHz is 800 samples, a quarter of them from before the trigger
+    sampleTimeUs = 1000000;
+    startBurst(100, 25);
+    captureSamples(0, 1000);
+    blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_CRASH);
+
+    // A second trigger doesn't move the window
+    captureSamples(1000, 300);
+    blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_SWITCH);
+    captureSamples(1300, 300);
+
+    // Recording stops by itself once the window is full
+    EXPECT_FALSE(blackboxBurstIsRecording());
+    captureSamples(1600, 100);
+
+    EXPECT_TRUE(blackboxBurstFreeze());
+    EXPECT_EQ(800, blackboxBurstSampleCount());
+    EXPECT_EQ(200, blackboxBurstTriggerIndex());
+    EXPECT_EQ(BLACKBOX_BURST_TRIGGER_CRASH, blackboxBurstTriggerSource());
+    EXPECT_EQ(1000000u + 800 * 125, blackboxBurstStartTime());
+    expectSamplesFrom(800);
+}
+
+TEST(BlackboxBurstTest, DisarmDuringPostTrigger)
+{
+    sampleTimeUs = 0;
+    startBurst(100, 50);
+    captureSamples(0, 100);
+    blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_GYRO_OVERFLOW);
+    captureSamples(100, 50);
+
+    // Whatever was recorded before disarming is kept
+    EXPECT_TRUE(blackboxBurstFreeze());
+    EXPECT_EQ(150, blackboxBurstSampleCount());
+    EXPECT_EQ(100, blackboxBurstTriggerIndex());
+    EXPECT_EQ(0u, blackboxBurstStartTime());
+    expectSamplesFrom(0);
+
+    blackboxBurstStop();
+    EXPECT_EQ(0, blackboxBurstSampleCount());
+}
+
+TEST(BlackboxBurstTest, WindowSizedFromConfig)
+{
+    EXPECT_EQ(800, blackboxBurstWindowSamples(100, 125));
+    EXPECT_EQ(8000, blackboxBurstWindowSamples(1000, 125));
+    EXPECT_EQ(0, blackboxBurstWindowSamples(0, 125));
+    EXPECT_EQ(0, blackboxBurstWindowSamples(100, 0));
+
+    // a ring smaller than the window, as when the workspace is short, holds the latest samples it has room for
+    blackboxBurstStart(ring, 64, 0);
+    captureSamples(0, 10);
+    blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_SWITCH);
+    captureSamples(10, 64);
+
+    EXPECT_TRUE(blackboxBurstFreeze());
+    EXPECT_EQ(64, blackboxBurstSampleCount());
+    EXPECT_EQ(0, blackboxBurstTriggerIndex());
+    expectSamplesFrom(10);
+
+    // and no ring records nothing
+    blackboxBurstStart(NULL, 64, 0);
+    EXPECT_FALSE(blackboxBurstIsRecording());
+}
@@ -0,0 +1,170 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host side decoder for columnar blackbox blocks, the counterpart of the encoder in blackbox/blackbox_columnar.c.
+ * The coder constants and the predictors must agree with it.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "blackbox_columnar_decoder.h"
+
+#define RC_TOP_VALUE            (1 << 24)
+#define RC_PROB_BITS            11
+#define RC_PROB_INIT            (1 << (RC_PROB_BITS - 1))
+#define RC_ADAPT_SHIFT          4
+
+#define RESIDUAL_LENGTH_BITS    6
+
+typedef struct residualModel_s {
+    uint16_t lengthProbs[1 << RESIDUAL_LENGTH_BITS];
+} residualModel_t;
+
+static void modelReset(residualModel_t *model)
+{
+    for (unsigned i = 0; i < (1 << RESIDUAL_LENGTH_BITS); i++) {
+        model->lengthProbs[i] = RC_PROB_INIT;
+    }
+}
+
+static int32_t predict(const int32_t *column, int index, blackboxColumnarPredictor_e predictor)
+{
+    if (index == 0) {
+        return 0;
+    }
+    if (predictor == BLACKBOX_COLUMNAR_PREDICT_DELTA || index == 1) {
+        return column[index - 1];
+    }
+    return (int32_t)(2 * (uint32_t)column[index - 1] - (uint32_t)column[index - 2]);
+}
+
+typedef struct rangeDecoder_s {
+    const uint8_t *data;
+    int length;
+    int position;
+    uint32_t range;
+    uint32_t code;
+} rangeDecoder_t;
+
+static uint8_t rcNextByte(rangeDecoder_t *rc)
+{
+    // Reads past the end are flagged through the position and caught by the caller
+    return rc->position < rc->length ? rc->data[rc->position++] : (rc->position++, 0);
+}
+
+static void rcNormalize(rangeDecoder_t *rc)
+{
+    while (rc->range < RC_TOP_VALUE) {
+        rc->range <<= 8;
+        rc->code = (rc->code << 8) | rcNextByte(rc);
+    }
+}
+
+static int rcDecodeBit(rangeDecoder_t *rc, uint16_t *prob)
+{
+    const uint32_t bound = (rc->range >> RC_PROB_BITS) * *prob;
+    int bit;
+
+    if (rc->code < bound) {
+        rc->range = bound;
+        *prob += ((1 << RC_PROB_BITS) - *prob) >> RC_ADAPT_SHIFT;
+        bit = 0;
+    } else {
+        rc->code -= bound;
+        rc->range -= bound;
+        *prob -= *prob >> RC_ADAPT_SHIFT;
+        bit = 1;
+    }
+    rcNormalize(rc);
+
+    return bit;
+}
+
+static uint32_t rcDecodeDirectBits(rangeDecoder_t *rc, int count)
+{
+    uint32_t value = 0;
+
+    while (count--) {
+        rc->range >>= 1;
+        const int bit = rc->code >= rc->range;
+        if (bit) {
+            rc->code -= rc->range;
+        }
+        value = (value << 1) | bit;
+        rcNormalize(rc);
+    }
+
+    return value;
+}
+
+static uint32_t decodeResidual(rangeDecoder_t *rc, residualModel_t *model)
+{
+    unsigned node = 1;
+    for (int i = 0; i < RESIDUAL_LENGTH_BITS; i++) {
+        node = (node << 1) | rcDecodeBit(rc, &model->lengthProbs[node]);
+    }
+    const int length = node - (1 << RESIDUAL_LENGTH_BITS);
+
+    if (length == 0) {
+        return 0;
+    }
+    if (length > 32) {
+        return 0xFFFFFFFF; // corrupt, caught by the caller as an overrun or garbage values
+    }
+    return (1u << (length - 1)) | (length > 1 ? rcDecodeDirectBits(rc, length - 1) : 0);
+}
+
+/**
+ * Decode one block. Returns the number of bytes the block occupied, or -1 if the data is truncated or malformed.
+ */
+int blackboxColumnarDecodeBlock(const uint8_t *data, int length, blackboxColumnarBlock_t *block)
+{
+    if (length < 2 || data[0] > BLACKBOX_COLUMNAR_BLOCK_FRAMES || data[1] > BLACKBOX_COLUMNAR_MAX_COLUMNS) {
+        return -1;
+    }
+
+    block->frameCount = data[0];
+    block->columnCount = data[1];
+
+    rangeDecoder_t rc = {
+        .data = data,
+        .length = length,
+        .position = 2,
+        .range = 0xFFFFFFFF,
+        .code = 0,
+    };
+    for (int i = 0; i < 5; i++) {
+        rc.code = (rc.code << 8) | rcNextByte(&rc);
+    }
+
+    for (int c = 0; c < block->columnCount; c++) {
+        int32_t *column = block->values[c];
+        const blackboxColumnarPredictor_e predictor = rcDecodeDirectBits(&rc, 1);
+
+        residualModel_t model;
+        modelReset(&model);
+        for (int i = 0; i < block->frameCount; i++) {
+            const uint32_t residual = decodeResidual(&rc, &model);
+            const int32_t delta = (residual >> 1) ^ -(int32_t)(residual & 1);
+            column[i] = (int32_t)((uint32_t)predict(column, i, predictor) + (uint32_t)delta);
+        }
+    }
+
+    return rc.position <= length ? rc.position : -1;
+}
@@ -0,0 +1,228 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_columnar.h"
+
+    #include "common/encoding.h"
+
+    #include "blackbox_columnar_decoder.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static uint8_t encoded[65536];
+static blackboxColumnarColumn_t blockColumns[3][BLACKBOX_COLUMNAR_MAX_COLUMNS];
+static blackboxColumnarColumn_t decodedColumns[BLACKBOX_COLUMNAR_MAX_COLUMNS];
+static int encodedLength;
+
+static void writeEncoded(uint8_t value)
+{
+    if (encodedLength < (int)sizeof(encoded)) {
+        encoded[encodedLength] = value;
+    }
+    encodedLength++;
+}
+
+static uint32_t lcgState;
+
+static uint32_t lcg(void)
+{
+    lcgState = lcgState * 1664525 + 1013904223;
+    return lcgState;
+}
+
+static void expectBlocksEqual(const blackboxColumnarBlock_t *expected, const blackboxColumnarBlock_t *actual)
+{
+    ASSERT_EQ(expected->frameCount, actual->frameCount);
+    ASSERT_EQ(expected->columnCount, actual->columnCount);
+    for (int c = 0; c < expected->columnCount; c++) {
+        for (int i = 0; i < expected->frameCount; i++) {
+            EXPECT_EQ(expected->values[c][i], actual->values[c][i]) << "column " << c << " frame " << i;
+        }
+    }
+}
+
+TEST(BlackboxColumnarTest, TestRoundTripExtremes)
+{
+    blackboxColumnarBlock_t block;
+    blackboxColumnarBlock_t decoded;
+    int32_t values[5];
+
+    lcgState = 1;
+    blackboxColumnarBlockInit(&block, blockColumns[0], 5);
+    blackboxColumnarBlockInit(&decoded, decodedColumns, BLACKBOX_COLUMNAR_MAX_COLUMNS);
+    for (int i = 0; i < BLACKBOX_COLUMNAR_BLOCK_FRAMES; i++) {
+        values[0] = 0;
+        values[1] = (i & 1) ? INT32_MAX : INT32_MIN;
+        values[2] = (int32_t)lcg();
+        values[3] = i * 125 + 0x7FFFFF00; // wraps
+        values[4] = -i;
+        EXPECT_EQ(i == BLACKBOX_COLUMNAR_BLOCK_FRAMES - 1, blackboxColumnarBlockAddFrame(&block, values));
+    }
+
+    encodedLength = 0;
+    blackboxColumnarEncodeBlock(&block, writeEncoded);
+
+    EXPECT_EQ(encodedLength, blackboxColumnarDecodeBlock(encoded, encodedLength, &decoded));
+    expectBlocksEqual(&block, &decoded);
+}
+
+TEST(BlackboxColumnarTest, TestBlocksDecodeIndependently)
+{
+    blackboxColumnarBlock_t blocks[3];
+    blackboxColumnarBlock_t decoded;
+    int32_t values[8];
+
+    lcgState = 2;
+    encodedLength = 0;
+    blackboxColumnarBlockInit(&decoded, decodedColumns, BLACKBOX_COLUMNAR_MAX_COLUMNS);
+    for (int b = 0; b < 3; b++) {
+        blackboxColumnarBlockInit(&blocks[b], blockColumns[b], 8);
+        // the last block is a partial one, as written at the end of a log
+        const int frames = b == 2 ? 7 : BLACKBOX_COLUMNAR_BLOCK_FRAMES;
+        for (int i = 0; i < frames; i++) {
+            for (int c = 0; c < 8; c++) {
+                values[c] = (int32_t)(lcg() >> (24 + c));
+            }
+            blackboxColumnarBlockAddFrame(&blocks[b], values);
+        }
+
+        // encoding one column per call must give the same stream as encoding in one go
+        blackboxColumnarEncoder_t encoder;
+        blackboxColumnarEncodeBegin(&encoder, &blocks[b], writeEncoded);
+        int calls = 1;
+        while (!blackboxColumnarEncodeColumn(&encoder)) {
+            calls++;
+        }
+        EXPECT_EQ(8, calls);
+    }
+
+    // decode the second block on its own
+    int offset = blackboxColumnarDecodeBlock(encoded, encodedLength, &decoded);
+    ASSERT_GT(offset, 0);
+    const int secondLength = blackboxColumnarDecodeBlock(encoded + offset, encodedLength - offset, &decoded);
+    ASSERT_GT(secondLength, 0);
+    expectBlocksEqual(&blocks[1], &decoded);
+
+    offset += secondLength;
+    EXPECT_EQ(encodedLength - offset, blackboxColumnarDecodeBlock(encoded + offset, encodedLength - offset, &decoded));
+    expectBlocksEqual(&blocks[2], &decoded);
+
+    // truncated blocks are rejected
+    EXPECT_EQ(-1, blackboxColumnarDecodeBlock(encoded + offset, encodedLength - offset - 1, &decoded));
+    EXPECT_EQ(-1, blackboxColumnarDecodeBlock(encoded, 1, &decoded));
+}
+
+/*
+ * Synthesise a flight: loop iteration and time, PID terms, rc commands, gyro and motors following a set of manoeuvres
+ * plus noise, laid out like the main I-frame fields.
+ */
+#define FLIGHT_FIELDS 29
+
+static void flightFrame(int frame, int32_t *values)
+{
+    const float t = frame * 0.0005f;
+    int n = 0;
+
+    values[n++] = frame;
+    values[n++] = 1000000 + frame * 500 + (int32_t)(lcg() % 3) - 1;
+    for (int axis = 0; axis < 3; axis++) {
+        const float setpoint = 300.0f * sinf(t * (0.7f + axis)) + 80.0f * sinf(t * 5.3f);
+        const float gyro = setpoint * 0.97f + (int32_t)(lcg() % 41) - 20;
+        values[n++] = lrintf((setpoint - gyro) * 0.5f);                  // P
+        values[n++] = lrintf(30.0f * sinf(t * 0.2f + axis));             // I
+        values[n++] = lrintf(((int32_t)(lcg() % 61) - 30) * 0.4f);       // D
+        values[n++] = lrintf(setpoint * 0.1f);                           // F
+        values[n++] = lrintf(setpoint / 2);                              // rcCommand
+        values[n++] = lrintf(gyro);                                      // gyroADC
+    }
+    values[n++] = 400 + lrintf(200 * sinf(t * 0.5f));                     // throttle
+    values[n++] = 20 + (frame / 4000);                                    // vbat
+    values[n++] = 1000;                                                   // rssi
+    values[n++] = 1200 + lrintf(300 * sinf(t * 0.5f)) + (int32_t)(lcg() % 21) - 10;
+    for (int motor = 1; motor < 4; motor++) {
+        values[n++] = (int32_t)(lcg() % 61) - 30;
+    }
+    values[n++] = 0;
+}
+
+static int vbBytes(uint32_t value)
+{
+    int bytes = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        bytes++;
+    }
+    return bytes;
+}
+
+TEST(BlackboxColumnarTest, TestCompressionBenchmark)
+{
+    blackboxColumnarBlock_t block;
+    blackboxColumnarBlock_t decoded;
+    const int blocks = 200;
+    int32_t values[FLIGHT_FIELDS];
+    int32_t previous[FLIGHT_FIELDS] = { 0 };
+
+    lcgState = 3;
+    int interleavedBytes = 0;
+    int columnarBytes = 0;
+    double encodeSeconds = 0;
+
+    blackboxColumnarBlockInit(&block, blockColumns[0], FLIGHT_FIELDS);
+    blackboxColumnarBlockInit(&decoded, decodedColumns, BLACKBOX_COLUMNAR_MAX_COLUMNS);
+    for (int b = 0; b < blocks; b++) {
+        blackboxColumnarBlockReset(&block);
+        for (int i = 0; i < BLACKBOX_COLUMNAR_BLOCK_FRAMES; i++) {
+            flightFrame(b * BLACKBOX_COLUMNAR_BLOCK_FRAMES + i, values);
+            blackboxColumnarBlockAddFrame(&block, values);
+
+            // The interleaved format spends at least a frame marker and a variable byte delta per field
+            interleavedBytes++;
+            for (int c = 0; c < FLIGHT_FIELDS; c++) {
+                interleavedBytes += vbBytes(zigzagEncode(values[c] - previous[c]));
+                previous[c] = values[c];
+            }
+        }
+
+        encodedLength = 0;
+        const clock_t start = clock();
+        blackboxColumnarEncodeBlock(&block, writeEncoded);
+        encodeSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+        columnarBytes += encodedLength + 1; // plus the block marker
+
+        ASSERT_EQ(encodedLength, blackboxColumnarDecodeBlock(encoded, encodedLength, &decoded));
+        expectBlocksEqual(&block, &decoded);
+    }
+
+    const double ratio = (double)interleavedBytes / columnarBytes;
+    printf("blackbox columnar: %d bytes vs at least %d interleaved (%.2fx), %.0f ns/frame to encode\n",
+        columnarBytes, interleavedBytes, ratio, encodeSeconds * 1e9 / (blocks * BLACKBOX_COLUMNAR_BLOCK_FRAMES));
+    EXPECT_GT(ratio, 1.5);
+}
@@ -0,0 +1,223 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_framing.h"
+
+    #include "common/crc.h"
+
+    #include "drivers/serial.h"
+    #include "drivers/time.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_TX_BUFFER_SIZE 256
+
+static serialPort_t testPort;
+static std::vector<uint8_t> txPending;  // written but not yet transmitted
+static std::vector<uint8_t> txWire;     // transmitted
+static timeMs_t simMillis;
+
+static void simReset(uint32_t txBufferSize = TEST_TX_BUFFER_SIZE)
+{
+    memset(&testPort, 0, sizeof(testPort));
+    testPort.txBufferSize = txBufferSize;
+    txPending.clear();
+    txWire.clear();
+    simMillis = 1000;
+
+    blackboxFramingInit(&testPort);
+}
+
+static void drain(void)
+{
+    txWire.insert(txWire.end(), txPending.begin(), txPending.end());
+    txPending.clear();
+}
+
+typedef struct {
+    uint16_t sequence;
+    std::vector<uint8_t> payload;
+} frame_t;
+
+// Parse and check every frame on the wire
+static std::vector<frame_t> parseFrames(void)
+{
+    std::vector<frame_t> frames;
+    size_t pos = 0;
+
+    while (pos < txWire.size()) {
+        EXPECT_LE(pos + BLACKBOX_FRAMING_OVERHEAD, txWire.size());
+        EXPECT_EQ(BLACKBOX_FRAMING_SYNC1, txWire[pos]);
+        EXPECT_EQ(BLACKBOX_FRAMING_SYNC2, txWire[pos + 1]);
+
+        frame_t frame;
+        frame.sequence = txWire[pos + 2] | (txWire[pos + 3] << 8);
+        const uint16_t length = txWire[pos + 4] | (txWire[pos + 5] << 8);
+        EXPECT_LE(pos + BLACKBOX_FRAMING_OVERHEAD + length, txWire.size());
+        frame.payload.assign(&txWire[pos + BLACKBOX_FRAMING_HEADER_SIZE], &txWire[pos + BLACKBOX_FRAMING_HEADER_SIZE + length]);
+
+        const uint16_t crc = crc16_ccitt_update(0, &txWire[pos + 2], BLACKBOX_FRAMING_HEADER_SIZE - 2 + length);
+        const size_t crcPos = pos + BLACKBOX_FRAMING_HEADER_SIZE + length;
+        EXPECT_EQ(crc, txWire[crcPos] | (txWire[crcPos + 1] << 8));
+
+        frames.push_back(frame);
+        pos = crcPos + 2;
+    }
+
+    return frames;
+}
+
+TEST(BlackboxFramingTest, ChunksAreFramedWithSequenceAndCrc)
+{
+    simReset();
+
+    const uint8_t first[] = "first chunk";
+    uint8_t second[200];
+    for (unsigned i = 0; i < sizeof(second); i++) {
+        second[i] = i;
+    }
+
+    blackboxFramingWrite(first, sizeof(first));
+    drain();
+    blackboxFramingWrite(second, sizeof(second));
+    drain();
+
+    const std::vector<frame_t> frames = parseFrames();
+    ASSERT_EQ(2U, frames.size());
+    EXPECT_EQ(0, frames[0].sequence);
+    EXPECT_EQ(std::vector<uint8_t>(first, first + sizeof(first)), frames[0].payload);
+    EXPECT_EQ(1, frames[1].sequence);
+    EXPECT_EQ(std::vector<uint8_t>(second, second + sizeof(second)), frames[1].payload);
+    EXPECT_EQ(0U, blackboxFramingDroppedFrames());
+}
+
+TEST(BlackboxFramingTest, FrameThatDoesNotFitIsDroppedWhole)
+{
+    simReset();
+
+    uint8_t chunk[150] = { 0 };
+    blackboxFramingWrite(chunk, sizeof(chunk));
+    // Only about 100 bytes left in the transmit buffer
+    blackboxFramingWrite(chunk, sizeof(chunk));
+    EXPECT_EQ(1U, blackboxFramingDroppedFrames());
+
+    drain();
+    blackboxFramingWrite(chunk, 10);
+    drain();
+
+    // The receiver sees the gap in the sequence, and no partial frame
+    const std::vector<frame_t> frames = parseFrames();
+    ASSERT_EQ(2U, frames.size());
+    EXPECT_EQ(0, frames[0].sequence);
+    EXPECT_EQ(2, frames[1].sequence);
+    EXPECT_EQ(10U, frames[1].payload.size());
+}
+
+TEST(BlackboxFramingTest, BackpressureRisesOnDropsAndRecoversWhenTheLinkKeepsUp)
+{
+    simReset();
+
+    uint8_t chunk[200] = { 0 };
+    blackboxFramingWrite(chunk, sizeof(chunk));
+    EXPECT_EQ(0, blackboxFramingBackpressureLevel());
+
+    // The link is stuck, drops keep coming every 10ms but the level only rises once per holdoff
+    for (int i = 0; i < 100; i++) {
+        simMillis += 10;
+        blackboxFramingWrite(chunk, sizeof(chunk));
+        if (i == 0) {
+            EXPECT_EQ(1, blackboxFramingBackpressureLevel());
+        } else if (i == 5) {
+            EXPECT_EQ(1, blackboxFramingBackpressureLevel());
+        } else if (i == 10) {
+            EXPECT_EQ(2, blackboxFramingBackpressureLevel());
+        }
+    }
+    EXPECT_EQ(BLACKBOX_FRAMING_MAX_LEVEL, blackboxFramingBackpressureLevel());
+    EXPECT_EQ(100U, blackboxFramingDroppedFrames());
+
+    // The link keeps up again, the rate steps back up once per recovery period
+    for (int i = 1; i <= 300; i++) {
+        simMillis += 10;
+        drain();
+        blackboxFramingWrite(chunk, 50);
+        if (i == 99) {
+            EXPECT_EQ(BLACKBOX_FRAMING_MAX_LEVEL, blackboxFramingBackpressureLevel());
+        } else if (i == 100) {
+            EXPECT_EQ(BLACKBOX_FRAMING_MAX_LEVEL - 1, blackboxFramingBackpressureLevel());
+        }
+    }
+    EXPECT_EQ(0, blackboxFramingBackpressureLevel());
+    EXPECT_EQ(100U, blackboxFramingDroppedFrames());
+}
+
+TEST(BlackboxFramingTest, PortWithoutTransmitBufferNeverDrops)
+{
+    // USB VCP reports no transmit buffer and blocks in serialWriteBuf() instead
+    simReset(0);
+
+    uint8_t chunk[250] = { 0 };
+    for (int i = 0; i < 10; i++) {
+        blackboxFramingWrite(chunk, sizeof(chunk));
+    }
+    drain();
+
+    EXPECT_EQ(10U, parseFrames().size());
+    EXPECT_EQ(0U, blackboxFramingDroppedFrames());
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t millis(void)
+{
+    return simMillis;
+}
+
+uint32_t serialTxBytesFree(const serialPort_t *instance)
+{
+    if (instance->txBufferSize == 0) {
+        return 0;
+    }
+    // One byte of the ring is never used
+    return instance->txBufferSize - 1 - txPending.size();
+}
+
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count)
+{
+    txPending.insert(txPending.end(), data, data + count);
+    if (instance->txBufferSize) {
+        EXPECT_LT(txPending.size(), instance->txBufferSize);
+    }
+}
+
+void serialBeginWrite(serialPort_t *) {}
+void serialEndWrite(serialPort_t *) {}
+
+}
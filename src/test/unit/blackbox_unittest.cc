@@ -15,12 +15,23 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
+#include <time.h>
+
 extern "C" {
     #include "platform.h"
 
     #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_burst.h"
+    #include "blackbox/blackbox_columnar.h"
+    #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_fielddefs.h"
+    #include "blackbox/blackbox_framing.h"
+    #include "blackbox/blackbox_io.h"
+
+    #include "build/debug.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -32,6 +43,7 @@ extern "C" {
     #include "drivers/serial.h"
 
     #include "flight/failsafe.h"
+    #include "flight/gain_schedule.h"
     #include "flight/mixer.h"
     #include "flight/pid.h"
 
@@ -46,8 +58,22 @@ extern "C" {
     #include "sensors/battery.h"
     #include "sensors/gyro.h"
 
+    #include "blackbox_columnar_decoder.h"
+
+    extern uint16_t blackboxWorkspaceUsed;
     extern int16_t blackboxIInterval;
     extern int16_t blackboxPInterval;
+    extern uint32_t blackboxDroppedFrameCount;
+    extern uint32_t blackboxDroppedEventCount;
+    extern uint8_t blackboxBackpressureLevel;
+    extern struct pidProfile_s *currentPidProfile;
+
+    static serialPort_t blackboxTestPort;
+    static serialPortConfig_t blackboxTestPortConfig;
+    static uint8_t serialWriteBufData[1024];
+    static int serialWriteBufBytes;
+    static int serialWriteBufCalls;
+    static uint32_t serialTxBytesFreeValue;
 }
 
 #include "unittest_macros.h"
@@ -239,6 +265,29 @@ TEST(BlackboxTest, Test_zero_p_ratio)
     EXPECT_EQ(false, blackboxShouldLogPFrame());
 }
 
+TEST(BlackboxTest, Test_BackpressureThinsPFrames)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    // 2kHz PIDloop
+    targetPidLooptime = 500;
+    blackboxInit();
+    EXPECT_EQ(2, blackboxPInterval);
+
+    // Every fourth P-frame slot is logged, starting with the one shared with the I-frame
+    blackboxBackpressureLevel = 2;
+    for (int ii = 0; ii < blackboxIInterval; ++ii) {
+        EXPECT_EQ(ii == 0, blackboxShouldLogIFrame());
+        EXPECT_EQ(ii % 8 == 0, blackboxShouldLogPFrame());
+        blackboxAdvanceIterationTimers();
+    }
+    EXPECT_EQ(true, blackboxShouldLogIFrame());
+
+    blackboxBackpressureLevel = 0;
+    blackboxAdvanceIterationTimers();
+    blackboxAdvanceIterationTimers();
+    EXPECT_EQ(true, blackboxShouldLogPFrame());
+}
+
 TEST(BlackboxTest, Test_CalculatePDenom)
 {
     blackboxConfigMutable()->p_ratio = 0;
@@ -347,6 +396,488 @@ TEST(BlackboxTest, Test_CalculateRates)
 }
 
 
+static pidProfile_t testPidProfile;
+static uint32_t millisValue;
+
+static void resetSerialWriteBuf(void)
+{
+    serialWriteBufBytes = 0;
+    serialWriteBufCalls = 0;
+}
+
+TEST(BlackboxTest, TestStagedWritesCommitInBulk)
+{
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    EXPECT_TRUE(blackboxDeviceOpen());
+    resetSerialWriteBuf();
+
+    for (int i = 0; i < 100; i++) {
+        blackboxWrite(i);
+    }
+    EXPECT_EQ(5, blackboxWriteString("hello"));
+
+    // nothing reaches the device until the frame is committed
+    EXPECT_EQ(0, serialWriteBufCalls);
+
+    blackboxDeviceCommit();
+    EXPECT_EQ(1, serialWriteBufCalls);
+    EXPECT_EQ(105, serialWriteBufBytes);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(i, serialWriteBufData[i]);
+    }
+    EXPECT_EQ(0, memcmp(&serialWriteBufData[100], "hello", 5));
+
+    // an empty commit is a no-op
+    blackboxDeviceCommit();
+    EXPECT_EQ(1, serialWriteBufCalls);
+
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestStagingBufferCommitsWhenFull)
+{
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    EXPECT_TRUE(blackboxDeviceOpen());
+    resetSerialWriteBuf();
+
+    for (int i = 0; i < BLACKBOX_STAGING_BUFFER_SIZE + 10; i++) {
+        blackboxWrite(i);
+    }
+    EXPECT_EQ(1, serialWriteBufCalls);
+    EXPECT_EQ(BLACKBOX_STAGING_BUFFER_SIZE, serialWriteBufBytes);
+
+    // closing the device commits what is left
+    blackboxDeviceClose();
+    EXPECT_EQ(2, serialWriteBufCalls);
+    EXPECT_EQ(BLACKBOX_STAGING_BUFFER_SIZE + 10, serialWriteBufBytes);
+    for (int i = 0; i < BLACKBOX_STAGING_BUFFER_SIZE + 10; i++) {
+        EXPECT_EQ(i & 0xff, serialWriteBufData[i]);
+    }
+}
+
+TEST(BlackboxTest, TestStagedWriteBenchmark)
+{
+    const int frames = 100000;
+    int32_t values[16];
+
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    EXPECT_TRUE(blackboxDeviceOpen());
+    resetSerialWriteBuf();
+
+    clock_t start = clock();
+    for (int frame = 0; frame < frames; frame++) {
+        for (int i = 0; i < 16; i++) {
+            values[i] = (frame * (i + 1)) % 2000 - 1000;
+        }
+        blackboxWrite('P');
+        blackboxWriteUnsignedVB(frame);
+        blackboxWriteSignedVBArray(values, 8);
+        blackboxWriteTag8_4S16(values + 8);
+        blackboxWriteTag8_8SVB(values + 8, 8);
+        blackboxDeviceCommit();
+    }
+    const double frameNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / frames;
+
+    // one device write per frame, however many bytes the frame encoded to
+    EXPECT_EQ(frames, serialWriteBufCalls);
+    printf("blackbox staged write: %.1f ns/frame, %.1f bytes/frame\n", frameNs, (double)serialWriteBufBytes / frames);
+
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestDeferredEncoding)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    targetPidLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+    blackboxStart();
+    resetSerialWriteBuf();
+
+    // the PID loop only queues snapshots
+    for (int i = 0; i < 3; i++) {
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+    }
+    EXPECT_TRUE(blackboxEncodeCheck(0, 0));
+    blackboxDeviceCommit();
+    EXPECT_EQ(0, serialWriteBufBytes);
+
+    // the encoder writes them out in order, I-frame first
+    blackboxEncodeQueuedFrames();
+    EXPECT_FALSE(blackboxEncodeCheck(0, 0));
+    blackboxDeviceCommit();
+    EXPECT_EQ('I', serialWriteBufData[0]);
+    EXPECT_GT(serialWriteBufBytes, 3);
+
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestDeferredEncodingDropsWhenFull)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    targetPidLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+    blackboxStart();
+    resetSerialWriteBuf();
+    blackboxDroppedFrameCount = 0;
+
+    // fill the queue without giving the encoder a chance to run
+    for (int i = 0; i < 20; i++) {
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+    }
+    EXPECT_EQ(4, blackboxDroppedFrameCount);
+
+    blackboxEncodeQueuedFrames();
+    blackboxDeviceCommit();
+    const int queuedBytes = serialWriteBufBytes;
+
+    // the next frame after the gap is a resume event followed by a keyframe
+    blackboxLogIteration(20000);
+    blackboxEncodeQueuedFrames();
+    blackboxDeviceCommit();
+    EXPECT_EQ('E', serialWriteBufData[queuedBytes]);
+    EXPECT_EQ(FLIGHT_LOG_EVENT_LOGGING_RESUME, serialWriteBufData[queuedBytes + 1]);
+    EXPECT_EQ(20, serialWriteBufData[queuedBytes + 2]); // iteration
+    EXPECT_EQ('I', serialWriteBufData[queuedBytes + 6]); // after the 3 byte time
+
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestEventsQueuedInOrder)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    targetPidLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+
+    // the bytes of the two frames logged ahead of the event
+    blackboxInit();
+    blackboxStart();
+    resetSerialWriteBuf();
+    for (int i = 0; i < 2; i++) {
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+    }
+    blackboxEncodeQueuedFrames();
+    blackboxDeviceCommit();
+    const int framesBytes = serialWriteBufBytes;
+    blackboxDeviceClose();
+
+    blackboxInit();
+    blackboxStart();
+    blackboxState = BLACKBOX_STATE_RUNNING;
+    resetSerialWriteBuf();
+    blackboxDroppedEventCount = 0;
+    for (int i = 0; i < 2; i++) {
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+    }
+
+    // logging the event only queues it
+    flightLogEvent_syncBeep_t syncBeep;
+    syncBeep.time = 100;
+    blackboxLogEvent(FLIGHT_LOG_EVENT_SYNC_BEEP, (flightLogEventData_t *)&syncBeep);
+    blackboxLogIteration(2000);
+    blackboxDeviceCommit();
+    EXPECT_EQ(0, serialWriteBufBytes);
+    EXPECT_TRUE(blackboxEncodeCheck(0, 0));
+
+    // the encoder writes it between the frames queued before and after it
+    blackboxEncodeQueuedFrames();
+    EXPECT_FALSE(blackboxEncodeCheck(0, 0));
+    blackboxDeviceCommit();
+    ASSERT_GT(serialWriteBufBytes, framesBytes + 4);
+    EXPECT_EQ('E', serialWriteBufData[framesBytes]);
+    EXPECT_EQ(FLIGHT_LOG_EVENT_SYNC_BEEP, serialWriteBufData[framesBytes + 1]);
+    EXPECT_EQ(100, serialWriteBufData[framesBytes + 2]);
+    EXPECT_EQ('P', serialWriteBufData[framesBytes + 3]);
+
+    // with nothing queued behind them, events are written on their own and the queue holds a bounded number
+    resetSerialWriteBuf();
+    for (int i = 0; i < 6; i++) {
+        blackboxLogEvent(FLIGHT_LOG_EVENT_SYNC_BEEP, (flightLogEventData_t *)&syncBeep);
+    }
+    EXPECT_EQ(2, blackboxDroppedEventCount);
+    blackboxEncodeQueuedFrames();
+    EXPECT_FALSE(blackboxEncodeCheck(0, 0));
+    blackboxDeviceCommit();
+    EXPECT_EQ(4 * 3, serialWriteBufBytes);
+
+    blackboxState = BLACKBOX_STATE_STOPPED;
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestDeviceDropResyncs)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->serial_framing = 1;
+    targetPidLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+    blackboxStart();
+
+    for (int i = 0; i < 2; i++) {
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+        blackboxEncode(0);
+    }
+
+    // the transmit buffer is full, so the framing drops the next chunk
+    blackboxTestPort.txBufferSize = 256;
+    serialTxBytesFreeValue = 0;
+    resetSerialWriteBuf();
+    blackboxLogIteration(2000);
+    blackboxAdvanceIterationTimers();
+    blackboxEncode(0);
+    EXPECT_EQ(0, serialWriteBufBytes);
+    EXPECT_EQ(1u, blackboxDeviceDroppedFrames());
+
+    // the next frame logged after the gap, which back-pressure thins to every other one, is a resume event
+    // followed by a keyframe
+    serialTxBytesFreeValue = 256;
+    int iteration = 3;
+    for (; serialWriteBufBytes == 0 && iteration < 8; iteration++) {
+        blackboxLogIteration(1000 * iteration);
+        blackboxAdvanceIterationTimers();
+        blackboxEncode(0);
+    }
+    const int payload = BLACKBOX_FRAMING_HEADER_SIZE;
+    EXPECT_GT(serialWriteBufBytes, payload + 10);
+    // behind the event for the change in back-pressure
+    EXPECT_EQ('E', serialWriteBufData[payload]);
+    EXPECT_EQ(FLIGHT_LOG_EVENT_BACKPRESSURE, serialWriteBufData[payload + 1]);
+    EXPECT_EQ(1, serialWriteBufData[payload + 3]); // dropped chunks
+    EXPECT_EQ('E', serialWriteBufData[payload + 4]);
+    EXPECT_EQ(FLIGHT_LOG_EVENT_LOGGING_RESUME, serialWriteBufData[payload + 5]);
+    EXPECT_EQ(iteration - 1, serialWriteBufData[payload + 6]);
+    EXPECT_EQ('I', serialWriteBufData[payload + 9]); // after the 2 byte time
+
+    // and the log carries on with P-frames
+    resetSerialWriteBuf();
+    for (; serialWriteBufBytes == 0 && iteration < 12; iteration++) {
+        blackboxLogIteration(1000 * iteration);
+        blackboxAdvanceIterationTimers();
+        blackboxEncode(0);
+    }
+    EXPECT_EQ('P', serialWriteBufData[payload]);
+
+    blackboxDeviceClose();
+    blackboxTestPort.txBufferSize = 0;
+    serialTxBytesFreeValue = 0;
+    blackboxConfigMutable()->serial_framing = 0;
+}
+
+TEST(BlackboxTest, TestColumnarBlocks)
+{
+    static blackboxColumnarColumn_t decodedColumns[BLACKBOX_COLUMNAR_MAX_COLUMNS];
+    blackboxColumnarBlock_t decoded;
+
+    blackboxColumnarBlockInit(&decoded, decodedColumns, BLACKBOX_COLUMNAR_MAX_COLUMNS);
+
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->format = BLACKBOX_FORMAT_COLUMNAR;
+    targetPidLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+    blackboxStart();
+    resetSerialWriteBuf();
+
+    for (int i = 0; i < BLACKBOX_COLUMNAR_BLOCK_FRAMES + BLACKBOX_COLUMNAR_BLOCK_FRAMES / 2; i++) {
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+        blackboxEncodeQueuedFrames();
+    }
+    blackboxDeviceCommit();
+
+    // a full block went out, encoded over the frames that followed it, and the iteration column is intact
+    int blockStart = -1;
+    for (int i = 0; i < serialWriteBufBytes; i++) {
+        if (serialWriteBufData[i] == 'B') {
+            blockStart = i + 1;
+            break;
+        }
+    }
+    ASSERT_GE(blockStart, 0);
+    EXPECT_EQ(serialWriteBufBytes - blockStart, blackboxColumnarDecodeBlock(&serialWriteBufData[blockStart], serialWriteBufBytes - blockStart, &decoded));
+    EXPECT_EQ(BLACKBOX_COLUMNAR_BLOCK_FRAMES, decoded.frameCount);
+    for (int i = 0; i < BLACKBOX_COLUMNAR_BLOCK_FRAMES; i++) {
+        EXPECT_EQ(i, decoded.values[0][i]);
+        EXPECT_EQ(1000 * i, decoded.values[1][i]);
+    }
+
+    // the two blocks took just the RAM for the columns the log carries
+    EXPECT_EQ(2 * decoded.columnCount * sizeof(blackboxColumnarColumn_t), blackboxWorkspaceUsed * sizeof(uint32_t));
+    blackboxDeviceClose();
+
+    // which follow the fields of the log being started, not those of the last one
+    blackboxConfigMutable()->fields_disabled_mask = BIT(BLACKBOX_FIELD_GROUP_GYRO);
+    blackboxStart();
+    EXPECT_EQ(2 * (decoded.columnCount - XYZ_AXIS_COUNT) * sizeof(blackboxColumnarColumn_t), blackboxWorkspaceUsed * sizeof(uint32_t));
+    blackboxConfigMutable()->fields_disabled_mask = 0;
+    blackboxConfigMutable()->format = BLACKBOX_FORMAT_INTERLEAVED;
+    blackboxDeviceClose();
+
+    // and an interleaved log takes none
+    blackboxStart();
+    EXPECT_EQ(0, blackboxWorkspaceUsed);
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestBurstRingFromWorkspace)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    targetPidLooptime = 1000;
+    gyro.targetLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+
+    // the ring holds the configured window at the gyro rate
+    blackboxConfigMutable()->burst_ms = 100;
+    blackboxStart();
+    EXPECT_EQ(100 * sizeof(blackboxBurstSample_t), blackboxWorkspaceUsed * sizeof(uint32_t));
+
+    // and the log announces the layout of the 'R' frames it will carry
+    blackboxTestPort.txBufferSize = 1024;
+    serialTxBytesFreeValue = 1024;
+    while (blackboxState != BLACKBOX_STATE_SEND_BURST_HEADER && blackboxState != BLACKBOX_STATE_SEND_SYSINFO) {
+        millisValue += 10;
+        blackboxUpdate(millisValue * 1000);
+        blackboxDeviceCommit();
+    }
+    resetSerialWriteBuf();
+    while (blackboxState == BLACKBOX_STATE_SEND_BURST_HEADER) {
+        blackboxUpdate(millisValue * 1000);
+        blackboxDeviceCommit();
+    }
+    const char expected[] = "H Field R name:timeDelta,gyroRaw[0],gyroRaw[1],gyroRaw[2]\n";
+    ASSERT_GE(serialWriteBufBytes, (int)strlen(expected));
+    EXPECT_EQ(0, memcmp(expected, serialWriteBufData, strlen(expected)));
+    blackboxDeviceClose();
+
+    // no window, no ring and no 'R' frame definitions
+    blackboxConfigMutable()->burst_ms = 0;
+    blackboxState = BLACKBOX_STATE_STOPPED;
+    blackboxStart();
+    EXPECT_EQ(0, blackboxWorkspaceUsed);
+    blackboxDeviceClose();
+
+    blackboxState = BLACKBOX_STATE_STOPPED;
+    blackboxTestPort.txBufferSize = 0;
+    serialTxBytesFreeValue = 0;
+}
+
+TEST(BlackboxTest, TestColumnarBlockPrecedesBurst)
+{
+    static blackboxColumnarColumn_t decodedColumns[BLACKBOX_COLUMNAR_MAX_COLUMNS];
+    blackboxColumnarBlock_t decoded;
+    const int16_t gyroADCRaw[XYZ_AXIS_COUNT] = { 1, 2, 3 };
+
+    blackboxColumnarBlockInit(&decoded, decodedColumns, BLACKBOX_COLUMNAR_MAX_COLUMNS);
+
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->format = BLACKBOX_FORMAT_COLUMNAR;
+    blackboxConfigMutable()->burst_ms = 100;
+    targetPidLooptime = 1000;
+    gyro.targetLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+    blackboxStart();
+    blackboxState = BLACKBOX_STATE_RUNNING;
+    resetSerialWriteBuf();
+
+    for (int i = 0; i < BLACKBOX_COLUMNAR_BLOCK_FRAMES + BLACKBOX_COLUMNAR_BLOCK_FRAMES / 2; i++) {
+        blackboxBurstCapture(1000 * i, gyroADCRaw);
+        blackboxLogIteration(1000 * i);
+        blackboxAdvanceIterationTimers();
+        blackboxEncodeQueuedFrames();
+    }
+    blackboxBurstTrigger(BLACKBOX_BURST_TRIGGER_SWITCH);
+    blackboxFinish();
+    EXPECT_EQ(BLACKBOX_STATE_SEND_BURST, blackboxState);
+
+    // the burst event goes out with the partially filled block ahead of it, before any 'R' frame
+    blackboxEncodeQueuedFrames();
+    blackboxDeviceCommit();
+    bool foundPartialBlock = false;
+    for (int i = 0; i < serialWriteBufBytes && !foundPartialBlock; i++) {
+        foundPartialBlock = serialWriteBufData[i] == 'B'
+            && blackboxColumnarDecodeBlock(&serialWriteBufData[i + 1], serialWriteBufBytes - i - 1, &decoded) > 0
+            && decoded.frameCount == BLACKBOX_COLUMNAR_BLOCK_FRAMES / 2
+            && decoded.values[0][0] == BLACKBOX_COLUMNAR_BLOCK_FRAMES;
+    }
+    EXPECT_TRUE(foundPartialBlock);
+
+    blackboxDeviceClose();
+    blackboxState = BLACKBOX_STATE_STOPPED;
+    blackboxConfigMutable()->burst_ms = 0;
+    blackboxConfigMutable()->format = BLACKBOX_FORMAT_INTERLEAVED;
+}
+
+static void logFrameSizes(int *frameBytes, int count)
+{
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    targetPidLooptime = 1000;
+    currentPidProfile = &testPidProfile;
+    blackboxInit();
+    blackboxStart();
+    resetSerialWriteBuf();
+
+    for (int i = 0; i < count; i++) {
+        const int bytesBefore = serialWriteBufBytes;
+        blackboxLogIteration(0);
+        blackboxAdvanceIterationTimers();
+        blackboxEncodeQueuedFrames();
+        blackboxDeviceCommit();
+        frameBytes[i] = serialWriteBufBytes - bytesBefore;
+    }
+
+    blackboxDeviceClose();
+}
+
+TEST(BlackboxTest, TestFieldRates)
+{
+    int fullRate[4];
+    int halfRate[4];
+
+    logFrameSizes(fullRate, 4);
+
+    blackboxConfigMutable()->field_rate[BLACKBOX_FIELD_GROUP_GYRO] = BLACKBOX_FIELD_RATE_1_2;
+    logFrameSizes(halfRate, 4);
+    blackboxConfigMutable()->field_rate[BLACKBOX_FIELD_GROUP_GYRO] = BLACKBOX_FIELD_RATE_1;
+
+    // the I-frame and every second P-frame carry the gyro, the others leave out its three one byte deltas
+    EXPECT_EQ(fullRate[0], halfRate[0]);
+    EXPECT_EQ(fullRate[1] - XYZ_AXIS_COUNT, halfRate[1]);
+    EXPECT_EQ(fullRate[2], halfRate[2]);
+    EXPECT_EQ(fullRate[3] - XYZ_AXIS_COUNT, halfRate[3]);
+}
+
+TEST(BlackboxTest, TestFieldMask)
+{
+    int allFields[2];
+    int noGyro[2];
+
+    logFrameSizes(allFields, 2);
+
+    blackboxConfigMutable()->fields_disabled_mask = BIT(BLACKBOX_FIELD_GROUP_GYRO);
+    logFrameSizes(noGyro, 2);
+    blackboxConfigMutable()->fields_disabled_mask = 0;
+
+    // gyroADC is zero, so a single byte per axis in both frame types
+    EXPECT_EQ(allFields[0] - XYZ_AXIS_COUNT, noGyro[0]);
+    EXPECT_EQ(allFields[1] - XYZ_AXIS_COUNT, noGyro[1]);
+}
+
 // STUBS
 extern "C" {
 
@@ -355,6 +886,7 @@ PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
 PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
 PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
 PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER(gainScheduleConfig_t, gainScheduleConfig, PG_GAIN_SCHEDULE_CONFIG, 0);
 PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
 
 uint8_t armingFlags;
@@ -362,6 +894,7 @@ uint8_t stateFlags;
 const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
         400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000}; // see baudRate_e
 uint8_t debugMode;
+int16_t debug[DEBUG16_VALUE_COUNT];
 int32_t blackboxHeaderBudget;
 gpsSolutionData_t gpsSol;
 int32_t GPS_home[2];
@@ -383,16 +916,29 @@ uint8_t getMotorCount(void) {return 4;}
 bool areMotorsRunning(void) { return false; }
 bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
 bool isModeActivationConditionPresent(boxId_e) {return false;}
-uint32_t millis(void) {return 0;}
+bool gyroOverflowDetected(void) {return false;}
+bool crashRecoveryModeActive(void) {return false;}
+uint32_t millis(void) {return millisValue;}
+uint32_t micros(void) {return 0;}
 bool sensors(uint32_t) {return false;}
 void serialWrite(serialPort_t *, uint8_t) {}
-uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
+void serialBeginWrite(serialPort_t *) {}
+void serialEndWrite(serialPort_t *) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    for (int i = 0; i < count; i++) {
+        serialWriteBufData[(serialWriteBufBytes + i) % sizeof(serialWriteBufData)] = data[i];
+    }
+    serialWriteBufBytes += count;
+    serialWriteBufCalls++;
+}
+uint32_t serialTxBytesFree(const serialPort_t *) {return serialTxBytesFreeValue;}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
 bool featureIsEnabled(uint32_t) {return false;}
 void mspSerialReleasePortIfAllocated(serialPort_t *) {}
-serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return &blackboxTestPortConfig;}
 serialPort_t *findSharedSerialPort(uint16_t , serialPortFunction_e ) {return NULL;}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &blackboxTestPort;}
 void closeSerialPort(serialPort_t *) {}
 portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e ) {return PORTSHARING_UNUSED;}
 failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
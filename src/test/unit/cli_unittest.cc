@@ -23,6 +23,9 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <string>
+
 extern "C" {
     #include "platform.h"
     #include "target.h"
@@ -57,11 +60,21 @@ extern "C" {
     void cliGet(char *cmdline);
 
     const clivalue_t valueTable[] = {
-        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config.array.length = 3, PG_RESERVED_FOR_TESTING_1, 0 }
+        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, { .array = { 3 } }, PG_RESERVED_FOR_TESTING_1, 0 }
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
     const lookupTableEntry_t lookupTables[] = {};
 
+    const clivalue_t *settingGetByName(const char *name, unsigned nameLength)
+    {
+        for (unsigned i = 0; i < valueTableEntryCount; i++) {
+            if (strncasecmp(name, valueTable[i].name, nameLength) == 0 && strlen(valueTable[i].name) == nameLength) {
+                return &valueTable[i];
+            }
+        }
+        return NULL;
+    }
+
 
     PG_REGISTER(osdConfig_t, osdConfig, PG_OSD_CONFIG, 0);
     PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
@@ -86,8 +99,47 @@ extern "C" {
 
 #include "unittest_macros.h"
 #include "gtest/gtest.h"
+
+static serialPort_t cliTestPort;
+static std::string cliInput;
+static std::string cliOutput;
+static uint32_t cliTxBytesFree;
+
+static void enterCli(void)
+{
+    cliTestPort.txBufferSize = 256;
+    cliTxBytesFree = 255;
+    cliEnter(&cliTestPort);
+    cliOutput.clear();
+}
+
+// Type the command and run the CLI until its prompt comes back, returns the output. *slices counts the runs it took.
+static std::string runCliCommand(const char *command, uint32_t txBytesFree, int *slices, size_t *longestSlice)
+{
+    cliOutput.clear();
+    cliInput = std::string(command) + "\r";
+    cliTxBytesFree = txBytesFree;
+    *slices = 0;
+    *longestSlice = 0;
+
+    const std::string prompt = "\r\n# ";
+    while (*slices < 10000) {
+        const size_t outputStart = cliOutput.size();
+        cliProcess();
+        (*slices)++;
+        *longestSlice = std::max(*longestSlice, cliOutput.size() - outputStart);
+        if (cliInput.empty() && cliOutput.size() >= prompt.size()
+            && cliOutput.compare(cliOutput.size() - prompt.size(), prompt.size(), prompt) == 0) {
+            break;
+        }
+    }
+
+    return cliOutput;
+}
+
 TEST(CLIUnittest, TestCliSet)
 {
+    enterCli();
 
     cliSet((char *)"array_unit_test    =   123,  -3  , 1");
 
@@ -115,6 +167,31 @@ TEST(CLIUnittest, TestCliSet)
     //EXPECT_EQ(false, false);
 }
 
+TEST(CLIUnittest, TestDumpSlicedMatchesSinglePass)
+{
+    enterCli();
+
+    // given a port with room for the whole dump at once
+    int slices;
+    size_t longestSlice;
+    const std::string singlePass = runCliCommand("dump", 100000, &slices, &longestSlice);
+    EXPECT_GT(singlePass.size(), 1000u);
+    EXPECT_LE(slices, 2);
+
+    // when the port only has room for a few lines at a time
+    const std::string sliced = runCliCommand("dump", 160, &slices, &longestSlice);
+
+    // then the output comes out in many slices, none overrunning the room there was, and the same as in one pass
+    EXPECT_GT(slices, 20);
+    EXPECT_LE(longestSlice, 160u);
+    EXPECT_EQ(singlePass, sliced);
+
+    // and the same for a diff
+    const std::string diffSinglePass = runCliCommand("diff", 100000, &slices, &longestSlice);
+    const std::string diffSliced = runCliCommand("diff", 160, &slices, &longestSlice);
+    EXPECT_EQ(diffSinglePass, diffSliced);
+}
+
 // STUBS
 extern "C" {
 
@@ -158,8 +235,12 @@ void tfp_printf(const char * expectedFormat, ...) {
 }
 
 
-void tfp_format(void *, void (*) (void *, char), const char * expectedFormat, va_list va) {
-    vprintf(expectedFormat, va);
+void tfp_format(void *putp, void (*putf) (void *, char), const char * expectedFormat, va_list va) {
+    char buf[256];
+    vsnprintf(buf, sizeof(buf), expectedFormat, va);
+    for (const char *c = buf; *c; c++) {
+        putf(putp, *c);
+    }
 }
 
 static const box_t boxes[] = { { 0, "DUMMYBOX", 0 } };
@@ -195,7 +276,6 @@ void beeperOffClear(uint32_t) {}
 void beeperOffClearAll(void) {}
 bool parseColor(int, const char *) {return false; }
 void resetEEPROM(void) {}
-void bufWriterFlush(bufWriter_t *) {}
 void mixerResetDisarmedMotors(void) {}
 void gpsEnablePassthrough(struct serialPort_s *) {}
 bool parseLedStripConfig(int, const char *){return false; }
@@ -248,13 +328,18 @@ const char* const buildDate = "Jan 01 2017";
 const char * const buildTime = "00:00:00";
 const char * const shortGitRevision = "MASTER";
 
-uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
-uint8_t serialRead(serialPort_t *){return 0;}
+uint32_t serialRxBytesWaiting(const serialPort_t *) {return cliInput.size();}
+uint8_t serialRead(serialPort_t *)
+{
+    const uint8_t ch = cliInput[0];
+    cliInput.erase(0, 1);
+    return ch;
+}
 
-void bufWriterAppend(bufWriter_t *, uint8_t ch){ printf("%c", ch); }
-void serialWriteBufShim(void *, const uint8_t *, int) {}
-bufWriter_t *bufWriterInit(uint8_t *, int, bufWrite_t, void *) {return NULL;}
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count) { cliOutput.append((const char *)data, count); }
+uint32_t serialTxBytesFree(const serialPort_t *) {return cliTxBytesFree;}
 void schedulerSetCalulateTaskStatistics(bool) {}
+void setTaskEnabled(cfTaskId_e, bool) {}
 void setArmingDisabled(armingDisableFlags_e) {}
 
 void waitForSerialPortToFinishTransmitting(serialPort_t *) {}
@@ -267,7 +352,7 @@ void changePidProfile(uint8_t) {}
 bool serialIsPortAvailable(serialPortIdentifier_e) { return false; }
 void generateLedConfig(ledConfig_t *, char *, size_t) {}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return true; }
-void serialWrite(serialPort_t *, uint8_t ch) { printf("%c", ch);}
+void serialWrite(serialPort_t *, uint8_t ch) { cliOutput.push_back(ch); }
 
 void serialSetCtrlLineStateCb(serialPort_t *, void (*)(void *, uint16_t ), void *) {}
 void serialSetCtrlLineStateDtrPin(serialPort_t *, ioTag_t ) {}
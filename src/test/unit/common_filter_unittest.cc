@@ -114,3 +114,49 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+TEST(FilterUnittest, TestBiquadFilterVec4MatchesScalar)
+{
+    biquadFilter_t scalar[4];
+    biquadFilterVec4_t vec;
+
+    for (int i = 0; i < 4; i++) {
+        biquadFilterInitLPF(&scalar[i], 30.0f, 125);
+    }
+    biquadFilterVec4InitLPF(&vec, 30.0f, 125);
+
+    float input[4];
+    float output[4];
+    for (int sample = 0; sample < 200; sample++) {
+        for (int i = 0; i < 4; i++) {
+            input[i] = (sample % (10 + i) < 5) ? 500.0f - 100.0f * i : -250.0f;
+        }
+        biquadFilterVec4ApplyDF1(&vec, input, output);
+        for (int i = 0; i < 4; i++) {
+            EXPECT_FLOAT_EQ(biquadFilterApplyDF1(&scalar[i], input[i]), output[i]);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadFilterVec4Pt1)
+{
+    pt1Filter_t scalar;
+    biquadFilterVec4_t vec;
+
+    pt1FilterInit(&scalar, pt1FilterGain(100, 31.25f));
+    biquadFilterVec4InitPT1(&vec, pt1FilterGain(100, 31.25f));
+
+    const float samples[] = { 1800.0f, -1800.0f, -200.0f };
+    float input[4];
+    float output[4];
+    for (unsigned sample = 0; sample < sizeof(samples) / sizeof(samples[0]); sample++) {
+        for (int i = 0; i < 4; i++) {
+            input[i] = samples[sample];
+        }
+        biquadFilterVec4ApplyDF1(&vec, input, output);
+        const float expected = pt1FilterApply(&scalar, samples[sample]);
+        for (int i = 0; i < 4; i++) {
+            EXPECT_NEAR(expected, output[i], 0.01f);
+        }
+    }
+}
@@ -0,0 +1,289 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/config_streamer.h"
+
+    #include "drivers/system.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct testConfig_s {
+        uint16_t rate;
+        uint8_t mode;
+    } testConfig_t;
+
+    PG_DECLARE(testConfig_t, testConfig);
+
+    PG_REGISTER_WITH_RESET_TEMPLATE(testConfig_t, testConfig, PG_RESERVED_FOR_TESTING_1, 0);
+
+    PG_RESET_TEMPLATE(testConfig_t, testConfig,
+        .rate = 1000,
+        .mode = 3,
+    );
+
+    typedef struct testTableConfig_s {
+        uint8_t values[300];
+    } testTableConfig_t;
+
+    PG_DECLARE(testTableConfig_t, testTableConfig);
+
+    PG_REGISTER(testTableConfig_t, testTableConfig, PG_RESERVED_FOR_TESTING_2, 0);
+
+    uint8_t eepromData[EEPROM_SIZE];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FLASH_PAGE_SIZE 0x400
+
+// size of the saved copy: header, a record per PG, footer and CRC
+#define SAVED_COPY_SIZE (2 + 6 + sizeof(testConfig_t) + 6 + sizeof(testTableConfig_t) + 2 + 2)
+// size of a segment holding only testConfig: header, the record, footer and CRC
+#define TEST_CONFIG_SEGMENT_SIZE (4 + 6 + sizeof(testConfig_t) + 2 + 2)
+#define ALIGN(offset) (((offset) + 3) & ~3)
+
+static bool writeFailed;
+
+static void setTable(uint8_t seed)
+{
+    for (unsigned i = 0; i < sizeof(testTableConfig_t); i++) {
+        testTableConfigMutable()->values[i] = seed + i;
+    }
+}
+
+static void expectTable(uint8_t seed)
+{
+    for (unsigned i = 0; i < sizeof(testTableConfig_t); i++) {
+        EXPECT_EQ((uint8_t)(seed + i), testTableConfig()->values[i]);
+    }
+}
+
+// Read the region back as the firmware does at boot
+static bool readRegion(void)
+{
+    memset(testConfigMutable(), 0, sizeof(testConfig_t));
+    memset(testTableConfigMutable(), 0, sizeof(testTableConfig_t));
+    return isEEPROMVersionValid() && isEEPROMStructureValid() && loadEEPROM();
+}
+
+class ConfigEepromTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        memset(eepromData, 0xFF, sizeof(eepromData));
+        writeFailed = false;
+        pgResetAll();
+        setTable(0);
+
+        // a region that does not hold a valid config is always written as a whole
+        writeConfigToEEPROM();
+        ASSERT_TRUE(readRegion());
+        ASSERT_EQ(SAVED_COPY_SIZE, getEEPROMConfigSize());
+    }
+};
+
+TEST_F(ConfigEepromTest, TestAppend)
+{
+    const std::vector<uint8_t> saved(eepromData, eepromData + SAVED_COPY_SIZE);
+
+    testConfigMutable()->rate = 2000;
+    writeConfigToEEPROM();
+
+    // only the changed group is appended, the saved copy is left alone
+    EXPECT_FALSE(writeFailed);
+    EXPECT_EQ(saved, std::vector<uint8_t>(eepromData, eepromData + SAVED_COPY_SIZE));
+    EXPECT_EQ(ALIGN(SAVED_COPY_SIZE) + TEST_CONFIG_SEGMENT_SIZE, getEEPROMConfigSize());
+
+    ASSERT_TRUE(readRegion());
+    EXPECT_EQ(2000, testConfig()->rate);
+    EXPECT_EQ(3, testConfig()->mode);
+    expectTable(0);
+
+    // a second change goes after the first, an unchanged config adds nothing
+    testConfigMutable()->mode = 5;
+    writeConfigToEEPROM();
+    writeConfigToEEPROM();
+    EXPECT_EQ(ALIGN(ALIGN(SAVED_COPY_SIZE) + TEST_CONFIG_SEGMENT_SIZE) + TEST_CONFIG_SEGMENT_SIZE, getEEPROMConfigSize());
+
+    ASSERT_TRUE(readRegion());
+    EXPECT_EQ(2000, testConfig()->rate);
+    EXPECT_EQ(5, testConfig()->mode);
+    expectTable(0);
+}
+
+TEST_F(ConfigEepromTest, TestStaleSegmentRejected)
+{
+    testConfigMutable()->rate = 2000;
+    writeConfigToEEPROM();
+    const unsigned segment = ALIGN(SAVED_COPY_SIZE);
+    const std::vector<uint8_t> staleSegment(eepromData + segment, eepromData + segment + TEST_CONFIG_SEGMENT_SIZE);
+
+    // write another saved copy of the same size, then put the segment of the old one back after it, as if it
+    // had been left in a page the rewrite did not erase
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    testConfigMutable()->rate = 1500;
+    writeConfigToEEPROM();
+    ASSERT_EQ(SAVED_COPY_SIZE, getEEPROMConfigSize());
+    memcpy(eepromData + segment, staleSegment.data(), staleSegment.size());
+
+    // its CRC is chained to the CRC of the old saved copy, so it is not part of this one
+    ASSERT_TRUE(readRegion());
+    EXPECT_EQ(SAVED_COPY_SIZE, getEEPROMConfigSize());
+    EXPECT_EQ(1500, testConfig()->rate);
+
+    // the space after the saved copy is not erased, so the next change rewrites the region
+    testConfigMutable()->mode = 4;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(writeFailed);
+    EXPECT_EQ(SAVED_COPY_SIZE, getEEPROMConfigSize());
+    ASSERT_TRUE(readRegion());
+    EXPECT_EQ(1500, testConfig()->rate);
+    EXPECT_EQ(4, testConfig()->mode);
+}
+
+TEST_F(ConfigEepromTest, TestBrokenSegmentIgnored)
+{
+    testConfigMutable()->rate = 2000;
+    writeConfigToEEPROM();
+    testConfigMutable()->rate = 3000;
+    writeConfigToEEPROM();
+
+    // a bit lost in the value of the second segment leaves the first one in use
+    const unsigned second = ALIGN(ALIGN(SAVED_COPY_SIZE) + TEST_CONFIG_SEGMENT_SIZE);
+    eepromData[second + 4 + 6] ^= 0x01;
+
+    ASSERT_TRUE(readRegion());
+    EXPECT_EQ(ALIGN(SAVED_COPY_SIZE) + TEST_CONFIG_SEGMENT_SIZE, getEEPROMConfigSize());
+    EXPECT_EQ(2000, testConfig()->rate);
+}
+
+TEST_F(ConfigEepromTest, TestCompaction)
+{
+    // change the large group until a segment no longer fits after the others
+    unsigned lastSize = getEEPROMConfigSize();
+    uint8_t seed = 0;
+    bool compacted = false;
+    while (!compacted && seed < 20) {
+        seed++;
+        setTable(seed);
+        writeConfigToEEPROM();
+        EXPECT_FALSE(writeFailed);
+        compacted = getEEPROMConfigSize() < lastSize;
+        lastSize = getEEPROMConfigSize();
+        EXPECT_LE(lastSize, sizeof(eepromData));
+    }
+
+    // the region is rewritten as one saved copy holding the latest values
+    ASSERT_TRUE(compacted);
+    EXPECT_EQ(SAVED_COPY_SIZE, getEEPROMConfigSize());
+    ASSERT_TRUE(readRegion());
+    expectTable(seed);
+    EXPECT_EQ(1000, testConfig()->rate);
+
+    // and changes are appended after it again
+    testConfigMutable()->rate = 2000;
+    writeConfigToEEPROM();
+    EXPECT_EQ(ALIGN(SAVED_COPY_SIZE) + TEST_CONFIG_SEGMENT_SIZE, getEEPROMConfigSize());
+    ASSERT_TRUE(readRegion());
+    EXPECT_EQ(2000, testConfig()->rate);
+    expectTable(seed);
+}
+
+// STUBS
+
+extern "C" {
+
+void failureMode(failureMode_e mode)
+{
+    UNUSED(mode);
+    writeFailed = true;
+}
+
+// Behaves like flash: a page is erased when writing reaches its start, and programming can only clear bits
+void config_streamer_init(config_streamer_t *c)
+{
+    memset(c, 0, sizeof(*c));
+}
+
+void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
+{
+    c->address = base;
+    c->size = size;
+    c->err = 0;
+}
+
+static int writeWord(config_streamer_t *c, uint32_t value)
+{
+    uint8_t *p = (uint8_t *)c->address;
+    if (p < eepromData || p + sizeof(value) > ARRAYEND(eepromData)) {
+        return -2;
+    }
+    if ((p - eepromData) % FLASH_PAGE_SIZE == 0) {
+        memset(p, 0xFF, FLASH_PAGE_SIZE);
+    }
+    for (unsigned i = 0; i < sizeof(value); i++) {
+        p[i] &= value >> (i * 8);
+    }
+    c->address += sizeof(value);
+    return 0;
+}
+
+int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        c->buffer.b[c->at++] = p[i];
+        if (c->at == sizeof(c->buffer)) {
+            c->err = writeWord(c, c->buffer.w);
+            c->at = 0;
+        }
+    }
+    return c->err;
+}
+
+int config_streamer_flush(config_streamer_t *c)
+{
+    if (c->at != 0) {
+        memset(c->buffer.b + c->at, 0, sizeof(c->buffer) - c->at);
+        c->err = writeWord(c, c->buffer.w);
+        c->at = 0;
+    }
+    return c->err;
+}
+
+int config_streamer_finish(config_streamer_t *c)
+{
+    return c->err;
+}
+
+int config_streamer_status(config_streamer_t *c)
+{
+    return c->err;
+}
+}
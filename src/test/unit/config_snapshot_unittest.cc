@@ -0,0 +1,372 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/axis.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/config_snapshot.h"
+    #include "config/config_streamer.h"
+
+    #include "drivers/system.h"
+
+    #include "fc/config.h"
+    #include "fc/controlrate_profile.h"
+    #include "fc/rc.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/pid.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/gyro.h"
+
+    PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+    PG_REGISTER_ARRAY(pidProfile_t, MAX_PROFILE_COUNT, pidProfiles, PG_PID_PROFILE, 0);
+    PG_REGISTER_ARRAY(controlRateConfig_t, CONTROL_RATE_PROFILE_COUNT, controlRateProfiles, PG_CONTROL_RATE_PROFILES, 0);
+
+    uint8_t armingFlags;
+    pidProfile_t *currentPidProfile;
+    uint8_t eepromData[EEPROM_SIZE];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static int gyroFilterInitCount;
+static int pidFilterInitCount;
+static int pidConfigInitCount;
+static int rcProcessingInitCount;
+static int confirmationBeeps;
+
+static void resetCounts(void)
+{
+    gyroFilterInitCount = 0;
+    pidFilterInitCount = 0;
+    pidConfigInitCount = 0;
+    rcProcessingInitCount = 0;
+    confirmationBeeps = 0;
+}
+
+static void resetSnapshots(void)
+{
+    configSnapshotDelete("a");
+    configSnapshotDelete("b");
+    pgResetAll();
+    currentPidProfile = pidProfilesMutable(0);
+    armingFlags = 0;
+    resetCounts();
+}
+
+static void setPidP(uint8_t value)
+{
+    configSnapshotTouch(PG_PID_PROFILE);
+    pidProfilesMutable(0)->pid[PID_ROLL].P = value;
+}
+
+static void setGyroLowpass(uint16_t value)
+{
+    configSnapshotTouch(PG_GYRO_CONFIG);
+    gyroConfigMutable()->gyro_lowpass_hz = value;
+}
+
+TEST(ConfigSnapshotTest, CopiesOnlyOnFirstChange)
+{
+    resetSnapshots();
+    const uint16_t poolSize = configSnapshotPoolFree();
+
+    // nothing is copied while there are no snapshots, or when one is saved
+    setPidP(40);
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotSave("a"));
+    EXPECT_EQ(poolSize, configSnapshotPoolFree());
+    EXPECT_EQ(0, configSnapshotSize(0));
+
+    setPidP(45);
+    const uint16_t size = configSnapshotSize(0);
+    EXPECT_EQ(sizeof(pidProfile_t) * MAX_PROFILE_COUNT, size - 2U);
+    EXPECT_EQ(poolSize - size, configSnapshotPoolFree());
+
+    // the group is already held, later changes cost nothing
+    setPidP(50);
+    EXPECT_EQ(size, configSnapshotSize(0));
+
+    setGyroLowpass(150);
+    EXPECT_EQ(size + 2 + sizeof(gyroConfig_t), configSnapshotSize(0));
+}
+
+TEST(ConfigSnapshotTest, SwitchesBetweenTwoSnapshots)
+{
+    resetSnapshots();
+
+    setPidP(40);
+    configSnapshotSave("a");
+    setPidP(60);
+    configSnapshotSave("b");
+    const uint16_t poolFree = configSnapshotPoolFree();
+
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotLoad("a"));
+    EXPECT_EQ(40, pidProfiles(0)->pid[PID_ROLL].P);
+    EXPECT_EQ(0, configSnapshotSize(0));
+    EXPECT_LT(0, configSnapshotSize(1));
+    // swapped in place
+    EXPECT_EQ(poolFree, configSnapshotPoolFree());
+
+    // only the PID controller is re-initialised
+    EXPECT_EQ(1, pidConfigInitCount);
+    EXPECT_EQ(1, pidFilterInitCount);
+    EXPECT_EQ(1, rcProcessingInitCount);
+    EXPECT_EQ(0, gyroFilterInitCount);
+
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotLoad("B"));
+    EXPECT_EQ(60, pidProfiles(0)->pid[PID_ROLL].P);
+    EXPECT_EQ(poolFree, configSnapshotPoolFree());
+
+    EXPECT_EQ(CONFIG_SNAPSHOT_NOT_FOUND, configSnapshotLoad("c"));
+}
+
+TEST(ConfigSnapshotTest, ModeSwitchHoldsFiltersUntilDisarm)
+{
+    resetSnapshots();
+
+    setGyroLowpass(100);
+    setPidP(40);
+    configSnapshotSave("a");
+    setGyroLowpass(200);
+    setPidP(60);
+    configSnapshotSave("b");
+
+    configSnapshotUpdate(true);
+    configSnapshotUpdate(false);
+    EXPECT_EQ(100, gyroConfig()->gyro_lowpass_hz);
+    EXPECT_EQ(1, confirmationBeeps);
+    resetCounts();
+
+    ENABLE_ARMING_FLAG(ARMED);
+    configSnapshotUpdate(true);
+    EXPECT_EQ(200, gyroConfig()->gyro_lowpass_hz);
+    EXPECT_EQ(60, pidProfiles(0)->pid[PID_ROLL].P);
+    EXPECT_EQ(2, confirmationBeeps);
+    EXPECT_EQ(1, pidConfigInitCount);
+    EXPECT_EQ(0, pidFilterInitCount);
+    EXPECT_EQ(0, gyroFilterInitCount);
+
+    configSnapshotUpdate(true);
+    EXPECT_EQ(0, gyroFilterInitCount);
+
+    DISABLE_ARMING_FLAG(ARMED);
+    configSnapshotUpdate(true);
+    EXPECT_EQ(1, pidFilterInitCount);
+    EXPECT_EQ(1, gyroFilterInitCount);
+}
+
+TEST(ConfigSnapshotTest, GyroSettingsTakenUpAtBootMustMatch)
+{
+    resetSnapshots();
+
+    configSnapshotTouch(PG_GYRO_CONFIG);
+    gyroConfigMutable()->gyro_sync_denom = 1;
+    configSnapshotSave("a");
+    configSnapshotTouch(PG_GYRO_CONFIG);
+    gyroConfigMutable()->gyro_sync_denom = 2;
+    setGyroLowpass(200);
+    configSnapshotSave("b");
+    configSnapshotUpdate(true);
+    resetCounts();
+
+    // neither the CLI nor the mode switch can load a snapshot that needs the gyro initialised again
+    EXPECT_EQ(CONFIG_SNAPSHOT_NEEDS_REBOOT, configSnapshotLoad("a"));
+    configSnapshotUpdate(false);
+    EXPECT_EQ(2, gyroConfig()->gyro_sync_denom);
+    EXPECT_EQ(200, gyroConfig()->gyro_lowpass_hz);
+    EXPECT_EQ(0, confirmationBeeps);
+    EXPECT_EQ(0, gyroFilterInitCount);
+
+    // the filters alone can change
+    setGyroLowpass(100);
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotLoad("b"));
+    EXPECT_EQ(200, gyroConfig()->gyro_lowpass_hz);
+    EXPECT_EQ(1, gyroFilterInitCount);
+}
+
+TEST(ConfigSnapshotTest, TouchWithoutChangeIsDropped)
+{
+    resetSnapshots();
+
+    configSnapshotSave("a");
+    configSnapshotTouch(PG_GYRO_CONFIG);
+    setPidP(70);
+    configSnapshotSave("b");
+    EXPECT_EQ(4 + sizeof(gyroConfig_t) + sizeof(pidProfile_t) * MAX_PROFILE_COUNT, configSnapshotSize(0));
+
+    configSnapshotLoad("a");
+    EXPECT_EQ(0, configSnapshotSize(0));
+    // b only keeps the group that differs
+    EXPECT_EQ(2 + sizeof(pidProfile_t) * MAX_PROFILE_COUNT, configSnapshotSize(1));
+}
+
+TEST(ConfigSnapshotTest, ReloadInvalidatesSharedGroups)
+{
+    resetSnapshots();
+
+    configSnapshotSave("a");
+
+    // a save and reload that changes nothing keeps the snapshot
+    configSnapshotReloadStart();
+    configSnapshotReloadEnd();
+    EXPECT_TRUE(configSnapshotIsComplete(0));
+
+    configSnapshotReloadStart();
+    controlRateProfilesMutable(0)->rcRates[FD_ROLL] = 120;
+    configSnapshotReloadEnd();
+    EXPECT_FALSE(configSnapshotIsComplete(0));
+    EXPECT_EQ(CONFIG_SNAPSHOT_INCOMPLETE, configSnapshotLoad("a"));
+
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotSave("a"));
+    EXPECT_TRUE(configSnapshotIsComplete(0));
+}
+
+TEST(ConfigSnapshotTest, PoolOverflowMarksSnapshotIncomplete)
+{
+    resetSnapshots();
+
+    configSnapshotSave("a");
+    configSnapshotSave("b");
+    EXPECT_EQ(CONFIG_SNAPSHOT_NO_SLOT, configSnapshotSave("c"));
+
+    // the pool holds one full set, so the second snapshot cannot follow a change to every group
+    setGyroLowpass(300);
+    setPidP(80);
+    configSnapshotTouch(PG_CONTROL_RATE_PROFILES);
+    controlRateProfilesMutable(0)->rcRates[FD_ROLL] = 130;
+
+    EXPECT_TRUE(configSnapshotIsComplete(0));
+    EXPECT_FALSE(configSnapshotIsComplete(1));
+    EXPECT_EQ(0, configSnapshotPoolFree());
+    EXPECT_EQ(0, configSnapshotSize(1));
+    EXPECT_EQ(CONFIG_SNAPSHOT_INCOMPLETE, configSnapshotLoad("b"));
+
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotLoad("a"));
+    EXPECT_EQ(0, pidProfiles(0)->pid[PID_ROLL].P);
+}
+
+// As at boot: everything in RAM is lost, then the config is read back
+static void reloadFromEeprom(void)
+{
+    pgResetAll();
+    ASSERT_TRUE(isEEPROMVersionValid());
+    ASSERT_TRUE(isEEPROMStructureValid());
+    ASSERT_TRUE(loadEEPROM());
+    configSnapshotLoaded();
+}
+
+TEST(ConfigSnapshotTest, SnapshotsAreSavedWithTheConfig)
+{
+    resetSnapshots();
+
+    setPidP(40);
+    configSnapshotSave("a");
+    setPidP(60);
+    setGyroLowpass(250);
+    configSnapshotSave("b");
+    const uint16_t size = configSnapshotSize(0);
+    const uint16_t poolFree = configSnapshotPoolFree();
+
+    writeConfigToEEPROM();
+    reloadFromEeprom();
+
+    EXPECT_STREQ("a", configSnapshotName(0));
+    EXPECT_STREQ("b", configSnapshotName(1));
+    EXPECT_EQ(size, configSnapshotSize(0));
+    EXPECT_EQ(poolFree, configSnapshotPoolFree());
+    EXPECT_EQ(60, pidProfiles(0)->pid[PID_ROLL].P);
+
+    // and switching carries on without a reboot
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotLoad("a"));
+    EXPECT_EQ(40, pidProfiles(0)->pid[PID_ROLL].P);
+    EXPECT_EQ(0, gyroConfig()->gyro_lowpass_hz);
+    EXPECT_EQ(CONFIG_SNAPSHOT_OK, configSnapshotLoad("b"));
+    EXPECT_EQ(60, pidProfiles(0)->pid[PID_ROLL].P);
+    EXPECT_EQ(250, gyroConfig()->gyro_lowpass_hz);
+
+    // changes that were never saved go along with the live config they were made against
+    setPidP(70);
+    reloadFromEeprom();
+    EXPECT_EQ(60, pidProfiles(0)->pid[PID_ROLL].P);
+    EXPECT_EQ(size, configSnapshotSize(0));
+    EXPECT_EQ(0, configSnapshotSize(1));
+}
+
+TEST(ConfigSnapshotTest, SnapshotsThatDontFitTheGroupsAreDropped)
+{
+    resetSnapshots();
+    const uint16_t poolSize = configSnapshotPoolFree();
+
+    configSnapshotSave("a");
+    setPidP(40);
+
+    // records that don't walk the pool, as after an update changed the size of a group
+    const pgRegistry_t *reg = pgFind(PG_CONFIG_SNAPSHOT);
+    ASSERT_NE(nullptr, reg);
+    memset(reg->address, 0xFF, pgSize(reg));
+    writeConfigToEEPROM();
+    reloadFromEeprom();
+
+    EXPECT_EQ(nullptr, configSnapshotName(0));
+    EXPECT_EQ(nullptr, configSnapshotName(1));
+    EXPECT_EQ(poolSize, configSnapshotPoolFree());
+    EXPECT_EQ(CONFIG_SNAPSHOT_NOT_FOUND, configSnapshotLoad("a"));
+}
+
+// STUBS
+
+extern "C" {
+void gyroInitFilters(void) { gyroFilterInitCount++; }
+void pidInitFilters(const pidProfile_t *) { pidFilterInitCount++; }
+void pidInitConfig(const pidProfile_t *) { pidConfigInitCount++; }
+void initRcProcessing(void) { rcProcessingInitCount++; }
+void beeperConfirmationBeeps(uint8_t beepCount) { confirmationBeeps = beepCount; }
+void failureMode(failureMode_e) {}
+
+void config_streamer_init(config_streamer_t *c)
+{
+    memset(c, 0, sizeof(*c));
+}
+
+void config_streamer_start(config_streamer_t *c, uintptr_t base, int)
+{
+    c->address = base;
+}
+
+int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size)
+{
+    memcpy((uint8_t *)c->address, p, size);
+    c->address += size;
+
+    return 0;
+}
+
+int config_streamer_flush(config_streamer_t *) { return 0; }
+int config_streamer_finish(config_streamer_t *) { return 0; }
+int config_streamer_status(config_streamer_t *) { return 0; }
+}
@@ -0,0 +1,291 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/config_transfer.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct testConfig_s {
+        uint16_t rate;
+        uint8_t mode;
+        int32_t offset;
+    } testConfig_t;
+
+    PG_DECLARE(testConfig_t, testConfig);
+
+    PG_REGISTER_WITH_RESET_TEMPLATE(testConfig_t, testConfig, PG_RESERVED_FOR_TESTING_1, 1);
+
+    PG_RESET_TEMPLATE(testConfig_t, testConfig,
+        .rate = 1000,
+        .mode = 3,
+        .offset = -5
+    );
+
+    typedef struct testTableConfig_s {
+        uint8_t values[40];
+    } testTableConfig_t;
+
+    PG_DECLARE(testTableConfig_t, testTableConfig);
+
+    PG_REGISTER(testTableConfig_t, testTableConfig, PG_RESERVED_FOR_TESTING_2, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static std::vector<uint8_t> readImage(int chunkSize)
+{
+    std::vector<uint8_t> image;
+    uint8_t chunk[256];
+    int length;
+    while ((length = configTransferRead(image.size(), chunk, chunkSize)) > 0) {
+        image.insert(image.end(), chunk, chunk + length);
+    }
+
+    return image;
+}
+
+static configTransferResult_e writeImage(const std::vector<uint8_t> &image, int chunkSize)
+{
+    configTransferResult_e result = CONFIG_TRANSFER_ERROR;
+    for (unsigned offset = 0; offset < image.size(); offset += chunkSize) {
+        const int length = std::min<int>(chunkSize, image.size() - offset);
+        result = configTransferWrite(offset, &image[offset], length);
+        if (result != CONFIG_TRANSFER_MORE) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+static void fixCrc(std::vector<uint8_t> &image)
+{
+    const uint16_t crc = crc16_ccitt_update(CRC_START_VALUE, &image[0], image.size() - sizeof(uint16_t));
+    const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
+    memcpy(&image[image.size() - sizeof(uint16_t)], &invertedBigEndianCrc, sizeof(invertedBigEndianCrc));
+}
+
+static unsigned findRecord(const std::vector<uint8_t> &image, pgn_t pgn)
+{
+    unsigned offset = sizeof(configHeader_t);
+    for (;;) {
+        const configRecord_t *record = (const configRecord_t *)&image[offset];
+        if (record->size == 0 || record->pgn == pgn) {
+            return offset;
+        }
+        offset += record->size;
+    }
+}
+
+static void setTestValues(void)
+{
+    testConfigMutable()->rate = 1234;
+    testConfigMutable()->mode = 7;
+    testConfigMutable()->offset = -100000;
+    for (int i = 0; i < 40; i++) {
+        testTableConfigMutable()->values[i] = i * 3;
+    }
+}
+
+static void expectTestValues(void)
+{
+    EXPECT_EQ(1234, testConfig()->rate);
+    EXPECT_EQ(7, testConfig()->mode);
+    EXPECT_EQ(-100000, testConfig()->offset);
+    for (int i = 0; i < 40; i++) {
+        EXPECT_EQ(i * 3, testTableConfig()->values[i]);
+    }
+}
+
+static void clearTestValues(void)
+{
+    memset(testConfigMutable(), 0, sizeof(testConfig_t));
+    memset(testTableConfigMutable(), 0, sizeof(testTableConfig_t));
+}
+
+TEST(ConfigTransferTest, TestImageLayout)
+{
+    pgResetAll();
+    const std::vector<uint8_t> image = readImage(256);
+
+    // header, a record per PG, footer and CRC
+    ASSERT_EQ(2 + 6 + sizeof(testConfig_t) + 6 + sizeof(testTableConfig_t) + 2 + 2, image.size());
+    EXPECT_EQ(image.size(), configTransferImageSize());
+    EXPECT_EQ(EEPROM_CONF_VERSION, image[0]);
+    EXPECT_EQ(0xBE, image[1]);
+
+    const configRecord_t *record = (const configRecord_t *)&image[findRecord(image, PG_RESERVED_FOR_TESTING_1)];
+    EXPECT_EQ(sizeof(configRecord_t) + sizeof(testConfig_t), record->size);
+    EXPECT_EQ(1, record->version);
+    EXPECT_EQ(0, record->flags);
+    EXPECT_EQ(0, memcmp(record->pg, testConfig(), sizeof(testConfig_t)));
+
+    EXPECT_EQ(0, image[image.size() - 4]);
+    EXPECT_EQ(0, image[image.size() - 3]);
+    EXPECT_EQ(CRC_CHECK_VALUE, crc16_ccitt_update(CRC_START_VALUE, &image[0], image.size()));
+}
+
+TEST(ConfigTransferTest, TestChunkedRead)
+{
+    setTestValues();
+    const std::vector<uint8_t> image = readImage(256);
+
+    EXPECT_EQ(image, readImage(1));
+    EXPECT_EQ(image, readImage(7));
+
+    uint8_t chunk[16];
+    EXPECT_EQ(0, configTransferRead(image.size(), chunk, sizeof(chunk)));
+    EXPECT_EQ(3, configTransferRead(image.size() - 3, chunk, sizeof(chunk)));
+}
+
+TEST(ConfigTransferTest, TestRoundTrip)
+{
+    setTestValues();
+    const std::vector<uint8_t> image = readImage(64);
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, writeImage(image, 5));
+    expectTestValues();
+
+    // a second transfer starts over at offset 0
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, writeImage(image, image.size()));
+    expectTestValues();
+}
+
+TEST(ConfigTransferTest, TestNothingLoadedUntilComplete)
+{
+    setTestValues();
+    const std::vector<uint8_t> image = readImage(64);
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_MORE, configTransferWrite(0, &image[0], image.size() - 1));
+    EXPECT_EQ(0, testConfig()->rate);
+    EXPECT_EQ(0, testTableConfig()->values[1]);
+
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, configTransferWrite(image.size() - 1, &image[image.size() - 1], 1));
+    expectTestValues();
+}
+
+TEST(ConfigTransferTest, TestBadCrc)
+{
+    setTestValues();
+    std::vector<uint8_t> image = readImage(64);
+    image[findRecord(image, PG_RESERVED_FOR_TESTING_2) + sizeof(configRecord_t) + 5] ^= 0x10;
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_ERROR, writeImage(image, 16));
+    EXPECT_EQ(0, testConfig()->rate);
+    EXPECT_EQ(0, testTableConfig()->values[1]);
+}
+
+TEST(ConfigTransferTest, TestBadHeader)
+{
+    std::vector<uint8_t> image = readImage(64);
+    image[0] = EEPROM_CONF_VERSION + 1;
+    fixCrc(image);
+
+    EXPECT_EQ(CONFIG_TRANSFER_ERROR, writeImage(image, 16));
+}
+
+TEST(ConfigTransferTest, TestOutOfOrderChunk)
+{
+    setTestValues();
+    const std::vector<uint8_t> image = readImage(64);
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_MORE, configTransferWrite(0, &image[0], 10));
+    EXPECT_EQ(CONFIG_TRANSFER_ERROR, configTransferWrite(20, &image[20], 10));
+    // the transfer stays failed until it starts over
+    EXPECT_EQ(CONFIG_TRANSFER_ERROR, configTransferWrite(10, &image[10], image.size() - 10));
+    EXPECT_EQ(0, testConfig()->rate);
+
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, writeImage(image, 10));
+    expectTestValues();
+
+    // data past the end of a complete image
+    EXPECT_EQ(CONFIG_TRANSFER_ERROR, configTransferWrite(image.size(), &image[0], 1));
+}
+
+TEST(ConfigTransferTest, TestVersionMismatchLoadsDefaults)
+{
+    setTestValues();
+    std::vector<uint8_t> image = readImage(64);
+    configRecord_t *record = (configRecord_t *)&image[findRecord(image, PG_RESERVED_FOR_TESTING_1)];
+    record->version = 2;
+    fixCrc(image);
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, writeImage(image, 16));
+    EXPECT_EQ(1000, testConfig()->rate);
+    EXPECT_EQ(3, testConfig()->mode);
+    EXPECT_EQ(-5, testConfig()->offset);
+    EXPECT_EQ(3, testTableConfig()->values[1]);
+}
+
+TEST(ConfigTransferTest, TestUnknownRecordSkipped)
+{
+    setTestValues();
+    std::vector<uint8_t> image = readImage(64);
+
+    // a record for a PG this build does not have, ahead of the footer
+    const uint8_t unknownRecord[] = { 9, 0, PG_RESERVED_FOR_TESTING_3 & 0xFF, PG_RESERVED_FOR_TESTING_3 >> 8, 0, 0, 1, 2, 3 };
+    image.insert(image.end() - 4, unknownRecord, unknownRecord + sizeof(unknownRecord));
+    fixCrc(image);
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, writeImage(image, 16));
+    expectTestValues();
+}
+
+TEST(ConfigTransferTest, TestShortRecord)
+{
+    setTestValues();
+    std::vector<uint8_t> image = readImage(64);
+
+    // a record shorter than the PG, as written by a build where the PG was smaller, keeps the defaults for the rest
+    const unsigned recordOffset = findRecord(image, PG_RESERVED_FOR_TESTING_1);
+    configRecord_t *record = (configRecord_t *)&image[recordOffset];
+    record->size -= 4;
+    image.erase(image.begin() + recordOffset + sizeof(configRecord_t) + sizeof(testConfig_t) - 4, image.begin() + recordOffset + sizeof(configRecord_t) + sizeof(testConfig_t));
+    fixCrc(image);
+
+    clearTestValues();
+    EXPECT_EQ(CONFIG_TRANSFER_COMPLETE, writeImage(image, 16));
+    EXPECT_EQ(1234, testConfig()->rate);
+    EXPECT_EQ(7, testConfig()->mode);
+    EXPECT_EQ(-5, testConfig()->offset);
+}
+
+// STUBS
+
+extern "C" {
+}
@@ -0,0 +1,793 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "drivers/flash.h"
+
+    #include "io/flashfs.h"
+    #include "io/flashfs_log.h"
+
+    #include "pg/flash.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    PG_REGISTER(flashConfig_t, flashConfig, PG_FLASH_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * A simulated 320KiB SPI NOR flash with M25P16-like timing: a page program takes about 0.8ms for 256 bytes, a
+ * sector erase 600ms and a bulk erase 13s. Time only passes when the test advances it, or when flashfs waits for
+ * the device.
+ */
+#define SIM_PAGE_SIZE       256
+#define SIM_PAGES_PER_SECTOR 256
+#define SIM_SECTORS         5
+#define SIM_SECTOR_SIZE     (SIM_PAGE_SIZE * SIM_PAGES_PER_SECTOR)
+#define SIM_TOTAL_SIZE      (SIM_SECTOR_SIZE * SIM_SECTORS)
+
+#define SIM_PROGRAM_US(length)  (50 + 3 * (length))
+#define SIM_SECTOR_ERASE_US     600000
+#define SIM_BULK_ERASE_US       13000000
+
+static uint8_t simFlash[SIM_TOTAL_SIZE];
+static uint32_t simTimeUs;
+static uint32_t simBusyUntilUs;
+
+static int simProgramCount;
+static int simPartialProgramCount;  // programs that didn't cover a whole page
+static int simProgramWhileBusyCount;
+static int simProgramUnerasedCount; // programs that needed bits set back to 1
+static int simPageCrossingCount;
+static int simWaitCount;
+static int simEraseCount[SIM_SECTORS];
+
+static void simReset(bool logStructured = false, uint8_t eraseAheadPercent = 25)
+{
+    memset(simFlash, 0xFF, sizeof(simFlash));
+    simTimeUs = 0;
+    simBusyUntilUs = 0;
+    simProgramCount = 0;
+    simPartialProgramCount = 0;
+    simProgramWhileBusyCount = 0;
+    simProgramUnerasedCount = 0;
+    simPageCrossingCount = 0;
+    simWaitCount = 0;
+    memset(simEraseCount, 0, sizeof(simEraseCount));
+
+    flashConfigMutable()->logStructured = logStructured;
+    flashConfigMutable()->eraseAheadPercent = eraseAheadPercent;
+
+    flashfsInit();
+}
+
+// The first two sectors take turns to hold the index in log-structured mode
+#define SIM_INDEX_SECTORS   2
+
+static int simIndexEraseCount(void)
+{
+    return simEraseCount[0] + simEraseCount[1];
+}
+
+static int simDataEraseCount(void)
+{
+    int count = 0;
+    for (int i = SIM_INDEX_SECTORS; i < SIM_SECTORS; i++) {
+        count += simEraseCount[i];
+    }
+
+    return count;
+}
+
+// As after a power cycle, once the device has finished whatever it was doing
+static void simRestart(void)
+{
+    simTimeUs = simBusyUntilUs;
+
+    flashfsInit();
+}
+
+static void simAdvance(uint32_t us)
+{
+    simTimeUs += us;
+}
+
+static void expectDeviceMatches(uint32_t address, const uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        ASSERT_EQ(data[i], simFlash[address + i]) << "at address " << address + i;
+    }
+}
+
+static uint8_t patternByte(uint32_t i)
+{
+    return (i * 7 + (i >> 8)) & 0xFF;
+}
+
+// Log at a steady rate, writing a frame per loop iteration and letting the device run between iterations
+static uint32_t writeFrames(uint32_t start, int frames, int frameLength, uint32_t loopUs)
+{
+    uint8_t frame[64];
+    uint32_t written = 0;
+
+    for (int i = 0; i < frames; i++) {
+        for (int j = 0; j < frameLength; j++) {
+            frame[j] = patternByte(start + written + j);
+        }
+        flashfsWrite(frame, frameLength, false);
+        written += frameLength;
+
+        simAdvance(loopUs);
+        flashfsFlushAsync(false);
+    }
+
+    return written;
+}
+
+static void drain(void)
+{
+    while (!flashfsFlushAsync(true)) {
+        simAdvance(100);
+    }
+}
+
+TEST(FlashfsTest, StreamReachesDeviceWithoutWaiting)
+{
+    simReset();
+    EXPECT_EQ(0U, flashfsGetOffset());
+
+    // 64 bytes every 250us is 256KB/s, inside the ~310KB/s the device can program
+    const uint32_t written = writeFrames(0, 1024, 64, 250);
+    drain();
+
+    EXPECT_EQ(written, flashfsGetOffset());
+    EXPECT_EQ(0, simWaitCount);
+    EXPECT_EQ(0, simProgramWhileBusyCount);
+    EXPECT_EQ(0, simPageCrossingCount);
+
+    for (uint32_t i = 0; i < written; i++) {
+        ASSERT_EQ(patternByte(i), simFlash[i]) << "at address " << i;
+    }
+}
+
+TEST(FlashfsTest, FullBuffersAreProgrammedAsWholePages)
+{
+    simReset();
+
+    const uint32_t written = writeFrames(0, 256, 64, 250);
+    EXPECT_EQ(0U, written % FLASHFS_WRITE_BUFFER_SIZE);
+    drain();
+
+    EXPECT_EQ((int)(written / SIM_PAGE_SIZE), simProgramCount);
+    EXPECT_EQ(0, simPartialProgramCount);
+}
+
+TEST(FlashfsTest, AsyncWriteIsDroppedWholeWhenBuffersAreFull)
+{
+    simReset();
+
+    uint8_t frame[48];
+    memset(frame, 0x5A, sizeof(frame));
+
+    // With no time passing the device stays busy with the first page, so both buffers fill up
+    while (flashfsGetWriteBufferFreeSpace() >= sizeof(frame)) {
+        flashfsWrite(frame, sizeof(frame), false);
+    }
+    const uint32_t offset = flashfsGetOffset();
+    EXPECT_EQ(1, simProgramCount);
+
+    flashfsWrite(frame, sizeof(frame), false);
+    EXPECT_EQ(offset, flashfsGetOffset());
+
+    // A synchronous write waits for the device instead
+    flashfsWrite(frame, sizeof(frame), true);
+    EXPECT_EQ(offset + sizeof(frame), flashfsGetOffset());
+    EXPECT_GT(simWaitCount, 0);
+    EXPECT_EQ(0, simProgramWhileBusyCount);
+
+    flashfsFlushSync();
+    for (uint32_t i = 0; i < offset + sizeof(frame); i++) {
+        ASSERT_EQ(0x5A, simFlash[i]) << "at address " << i;
+    }
+}
+
+TEST(FlashfsTest, ProgrammingWaitsForErase)
+{
+    simReset();
+
+    flashfsEraseCompletely();
+    EXPECT_FALSE(flashfsIsReady());
+
+    writeFrames(0, 64, 32, 1000);
+    EXPECT_EQ(0, simProgramCount);
+    EXPECT_EQ(0, simProgramWhileBusyCount);
+
+    simAdvance(SIM_BULK_ERASE_US);
+    drain();
+
+    EXPECT_EQ(2048U, flashfsGetOffset());
+    EXPECT_EQ(0, simProgramWhileBusyCount);
+    EXPECT_EQ(0, simWaitCount);
+}
+
+TEST(FlashfsTest, UnalignedStartKeepsPagesWhole)
+{
+    simReset();
+
+    // Start part way into a page, as after a short log
+    flashfsSeekAbs(100);
+
+    const uint32_t written = writeFrames(100, 200, 50, 250);
+    drain();
+
+    EXPECT_EQ(100 + written, flashfsGetOffset());
+    EXPECT_EQ(0, simPageCrossingCount);
+    // Only the first page and the final forced flush may be partial
+    EXPECT_LE(simPartialProgramCount, 2);
+
+    uint8_t expected[50 * 200];
+    for (uint32_t i = 0; i < written; i++) {
+        expected[i] = patternByte(100 + i);
+    }
+    expectDeviceMatches(100, expected, written);
+
+    // A fresh start finds the end of the data
+    flashfsInit();
+    EXPECT_EQ(2048U * ((100 + written + 2047) / 2048), flashfsGetOffset());
+}
+
+TEST(FlashfsTest, WritesPastTheEndAreDiscarded)
+{
+    simReset();
+
+    flashfsSeekAbs(SIM_TOTAL_SIZE - 512);
+    writeFrames(0, 32, 64, 1000);
+    drain();
+
+    EXPECT_TRUE(flashfsIsEOF());
+    EXPECT_EQ(0, simPageCrossingCount);
+}
+
+// Let the file system do its housekeeping between flights
+static void idle(int ms)
+{
+    for (int i = 0; i < ms; i++) {
+        flashfsEraseAhead();
+        simAdvance(1000);
+    }
+}
+
+static uint32_t logFlight(uint32_t seed, int frames)
+{
+    flashfsBeginLog();
+    const uint32_t written = writeFrames(seed, frames, 64, 250);
+    flashfsEndLog(true);
+    drain();
+
+    return written;
+}
+
+// Readers find the logs back to back, oldest first
+static uint32_t logVolumeAddress(int index)
+{
+    uint32_t address = 0;
+    for (int i = 0; i < index; i++) {
+        address += flashfsLogGet(i)->length;
+    }
+
+    return address;
+}
+
+static void expectLogMatches(int index, uint32_t seed)
+{
+    const flashfsLog_t *log = flashfsLogGet(index);
+    const uint32_t address = logVolumeAddress(index);
+    uint8_t buffer[100];
+    uint32_t offset = 0;
+
+    while (offset < log->length) {
+        const int bytesRead = flashfsReadAbs(address + offset, buffer, MIN(sizeof(buffer), log->length - offset));
+        ASSERT_GT(bytesRead, 0);
+        for (int i = 0; i < bytesRead; i++) {
+            ASSERT_EQ(patternByte(seed + offset + i), buffer[i]) << "log " << log->sequence << " at " << offset + i;
+        }
+        offset += bytesRead;
+    }
+}
+
+TEST(FlashfsLogTest, LogsAreFoundFromTheIndex)
+{
+    simReset(true);
+    idle(2000);
+
+    uint32_t lengths[3];
+    for (int i = 0; i < 3; i++) {
+        lengths[i] = logFlight(i * 1000, 100 + i * 10);
+        idle(1000);
+    }
+    ASSERT_EQ(3, flashfsLogCount());
+
+    simRestart();
+
+    ASSERT_EQ(3, flashfsLogCount());
+    for (int i = 0; i < 3; i++) {
+        const flashfsLog_t *log = flashfsLogGet(i);
+        EXPECT_EQ(i + 1, log->sequence);
+        EXPECT_EQ(lengths[i], log->length);
+        EXPECT_EQ(0, log->flags);
+        expectLogMatches(i, i * 1000);
+    }
+
+    // New data carries on after the last log
+    const flashfsLog_t *last = flashfsLogGet(2);
+    EXPECT_EQ(last->start + last->length, flashfsGetOffset());
+    EXPECT_EQ(0, simProgramUnerasedCount);
+}
+
+TEST(FlashfsLogTest, ErasingAheadKeepsLoggingFromWaiting)
+{
+    // With no share of the ring set aside, every sector no log has data in is erased ahead
+    simReset(true, 0);
+    idle(2000);
+    EXPECT_EQ(2, simDataEraseCount());
+
+    simWaitCount = 0;
+    const uint32_t written = logFlight(0, 1600);
+
+    // 100KB went out at the logging rate without an erase or a single dropped write
+    EXPECT_EQ(2, simDataEraseCount());
+    EXPECT_EQ(0, simWaitCount);
+    EXPECT_EQ(0, simProgramUnerasedCount);
+    ASSERT_EQ(1, flashfsLogCount());
+    EXPECT_EQ(written, flashfsLogGet(0)->length);
+    expectLogMatches(0, 0);
+}
+
+TEST(FlashfsLogTest, ErasingAheadRecyclesRoomForTheNextLog)
+{
+    simReset(true, 0);
+    idle(2000);
+
+    // Once the ring is full of logs, the oldest are recycled ahead of time for one as long as the longest kept
+    for (int i = 0; i < 12; i++) {
+        const int erases = simDataEraseCount();
+        simWaitCount = 0;
+        const uint32_t written = logFlight(i * 1000, 480);
+
+        EXPECT_EQ(erases, simDataEraseCount()) << "flight " << i;
+        EXPECT_EQ(0, simWaitCount);
+        EXPECT_EQ(written, flashfsLogGet(flashfsLogCount() - 1)->length);
+        idle(2000);
+    }
+    EXPECT_GE(flashfsLogCount(), 3);
+    EXPECT_EQ(0, simProgramUnerasedCount);
+}
+
+TEST(FlashfsLogTest, RingRecyclesTheOldestLogs)
+{
+    simReset(true);
+    idle(2000);
+
+    // 20KB logs, twelve of them are more than the 192KB ring holds
+    const int flights = 12;
+    for (int i = 0; i < flights; i++) {
+        logFlight(i * 1000, 320);
+        idle(1000);
+    }
+
+    // The newest logs survive, back to back, apart from the ones sharing a sector with the erase front
+    const int count = flashfsLogCount();
+    ASSERT_GE(count, 5);
+    EXPECT_LT(count, flights);
+    for (int i = 0; i < count; i++) {
+        const flashfsLog_t *log = flashfsLogGet(i);
+        EXPECT_EQ(flights - count + i + 1, log->sequence);
+        expectLogMatches(i, (log->sequence - 1) * 1000);
+    }
+
+    flashfsLog_t logs[FLASHFS_LOG_MAX];
+    for (int i = 0; i < count; i++) {
+        logs[i] = *flashfsLogGet(i);
+    }
+
+    simRestart();
+
+    ASSERT_EQ(count, flashfsLogCount());
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(logs[i].sequence, flashfsLogGet(i)->sequence);
+        EXPECT_EQ(logs[i].start, flashfsLogGet(i)->start);
+        EXPECT_EQ(logs[i].length, flashfsLogGet(i)->length);
+    }
+
+    // Every data sector came around the ring once, the index was erased only to format it
+    EXPECT_EQ(1, simIndexEraseCount());
+    for (int i = SIM_INDEX_SECTORS; i < SIM_SECTORS; i++) {
+        EXPECT_GE(simEraseCount[i], 1);
+        EXPECT_LE(simEraseCount[i], 2);
+    }
+    EXPECT_EQ(0, simProgramUnerasedCount);
+}
+
+TEST(FlashfsLogTest, ReadersSeeTheLogsBackToBack)
+{
+    simReset(true);
+    idle(2000);
+
+    // Enough logs for one of them to run around the end of the ring
+    for (int i = 0; i < 12; i++) {
+        logFlight(i * 1000, 320);
+        idle(1000);
+    }
+
+    uint32_t used = 0;
+    bool wrapped = false;
+    for (int i = 0; i < flashfsLogCount(); i++) {
+        const flashfsLog_t *log = flashfsLogGet(i);
+        used += log->length;
+        wrapped |= log->start + log->length > flashfsLogAreaSize();
+        expectLogMatches(i, (log->sequence - 1) * 1000);
+    }
+    EXPECT_TRUE(wrapped);
+    EXPECT_EQ(used, flashfsGetUsedSize());
+    EXPECT_EQ(used, flashfsGetReadableSize());
+
+    // A single read carries on from one log into the next
+    const flashfsLog_t *first = flashfsLogGet(0);
+    uint8_t buffer[200];
+    ASSERT_EQ(200, flashfsReadAbs(first->length - 100, buffer, sizeof(buffer)));
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(patternByte((first->sequence - 1) * 1000 + first->length - 100 + i), buffer[i]);
+        EXPECT_EQ(patternByte(first->sequence * 1000 + i), buffer[100 + i]);
+    }
+
+    // Nothing past the newest log
+    EXPECT_EQ(50, flashfsReadAbs(used - 50, buffer, sizeof(buffer)));
+    EXPECT_EQ(0, flashfsReadAbs(used, buffer, sizeof(buffer)));
+
+    // The open log counts as it grows
+    flashfsBeginLog();
+    const uint32_t written = writeFrames(20000, 10, 64, 250);
+    EXPECT_EQ(used + written, flashfsGetUsedSize());
+    ASSERT_EQ(64, flashfsReadAbs(used + written - 64, buffer, sizeof(buffer)));
+    for (int i = 0; i < 64; i++) {
+        EXPECT_EQ(patternByte(20000 + written - 64 + i), buffer[i]);
+    }
+}
+
+TEST(FlashfsLogTest, DeletedLogStaysDeleted)
+{
+    simReset(true);
+    idle(2000);
+
+    for (int i = 0; i < 3; i++) {
+        logFlight(i * 1000, 50);
+    }
+
+    EXPECT_TRUE(flashfsLogDelete(2));
+    EXPECT_FALSE(flashfsLogDelete(2));
+    idle(10);
+
+    simRestart();
+
+    ASSERT_EQ(2, flashfsLogCount());
+    EXPECT_EQ(1, flashfsLogGet(0)->sequence);
+    EXPECT_EQ(3, flashfsLogGet(1)->sequence);
+    expectLogMatches(1, 2000);
+}
+
+TEST(FlashfsLogTest, UnclosedLogIsRecovered)
+{
+    simReset(true);
+    idle(2000);
+
+    logFlight(0, 50);
+
+    // Power lost in flight
+    flashfsBeginLog();
+    const uint32_t written = writeFrames(1000, 160, 64, 250);
+    drain();
+
+    simRestart();
+
+    ASSERT_EQ(2, flashfsLogCount());
+    const flashfsLog_t *log = flashfsLogGet(1);
+    EXPECT_EQ(2, log->sequence);
+    EXPECT_EQ(FLASHFS_LOG_FLAG_RECOVERED, log->flags);
+    EXPECT_GE(log->length, written);
+    EXPECT_LT(log->length, written + SIM_PAGE_SIZE);
+
+    // The next log starts clear of it
+    logFlight(5000, 10);
+    EXPECT_EQ(3, flashfsLogCount());
+    EXPECT_EQ(log->start + log->length, flashfsLogGet(2)->start);
+    EXPECT_EQ(0, simProgramUnerasedCount);
+}
+
+TEST(FlashfsLogTest, FullIndexIsRewritten)
+{
+    simReset(true);
+    idle(2000);
+    simWaitCount = 0;
+
+    // Two records a log fill the 4096 slots of the index
+    const int logs = 2100;
+    for (int i = 0; i < logs; i++) {
+        logFlight(i, 1);
+        idle(2);
+    }
+    idle(2000);
+    EXPECT_EQ(2, simIndexEraseCount());
+
+    // The live state went back a record at a time, never waiting for the device
+    EXPECT_EQ(0, simWaitCount);
+    EXPECT_EQ(0, simProgramWhileBusyCount);
+
+    simRestart();
+
+    ASSERT_EQ(FLASHFS_LOG_MAX, flashfsLogCount());
+    EXPECT_EQ(logs, flashfsLogGet(FLASHFS_LOG_MAX - 1)->sequence);
+    for (int i = 0; i < FLASHFS_LOG_MAX; i++) {
+        const flashfsLog_t *log = flashfsLogGet(i);
+        EXPECT_EQ(64U, log->length);
+        expectLogMatches(i, log->sequence - 1);
+    }
+
+    // Logging carries on from where it was
+    logFlight(0, 1);
+    EXPECT_EQ(logs + 1, flashfsLogGet(FLASHFS_LOG_MAX - 1)->sequence);
+}
+
+// Slots in use in an index sector, counted on the device
+static int simIndexRecords(int sector)
+{
+    int count = 0;
+    for (int slot = 0; slot < SIM_SECTOR_SIZE / 16; slot++) {
+        count += simFlash[sector * SIM_SECTOR_SIZE + slot * 16] != 0xFF;
+    }
+
+    return count;
+}
+
+// Log and delete until the index in the given sector has no slot left, a flight writes at most three records
+static void fillIndex(int sector)
+{
+    const int slots = SIM_SECTOR_SIZE / 16;
+    int flights = 0;
+
+    while (simIndexRecords(sector) < slots - 3) {
+        logFlight(flights++, 1);
+        idle(2);
+    }
+    while (simIndexRecords(sector) < slots) {
+        flashfsLogDelete(flashfsLogGet(0)->sequence);
+        idle(1);
+    }
+}
+
+TEST(FlashfsLogTest, ChangesWhileTheIndexIsRewrittenAreKept)
+{
+    simReset(true);
+    idle(2000);
+
+    // Formatting put the index in the second sector
+    fillIndex(1);
+    ASSERT_EQ(1, simIndexEraseCount());
+
+    // The next change finds the index full, so the live state is written to the other sector
+    flashfsBeginLog();
+    idle(1);
+    ASSERT_EQ(2, simIndexEraseCount());
+
+    // One log dropped before the live state reaches it, and one after
+    const uint16_t early = flashfsLogGet(10)->sequence;
+    EXPECT_TRUE(flashfsLogDelete(early));
+    idle(620);
+    const uint16_t late = flashfsLogGet(0)->sequence;
+    EXPECT_TRUE(flashfsLogDelete(late));
+    idle(200);
+
+    const uint32_t written = writeFrames(50000, 20, 64, 250);
+    flashfsEndLog(true);
+    drain();
+    idle(10);
+    EXPECT_EQ(2, simIndexEraseCount());
+    EXPECT_EQ(0, simProgramWhileBusyCount);
+
+    const int count = flashfsLogCount();
+    flashfsLog_t logs[FLASHFS_LOG_MAX];
+    for (int i = 0; i < count; i++) {
+        logs[i] = *flashfsLogGet(i);
+    }
+
+    simRestart();
+
+    ASSERT_EQ(count, flashfsLogCount());
+    for (int i = 0; i < count; i++) {
+        const flashfsLog_t *log = flashfsLogGet(i);
+        EXPECT_NE(early, log->sequence);
+        EXPECT_NE(late, log->sequence);
+        EXPECT_EQ(logs[i].sequence, log->sequence);
+        EXPECT_EQ(logs[i].start, log->start);
+        EXPECT_EQ(logs[i].length, log->length);
+    }
+    EXPECT_EQ(written, flashfsLogGet(count - 1)->length);
+    expectLogMatches(count - 1, 50000);
+}
+
+TEST(FlashfsLogTest, PowerLossWhileTheIndexIsRewrittenKeepsTheFullIndex)
+{
+    simReset(true);
+    idle(2000);
+    fillIndex(1);
+
+    const int count = flashfsLogCount();
+    flashfsLog_t logs[FLASHFS_LOG_MAX];
+    for (int i = 0; i < count; i++) {
+        logs[i] = *flashfsLogGet(i);
+    }
+
+    // Power is lost with half the live state written to the other sector
+    EXPECT_TRUE(flashfsLogDelete(logs[0].sequence));
+    idle(600 + count / 2);
+    ASSERT_EQ(2, simIndexEraseCount());
+    ASSERT_GT(simIndexRecords(0), 0);
+
+    simRestart();
+
+    // The full index is still whole, short of the change that didn't fit in it
+    ASSERT_EQ(count, flashfsLogCount());
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(logs[i].sequence, flashfsLogGet(i)->sequence);
+        EXPECT_EQ(logs[i].start, flashfsLogGet(i)->start);
+        EXPECT_EQ(logs[i].length, flashfsLogGet(i)->length);
+    }
+
+    // And the next change goes through
+    EXPECT_TRUE(flashfsLogDelete(logs[0].sequence));
+    idle(1000);
+    simRestart();
+    ASSERT_EQ(count - 1, flashfsLogCount());
+    EXPECT_EQ(logs[1].sequence, flashfsLogGet(0)->sequence);
+}
+
+TEST(FlashfsLogTest, EraseOnlyFormatsTheIndex)
+{
+    simReset(true);
+    idle(2000);
+
+    logFlight(0, 50);
+    const int dataErases = simDataEraseCount();
+
+    flashfsEraseCompletely();
+    EXPECT_EQ(2, simIndexEraseCount());
+    EXPECT_EQ(dataErases, simDataEraseCount());
+    EXPECT_EQ(0, flashfsLogCount());
+
+    idle(2000);
+    simRestart();
+    EXPECT_EQ(0, flashfsLogCount());
+
+    // The data sectors are recycled as the ring comes around to them
+    logFlight(0, 50);
+    EXPECT_EQ(1, flashfsLogCount());
+    expectLogMatches(0, 0);
+    EXPECT_EQ(0, simProgramUnerasedCount);
+}
+
+// STUBS
+
+extern "C" {
+
+bool flashIsReady(void)
+{
+    return (int32_t)(simTimeUs - simBusyUntilUs) >= 0;
+}
+
+bool flashWaitForReady(uint32_t timeoutMillis)
+{
+    simWaitCount++;
+
+    if (!flashIsReady()) {
+        simTimeUs += MIN(simBusyUntilUs - simTimeUs, timeoutMillis * 1000);
+    }
+
+    return flashIsReady();
+}
+
+void flashEraseSector(uint32_t address)
+{
+    simEraseCount[address / SIM_SECTOR_SIZE]++;
+    memset(simFlash + address - address % SIM_SECTOR_SIZE, 0xFF, SIM_SECTOR_SIZE);
+    simBusyUntilUs = simTimeUs + SIM_SECTOR_ERASE_US;
+}
+
+void flashEraseCompletely(void)
+{
+    memset(simFlash, 0xFF, sizeof(simFlash));
+    simBusyUntilUs = simTimeUs + SIM_BULK_ERASE_US;
+}
+
+void flashPageProgram(uint32_t address, const uint8_t *data, int length)
+{
+    if (!flashIsReady()) {
+        simProgramWhileBusyCount++;
+    }
+    if (address / SIM_PAGE_SIZE != (address + length - 1) / SIM_PAGE_SIZE) {
+        simPageCrossingCount++;
+    }
+    if (length != SIM_PAGE_SIZE) {
+        simPartialProgramCount++;
+    }
+    if (address + length > SIM_TOTAL_SIZE) {
+        ADD_FAILURE() << "program past the end of the device at " << address;
+        return;
+    }
+
+    // Programming can only clear bits
+    for (int i = 0; i < length; i++) {
+        if ((simFlash[address + i] & data[i]) != data[i]) {
+            simProgramUnerasedCount++;
+        }
+        simFlash[address + i] &= data[i];
+    }
+
+    simProgramCount++;
+    simBusyUntilUs = simTimeUs + SIM_PROGRAM_US(length);
+}
+
+void flashPageProgramBegin(uint32_t) {}
+void flashPageProgramContinue(const uint8_t *, int) {}
+void flashPageProgramFinish(void) {}
+
+int flashReadBytes(uint32_t address, uint8_t *buffer, int length)
+{
+    // Like the drivers, wait for the device before reading
+    if (!flashIsReady()) {
+        simTimeUs = simBusyUntilUs;
+    }
+    memcpy(buffer, simFlash + address, length);
+
+    return length;
+}
+
+void flashFlush(void) {}
+
+const flashGeometry_t *flashGetGeometry(void)
+{
+    static const flashGeometry_t geometry = {
+        .sectors = SIM_SECTORS,
+        .pageSize = SIM_PAGE_SIZE,
+        .sectorSize = SIM_SECTOR_SIZE,
+        .totalSize = SIM_TOTAL_SIZE,
+        .pagesPerSector = SIM_PAGES_PER_SECTOR,
+        .flashType = FLASH_TYPE_NOR,
+    };
+
+    return &geometry;
+}
+
+}
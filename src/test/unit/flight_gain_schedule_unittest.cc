@@ -0,0 +1,122 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "fc/rc_controls.h"
+
+    #include "flight/gain_schedule.h"
+
+    #include "sensors/battery.h"
+
+    float rcCommand[4];
+    uint8_t simulatedCellCount;
+    uint16_t simulatedVoltage;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static const float throttlePoints[GAIN_SCHEDULE_THROTTLE_POINTS] = { 0.0f, 0.3f, 0.6f, 1.0f };
+static const float voltagePoints[GAIN_SCHEDULE_VBAT_POINTS] = { 3.3f, 3.7f, 4.2f };
+
+TEST(GainScheduleUnittest, TestInterpolateGridPoints)
+{
+    float table[GAIN_SCHEDULE_TABLE_SIZE];
+    for (int i = 0; i < GAIN_SCHEDULE_TABLE_SIZE; i++) {
+        table[i] = i;
+    }
+
+    for (int row = 0; row < GAIN_SCHEDULE_VBAT_POINTS; row++) {
+        for (int column = 0; column < GAIN_SCHEDULE_THROTTLE_POINTS; column++) {
+            EXPECT_FLOAT_EQ(row * GAIN_SCHEDULE_THROTTLE_POINTS + column,
+                gainScheduleInterpolate(table, throttlePoints, voltagePoints, throttlePoints[column], voltagePoints[row]));
+        }
+    }
+}
+
+TEST(GainScheduleUnittest, TestInterpolateBilinear)
+{
+    float table[GAIN_SCHEDULE_TABLE_SIZE];
+    for (int i = 0; i < GAIN_SCHEDULE_TABLE_SIZE; i++) {
+        table[i] = i;
+    }
+
+    // half way between all four corners of the first cell
+    EXPECT_FLOAT_EQ((0 + 1 + 4 + 5) / 4.0f, gainScheduleInterpolate(table, throttlePoints, voltagePoints, 0.15f, 3.5f));
+    // a quarter of the way along the throttle axis of the last segment, on the top row
+    EXPECT_FLOAT_EQ(10.25f, gainScheduleInterpolate(table, throttlePoints, voltagePoints, 0.7f, 4.2f));
+}
+
+TEST(GainScheduleUnittest, TestInterpolateClamps)
+{
+    float table[GAIN_SCHEDULE_TABLE_SIZE];
+    for (int i = 0; i < GAIN_SCHEDULE_TABLE_SIZE; i++) {
+        table[i] = i;
+    }
+
+    EXPECT_FLOAT_EQ(0.0f, gainScheduleInterpolate(table, throttlePoints, voltagePoints, -0.5f, 2.0f));
+    EXPECT_FLOAT_EQ(GAIN_SCHEDULE_TABLE_SIZE - 1, gainScheduleInterpolate(table, throttlePoints, voltagePoints, 1.5f, 5.0f));
+}
+
+TEST(GainScheduleUnittest, TestUpdate)
+{
+    pgResetAll();
+    gainScheduleInit();
+
+    // disabled schedule leaves every term at unity
+    gainScheduleUpdate();
+    for (int term = 0; term < GAIN_SCHEDULE_TERM_COUNT; term++) {
+        EXPECT_FLOAT_EQ(1.0f, gainScheduleGetMultiplier((gainScheduleTerm_e)term));
+    }
+
+    // boost P on an empty pack at low throttle
+    gainScheduleConfigMutable()->enabled = true;
+    gainScheduleConfigMutable()->gain[GAIN_SCHEDULE_P][0] = 150;
+    gainScheduleInit();
+
+    rcCommand[THROTTLE] = 1000;
+    simulatedCellCount = 4;
+    simulatedVoltage = 132; // 3.3V per cell
+    gainScheduleUpdate();
+    EXPECT_FLOAT_EQ(1.5f, gainScheduleGetMultiplier(GAIN_SCHEDULE_P));
+    EXPECT_FLOAT_EQ(1.0f, gainScheduleGetMultiplier(GAIN_SCHEDULE_I));
+
+    rcCommand[THROTTLE] = 1150; // half way to the second throttle point
+    gainScheduleUpdate();
+    EXPECT_FLOAT_EQ(1.25f, gainScheduleGetMultiplier(GAIN_SCHEDULE_P));
+
+    // without a battery the full pack row is used
+    simulatedCellCount = 0;
+    gainScheduleUpdate();
+    EXPECT_FLOAT_EQ(1.0f, gainScheduleGetMultiplier(GAIN_SCHEDULE_P));
+}
+
+// STUBS
+extern "C" {
+    uint8_t getBatteryCellCount(void) { return simulatedCellCount; }
+    uint16_t getBatteryVoltage(void) { return simulatedVoltage; }
+}
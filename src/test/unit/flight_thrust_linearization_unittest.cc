@@ -0,0 +1,127 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <math.h>
+#include <time.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "flight/thrust_linearization.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// thrust model used to build the table, see thrust_linearization.c
+static float thrustCurve(float motorOutput, float a)
+{
+    return (1.0f - a) * motorOutput + a * motorOutput * motorOutput;
+}
+
+TEST(ThrustLinearizationUnittest, TestDisabledIsIdentity)
+{
+    thrustLinearizationLut_t lut;
+    thrustLinearizationLutInit(&lut, 0);
+
+    EXPECT_FALSE(lut.enabled);
+    for (int i = 0; i <= 100; i++) {
+        const float thrust = i / 100.0f;
+        EXPECT_NEAR(thrust, thrustLinearizationLutApply(&lut, thrust), 1e-6f);
+    }
+}
+
+TEST(ThrustLinearizationUnittest, TestEndPoints)
+{
+    thrustLinearizationLut_t lut;
+    for (int percent = 0; percent <= 100; percent += 10) {
+        thrustLinearizationLutInit(&lut, percent);
+        EXPECT_FLOAT_EQ(0.0f, thrustLinearizationLutApply(&lut, 0.0f));
+        EXPECT_FLOAT_EQ(1.0f, thrustLinearizationLutApply(&lut, 1.0f));
+
+        // out of range values are passed through for the mixer to clip
+        EXPECT_FLOAT_EQ(-0.2f, thrustLinearizationLutApply(&lut, -0.2f));
+        EXPECT_FLOAT_EQ(1.3f, thrustLinearizationLutApply(&lut, 1.3f));
+    }
+}
+
+TEST(ThrustLinearizationUnittest, TestMonotonic)
+{
+    thrustLinearizationLut_t lut;
+    for (int percent = 0; percent <= 100; percent++) {
+        thrustLinearizationLutInit(&lut, percent);
+
+        for (int i = 0; i < THRUST_LINEARIZATION_LUT_SEGMENTS; i++) {
+            EXPECT_LT(lut.motorOutput[i], lut.motorOutput[i + 1]);
+        }
+
+        float previous = thrustLinearizationLutApply(&lut, 0.0f);
+        for (int i = 1; i <= 1000; i++) {
+            const float output = thrustLinearizationLutApply(&lut, i / 1000.0f);
+            EXPECT_GE(output, previous);
+            previous = output;
+        }
+    }
+}
+
+TEST(ThrustLinearizationUnittest, TestLinearisesThrust)
+{
+    thrustLinearizationLut_t lut;
+    for (int percent = 10; percent <= 90; percent += 10) {
+        const float a = percent / 100.0f;
+        thrustLinearizationLutInit(&lut, percent);
+
+        // the commanded thrust fraction should come out of the props, within the table resolution
+        for (int i = 0; i <= 100; i++) {
+            const float thrust = i / 100.0f;
+            EXPECT_NEAR(thrust, thrustCurve(thrustLinearizationLutApply(&lut, thrust), a), 0.005f);
+        }
+
+        // low thrust needs more command than a linear mapping would give
+        EXPECT_GT(thrustLinearizationLutApply(&lut, 0.25f), 0.25f);
+    }
+}
+
+TEST(ThrustLinearizationUnittest, TestBenchmark)
+{
+    const int iterations = 1000000;
+    const float a = 0.6f;
+    thrustLinearizationLut_t lut;
+    thrustLinearizationLutInit(&lut, 60);
+
+    volatile float sink = 0;
+
+    clock_t start = clock();
+    for (int i = 0; i < iterations; i++) {
+        sink = thrustLinearizationLutApply(&lut, (i & 1023) / 1024.0f);
+    }
+    const double lutNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / iterations;
+
+    start = clock();
+    for (int i = 0; i < iterations; i++) {
+        const float thrust = (i & 1023) / 1024.0f;
+        sink = (sqrtf((1.0f - a) * (1.0f - a) + 4.0f * a * thrust) - (1.0f - a)) / (2.0f * a);
+    }
+    const double directNs = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / iterations;
+
+    UNUSED(sink);
+    printf("thrust linearisation: lut %.2f ns/sample, direct %.2f ns/sample\n", lutNs, directNs);
+}
@@ -0,0 +1,172 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/lzss.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static lzssEncoder_t encoder;
+static lzssDecoder_t decoder;
+static std::vector<std::vector<uint8_t>> blocks;
+
+static void writeBlock(void *arg, const uint8_t *data, int count)
+{
+    UNUSED(arg);
+
+    EXPECT_LE(count, LZSS_BLOCK_SIZE);
+    blocks.push_back(std::vector<uint8_t>(data, data + count));
+}
+
+static void encode(const std::string &input, size_t chunkSize)
+{
+    for (size_t i = 0; i < input.size(); i += chunkSize) {
+        const size_t length = std::min(chunkSize, input.size() - i);
+        lzssEncoderAppend(&encoder, (const uint8_t *)input.data() + i, length);
+    }
+}
+
+static std::string decodeBlocks(void)
+{
+    std::string output;
+    for (const std::vector<uint8_t> &block : blocks) {
+        lzssDecoderSetBlock(&decoder, block.data(), block.size());
+        int c;
+        while ((c = lzssDecoderGet(&decoder)) >= 0) {
+            output += (char)c;
+        }
+    }
+    return output;
+}
+
+static size_t compressedSize(void)
+{
+    size_t size = 0;
+    for (const std::vector<uint8_t> &block : blocks) {
+        size += block.size();
+    }
+    return size;
+}
+
+static std::string dumpLikeText(void)
+{
+    std::string text;
+    for (int profile = 0; profile < 3; profile++) {
+        text += "\r\n# profile\r\nprofile " + std::to_string(profile) + "\r\n\r\n";
+        for (int i = 0; i < 80; i++) {
+            text += "set p_axis_" + std::to_string(i % 7) + "_value_" + std::to_string(i) + " = " + std::to_string(i * 37 % 500) + "\r\n";
+        }
+    }
+    return text;
+}
+
+class LzssTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        blocks.clear();
+        lzssEncoderInit(&encoder, writeBlock, NULL);
+        lzssDecoderInit(&decoder);
+    }
+};
+
+TEST_F(LzssTest, TestRoundTripText)
+{
+    const std::string input = dumpLikeText();
+
+    // the CLI hands over a few bytes at a time
+    encode(input, 7);
+    lzssEncoderFlush(&encoder);
+
+    EXPECT_EQ(input, decodeBlocks());
+    EXPECT_GT(input.size(), 2 * compressedSize());
+}
+
+TEST_F(LzssTest, TestRoundTripBinary)
+{
+    std::string input;
+    uint32_t seed = 12345;
+    for (int i = 0; i < 3 * LZSS_WINDOW_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        input += (char)(seed >> 16);
+    }
+
+    encode(input, 100);
+    lzssEncoderFlush(&encoder);
+
+    EXPECT_EQ(input, decodeBlocks());
+    // incompressible data costs a flag byte per eight literals
+    EXPECT_LE(compressedSize(), input.size() + input.size() / 8 + blocks.size());
+}
+
+TEST_F(LzssTest, TestLongRun)
+{
+    // matches overlapping the bytes they produce
+    const std::string input(5000, 'a');
+
+    encode(input, 1);
+    lzssEncoderFlush(&encoder);
+
+    EXPECT_EQ(input, decodeBlocks());
+    EXPECT_LT(compressedSize(), input.size() / 10);
+}
+
+TEST_F(LzssTest, TestFlushMidStream)
+{
+    const std::string input = dumpLikeText();
+    const size_t half = input.size() / 2;
+
+    encode(input.substr(0, half), 13);
+    lzssEncoderFlush(&encoder);
+    const size_t blocksAtFlush = blocks.size();
+    EXPECT_EQ(input.substr(0, half), decodeBlocks());
+
+    // history from before the flush is still used
+    encode(input.substr(half), 13);
+    lzssEncoderFlush(&encoder);
+
+    std::vector<std::vector<uint8_t>> laterBlocks(blocks.begin() + blocksAtFlush, blocks.end());
+    blocks = laterBlocks;
+    EXPECT_EQ(input.substr(half), decodeBlocks());
+}
+
+TEST_F(LzssTest, TestEmptyFlush)
+{
+    lzssEncoderFlush(&encoder);
+
+    EXPECT_EQ(0u, blocks.size());
+}
+
+TEST_F(LzssTest, TestTruncatedBlock)
+{
+    // a flag byte announcing a match, with only one byte of it present
+    const uint8_t block[] = { 0x01, 0x20 };
+
+    lzssDecoderSetBlock(&decoder, block, sizeof(block));
+    EXPECT_EQ(-1, lzssDecoderGet(&decoder));
+    EXPECT_EQ(-1, lzssDecoderGet(&decoder));
+}
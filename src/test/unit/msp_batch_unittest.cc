@@ -0,0 +1,217 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+    #include "common/time.h"
+
+    #include "interface/msp_batch.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define BATCH_CMD           0x3005
+#define CMD_ECHO            1       // replies with its payload
+#define CMD_ERROR           2
+#define CMD_NO_REPLY        3
+#define CMD_POST_PROCESS    4
+#define CMD_LONG            5       // replies with MSP_BATCH_REPLY_SIZE_MAX bytes
+#define CMD_SLOW            6       // takes 300us
+
+typedef struct {
+    uint16_t cmd;
+    int8_t result;
+    std::vector<uint8_t> payload;
+} batchReply_t;
+
+static timeUs_t simTimeUs;
+static std::vector<uint16_t> processed;
+
+static void fakePostProcess(struct serialPort_s *port)
+{
+    UNUSED(port);
+}
+
+static mspResult_e fakeProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    processed.push_back(cmd->cmd);
+    switch (cmd->cmd) {
+    case CMD_ECHO:
+        while (sbufBytesRemaining(&cmd->buf)) {
+            sbufWriteU8(&reply->buf, sbufReadU8(&cmd->buf));
+        }
+        return MSP_RESULT_ACK;
+    case CMD_NO_REPLY:
+        return MSP_RESULT_NO_REPLY;
+    case CMD_POST_PROCESS:
+        *mspPostProcessFn = fakePostProcess;
+        return MSP_RESULT_ACK;
+    case CMD_LONG:
+        for (int i = 0; i < MSP_BATCH_REPLY_SIZE_MAX; i++) {
+            sbufWriteU8(&reply->buf, i);
+        }
+        return MSP_RESULT_ACK;
+    case CMD_SLOW:
+        simTimeUs += 300;
+        return MSP_RESULT_ACK;
+    default:
+        return MSP_RESULT_ERROR;
+    }
+}
+
+class MspBatchTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        simTimeUs = 0;
+        processed.clear();
+        request.clear();
+        replyCount = 0;
+        replies.clear();
+        postProcessFn = NULL;
+    }
+
+    void add(uint16_t cmd, std::vector<uint8_t> payload = std::vector<uint8_t>()) {
+        request.push_back(cmd & 0xff);
+        request.push_back(cmd >> 8);
+        request.push_back(payload.size() & 0xff);
+        request.push_back(payload.size() >> 8);
+        request.insert(request.end(), payload.begin(), payload.end());
+    }
+
+    mspResult_e run(timeUs_t deadlineUs = 1000, int replySize = 1024) {
+        std::vector<uint8_t> replyBuffer(replySize);
+        sbuf_t src = { .ptr = request.data(), .end = request.data() + request.size() };
+        sbuf_t dst = { .ptr = replyBuffer.data(), .end = replyBuffer.data() + replySize };
+
+        const mspResult_e result = mspBatchProcess(BATCH_CMD, &src, &dst, fakeProcessCommand, deadlineUs, &postProcessFn);
+
+        sbuf_t reply = { .ptr = replyBuffer.data(), .end = dst.ptr };
+        replyCount = sbufReadU16(&reply);
+        while (sbufBytesRemaining(&reply)) {
+            batchReply_t r;
+            r.cmd = sbufReadU16(&reply);
+            r.result = sbufReadU8(&reply);
+            const uint16_t size = sbufReadU16(&reply);
+            EXPECT_GE(sbufBytesRemaining(&reply), size);
+            r.payload.assign(sbufPtr(&reply), sbufPtr(&reply) + size);
+            sbufAdvance(&reply, size);
+            replies.push_back(r);
+        }
+        EXPECT_EQ(replyCount, replies.size());
+        return result;
+    }
+
+    std::vector<uint8_t> request;
+    uint16_t replyCount;
+    std::vector<batchReply_t> replies;
+    mspPostProcessFnPtr postProcessFn;
+};
+
+TEST_F(MspBatchTest, RunsEveryCommand)
+{
+    add(CMD_ECHO, {1, 2, 3});
+    add(CMD_ERROR);
+    add(CMD_NO_REPLY);
+    add(CMD_ECHO);
+    add(BATCH_CMD);
+
+    EXPECT_EQ(MSP_RESULT_ACK, run());
+    ASSERT_EQ(5, replyCount);
+
+    EXPECT_EQ(CMD_ECHO, replies[0].cmd);
+    EXPECT_EQ(MSP_RESULT_ACK, replies[0].result);
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3}), replies[0].payload);
+    EXPECT_EQ(MSP_RESULT_ERROR, replies[1].result);
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, replies[2].result);
+    EXPECT_EQ(0, replies[2].payload.size());
+    EXPECT_EQ(MSP_RESULT_ACK, replies[3].result);
+    EXPECT_EQ(0, replies[3].payload.size());
+
+    // Nested batches are refused without running them
+    EXPECT_EQ(BATCH_CMD, replies[4].cmd);
+    EXPECT_EQ(MSP_RESULT_ERROR, replies[4].result);
+    EXPECT_EQ(4, processed.size());
+    EXPECT_EQ(NULL, postProcessFn);
+}
+
+TEST_F(MspBatchTest, StopsAtDeadline)
+{
+    for (int i = 0; i < 10; i++) {
+        add(CMD_SLOW);
+    }
+
+    EXPECT_EQ(MSP_RESULT_ACK, run(1000));
+    EXPECT_EQ(4, replyCount);
+
+    // A batch that starts past its deadline still runs one command
+    processed.clear();
+    replies.clear();
+    EXPECT_EQ(MSP_RESULT_ACK, run(0));
+    EXPECT_EQ(1, replyCount);
+    EXPECT_EQ(1, processed.size());
+}
+
+TEST_F(MspBatchTest, StopsWhenReplyIsFull)
+{
+    for (int i = 0; i < 10; i++) {
+        add(CMD_LONG);
+    }
+
+    EXPECT_EQ(MSP_RESULT_ACK, run(1000, 1024));
+    EXPECT_EQ(3, replyCount);
+    EXPECT_EQ(3, processed.size());
+    for (int i = 0; i < replyCount; i++) {
+        EXPECT_EQ(MSP_BATCH_REPLY_SIZE_MAX, replies[i].payload.size());
+    }
+}
+
+TEST_F(MspBatchTest, StopsAfterPostProcess)
+{
+    add(CMD_ECHO);
+    add(CMD_POST_PROCESS);
+    add(CMD_ECHO);
+
+    EXPECT_EQ(MSP_RESULT_ACK, run());
+    EXPECT_EQ(2, replyCount);
+    EXPECT_EQ(fakePostProcess, postProcessFn);
+}
+
+TEST_F(MspBatchTest, TruncatedRequest)
+{
+    add(CMD_ECHO, {1});
+    add(CMD_ECHO, {1, 2, 3, 4});
+    request.resize(request.size() - 2);
+
+    EXPECT_EQ(MSP_RESULT_ACK, run());
+    EXPECT_EQ(1, replyCount);
+    EXPECT_EQ(1, processed.size());
+}
+
+// STUBS
+
+extern "C" {
+    timeUs_t micros(void) { return simTimeUs; }
+}
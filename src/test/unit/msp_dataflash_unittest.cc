@@ -0,0 +1,270 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/huffman.h"
+    #include "common/streambuf.h"
+
+    #include "interface/msp_dataflash.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SIM_FLASH_SIZE (1024 * 1024)
+#define FRAME_BUFFER_SIZE (4096 + 16)
+
+static uint8_t simFlash[SIM_FLASH_SIZE];
+static int simFlashReadCount;
+
+static uint8_t frameBuffer[FRAME_BUFFER_SIZE];
+
+typedef struct {
+    mspResult_e result;
+    uint32_t address;
+    uint16_t uncompressedLength;
+    uint16_t payloadLength;
+    std::vector<uint8_t> data;
+} frame_t;
+
+static void simReset(void)
+{
+    // Small values with occasional large ones compress roughly like blackbox frames
+    uint32_t seed = 1;
+    for (int i = 0; i < SIM_FLASH_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        const uint8_t r = seed >> 16;
+        simFlash[i] = r < 200 ? (r & 0x07) : r;
+    }
+    simFlashReadCount = 0;
+}
+
+// Decode with the encoder's own table, codes are left aligned in 16 bits
+static std::vector<uint8_t> huffmanDecode(const uint8_t *buf, int bufLen, int count)
+{
+    static std::map<std::pair<int, uint16_t>, uint8_t> codes;
+    if (codes.empty()) {
+        for (int i = 0; i < 256; i++) {
+            codes[std::make_pair((int)huffmanTable[i].codeLen, (uint16_t)(huffmanTable[i].code >> (16 - huffmanTable[i].codeLen)))] = i;
+        }
+    }
+
+    std::vector<uint8_t> out;
+    uint16_t code = 0;
+    int codeLen = 0;
+    for (int bit = 0; bit < bufLen * 8 && (int)out.size() < count; bit++) {
+        code = (code << 1) | ((buf[bit / 8] >> (7 - bit % 8)) & 1);
+        codeLen++;
+        const auto it = codes.find(std::make_pair(codeLen, code));
+        if (it != codes.end()) {
+            out.push_back(it->second);
+            code = 0;
+            codeLen = 0;
+        }
+    }
+
+    return out;
+}
+
+static frame_t fill(int bufferSize = FRAME_BUFFER_SIZE)
+{
+    frame_t frame = {};
+    sbuf_t dst = { .ptr = frameBuffer, .end = frameBuffer + bufferSize };
+
+    frame.result = mspDataflashStreamFill(&dst);
+    if (frame.result != MSP_RESULT_ACK) {
+        EXPECT_EQ(frameBuffer, dst.ptr);
+        return frame;
+    }
+
+    EXPECT_GE(dst.end, dst.ptr);
+    sbuf_t src = { .ptr = frameBuffer, .end = dst.ptr };
+    frame.address = sbufReadU32(&src);
+    frame.payloadLength = sbufReadU16(&src);
+    const uint8_t compression = sbufReadU8(&src);
+    EXPECT_EQ(frame.payloadLength, sbufBytesRemaining(&src));
+
+    if (compression == HUFFMAN) {
+        frame.uncompressedLength = sbufReadU16(&src);
+        frame.data = huffmanDecode(sbufPtr(&src), sbufBytesRemaining(&src), frame.uncompressedLength);
+    } else {
+        EXPECT_EQ(NO_COMPRESSION, compression);
+        frame.uncompressedLength = frame.payloadLength;
+        frame.data.assign(sbufPtr(&src), src.end);
+    }
+    EXPECT_EQ(frame.uncompressedLength, frame.data.size());
+
+    return frame;
+}
+
+// Stream everything, acknowledging each frame as it arrives, and check the contents
+static int streamAll(uint32_t address, uint32_t length, uint32_t *payloadBytes)
+{
+    int frameCount = 0;
+    uint32_t expectedAddress = address;
+    *payloadBytes = 0;
+
+    while (true) {
+        const frame_t frame = fill();
+        EXPECT_EQ(MSP_RESULT_ACK, frame.result);
+        if (frame.result != MSP_RESULT_ACK) {
+            break;
+        }
+        EXPECT_EQ(expectedAddress, frame.address);
+        if (frame.uncompressedLength == 0) {
+            break;
+        }
+        EXPECT_EQ(0, memcmp(&simFlash[frame.address], frame.data.data(), frame.data.size()));
+
+        expectedAddress += frame.uncompressedLength;
+        *payloadBytes += frame.payloadLength;
+        frameCount++;
+        mspDataflashStreamAck(expectedAddress);
+    }
+
+    EXPECT_EQ(address + length, expectedAddress);
+    EXPECT_FALSE(mspDataflashStreamIsActive());
+    EXPECT_EQ(MSP_RESULT_ERROR, fill().result);
+
+    return frameCount;
+}
+
+TEST(MspDataflashTest, StreamSendsFullFramesFromBulkReads)
+{
+    simReset();
+
+    EXPECT_EQ(SIM_FLASH_SIZE, mspDataflashStreamStart(0, SIM_FLASH_SIZE, 4096, 16384, 0));
+
+    uint32_t payloadBytes;
+    const int frameCount = streamAll(0, SIM_FLASH_SIZE, &payloadBytes);
+
+    // One read per frame, and each frame as large as the host allows
+    EXPECT_EQ(SIM_FLASH_SIZE / 4096, frameCount);
+    EXPECT_EQ(frameCount, simFlashReadCount);
+    EXPECT_EQ((uint32_t)SIM_FLASH_SIZE, payloadBytes);
+}
+
+TEST(MspDataflashTest, CompressedStreamDecodesToTheFlashContents)
+{
+    simReset();
+
+    EXPECT_EQ(SIM_FLASH_SIZE / 2, mspDataflashStreamStart(SIM_FLASH_SIZE / 4, SIM_FLASH_SIZE / 2, 4096, 16384, MSP_DATAFLASH_STREAM_FLAG_COMPRESS));
+
+    uint32_t payloadBytes;
+    const int frameCount = streamAll(SIM_FLASH_SIZE / 4, SIM_FLASH_SIZE / 2, &payloadBytes);
+
+    // Fewer frames than uncompressed, and each byte is read from the flash once
+    EXPECT_LT(payloadBytes, (uint32_t)SIM_FLASH_SIZE / 2 * 3 / 4);
+    EXPECT_LT(frameCount, SIM_FLASH_SIZE / 2 / 4096 * 3 / 4);
+    EXPECT_LE(simFlashReadCount, SIM_FLASH_SIZE / 2 / MSP_DATAFLASH_STREAM_READAHEAD_SIZE + frameCount);
+}
+
+TEST(MspDataflashTest, WindowLimitsUnacknowledgedBytes)
+{
+    simReset();
+
+    mspDataflashStreamStart(0, SIM_FLASH_SIZE, 1000, 2500, 0);
+
+    // 2500 bytes go out unacknowledged, then the stream waits
+    EXPECT_EQ(1000, fill().uncompressedLength);
+    EXPECT_EQ(1000, fill().uncompressedLength);
+    EXPECT_EQ(500, fill().uncompressedLength);
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill().result);
+
+    // Stale and bogus acks are ignored
+    mspDataflashStreamAck(0);
+    mspDataflashStreamAck(10000);
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill().result);
+
+    mspDataflashStreamAck(1000);
+    const frame_t frame = fill();
+    EXPECT_EQ(2500U, frame.address);
+    EXPECT_EQ(1000, frame.uncompressedLength);
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill().result);
+}
+
+TEST(MspDataflashTest, FramesShrinkToFitTheTransmitBuffer)
+{
+    simReset();
+
+    mspDataflashStreamStart(0, SIM_FLASH_SIZE, 0, 0, MSP_DATAFLASH_STREAM_FLAG_COMPRESS);
+
+    // Too small for a useful frame
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill(MSP_DATAFLASH_STREAM_MIN_FRAME_SIZE).result);
+
+    frame_t frame = fill(300);
+    EXPECT_EQ(0U, frame.address);
+    EXPECT_LE(frame.payloadLength, 300 - 7);
+    EXPECT_GT(frame.uncompressedLength, 300);
+    EXPECT_EQ(0, memcmp(simFlash, frame.data.data(), frame.data.size()));
+
+    const uint32_t nextAddress = frame.uncompressedLength;
+    frame = fill();
+    EXPECT_EQ(nextAddress, frame.address);
+    EXPECT_EQ(0, memcmp(&simFlash[nextAddress], frame.data.data(), frame.data.size()));
+}
+
+TEST(MspDataflashTest, RestartResumesFromTheRequestedAddress)
+{
+    simReset();
+
+    mspDataflashStreamStart(0, SIM_FLASH_SIZE, 4096, 0, 0);
+    fill();
+    fill();
+
+    // The host lost the second frame and resumes after the first, up to the end of the volume
+    EXPECT_EQ(SIM_FLASH_SIZE - 4096U, mspDataflashStreamStart(4096, UINT32_MAX, 4096, 8192, 0));
+    const frame_t frame = fill();
+    EXPECT_EQ(4096U, frame.address);
+    EXPECT_EQ(0, memcmp(&simFlash[4096], frame.data.data(), frame.data.size()));
+
+    // A zero length stops the stream
+    EXPECT_EQ(0U, mspDataflashStreamStart(0, 0, 0, 0, 0));
+    EXPECT_EQ(MSP_RESULT_ERROR, fill().result);
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t flashfsGetReadableSize(void)
+{
+    return SIM_FLASH_SIZE;
+}
+
+int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
+{
+    if (address + len > SIM_FLASH_SIZE) {
+        len = SIM_FLASH_SIZE - address;
+    }
+    memcpy(buffer, &simFlash[address], len);
+    simFlashReadCount++;
+
+    return len;
+}
+
+}
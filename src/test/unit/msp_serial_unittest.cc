@@ -0,0 +1,357 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+
+    #include "drivers/serial.h"
+
+    #include "io/serial.h"
+
+    #include "msp/msp_serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    PG_REGISTER(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_TX_BUFFER_SIZE_MAX 512
+#define TEST_RX_BUFFER_SIZE 64
+
+#define TEST_CMD 100
+
+static uint8_t txStorage[TEST_TX_BUFFER_SIZE_MAX];
+static uint8_t rxStorage[TEST_RX_BUFFER_SIZE];
+static serialPort_t testPort;
+static int serialWriteCount;
+static int commitTxCount;
+static int replyLength;
+
+static void testSerialWrite(serialPort_t *instance, uint8_t ch)
+{
+    instance->txBuffer[instance->txBufferHead] = ch;
+    instance->txBufferHead = (instance->txBufferHead + 1) % instance->txBufferSize;
+    serialWriteCount++;
+}
+
+static uint32_t testTotalRxWaiting(const serialPort_t *instance)
+{
+    return (instance->rxBufferHead - instance->rxBufferTail) % instance->rxBufferSize;
+}
+
+static uint32_t testTotalTxFree(const serialPort_t *instance)
+{
+    const uint32_t used = (instance->txBufferHead - instance->txBufferTail + instance->txBufferSize) % instance->txBufferSize;
+    return instance->txBufferSize - 1 - used;
+}
+
+static uint8_t testSerialRead(serialPort_t *instance)
+{
+    const uint8_t ch = instance->rxBuffer[instance->rxBufferTail];
+    instance->rxBufferTail = (instance->rxBufferTail + 1) % instance->rxBufferSize;
+    return ch;
+}
+
+static bool testIsTransmitBufferEmpty(const serialPort_t *instance)
+{
+    return instance->txBufferHead == instance->txBufferTail;
+}
+
+// Same as the UART driver
+static void testCommitTx(serialPort_t *instance, int count)
+{
+    const uint32_t head = instance->txBufferHead + count;
+    instance->txBufferHead = head >= instance->txBufferSize ? head - instance->txBufferSize : head;
+    commitTxCount++;
+}
+
+static const struct serialPortVTable testVTable = {
+    .serialWrite = testSerialWrite,
+    .serialTotalRxWaiting = testTotalRxWaiting,
+    .serialTotalTxFree = testTotalTxFree,
+    .serialRead = testSerialRead,
+    .serialSetBaudRate = NULL,
+    .isSerialTransmitBufferEmpty = testIsTransmitBufferEmpty,
+    .setMode = NULL,
+    .setCtrlLineStateCb = NULL,
+    .setBaudRateCb = NULL,
+    .writeBuf = NULL,
+    .beginWrite = NULL,
+    .endWrite = NULL,
+    .commitTx = testCommitTx,
+};
+
+static const struct serialPortVTable testVTableNoCommit = {
+    .serialWrite = testSerialWrite,
+    .serialTotalRxWaiting = testTotalRxWaiting,
+    .serialTotalTxFree = testTotalTxFree,
+    .serialRead = testSerialRead,
+    .serialSetBaudRate = NULL,
+    .isSerialTransmitBufferEmpty = testIsTransmitBufferEmpty,
+    .setMode = NULL,
+    .setCtrlLineStateCb = NULL,
+    .setBaudRateCb = NULL,
+    .writeBuf = NULL,
+    .beginWrite = NULL,
+    .endWrite = NULL,
+    .commitTx = NULL,
+};
+
+// An empty port whose transmit buffer starts at txStart
+static void resetTestPort(uint32_t txBufferSize, uint32_t txStart)
+{
+    memset(&testPort, 0, sizeof(testPort));
+    memset(txStorage, 0, sizeof(txStorage));
+    testPort.vTable = &testVTable;
+    testPort.txBufferSize = txBufferSize;
+    testPort.txBuffer = txStorage;
+    testPort.txBufferHead = txStart;
+    testPort.txBufferTail = txStart;
+    testPort.rxBufferSize = TEST_RX_BUFFER_SIZE;
+    testPort.rxBuffer = rxStorage;
+    serialWriteCount = 0;
+    commitTxCount = 0;
+}
+
+// Everything written since the transmit buffer was last drained, unwrapped
+static std::vector<uint8_t> drainTx(void)
+{
+    std::vector<uint8_t> out;
+    while (testPort.txBufferTail != testPort.txBufferHead) {
+        out.push_back(txStorage[testPort.txBufferTail]);
+        testPort.txBufferTail = (testPort.txBufferTail + 1) % testPort.txBufferSize;
+    }
+    return out;
+}
+
+static void receiveMspV1Command(uint8_t cmd)
+{
+    const uint8_t request[] = { '$', 'M', '<', 0, cmd, cmd };
+    for (unsigned i = 0; i < sizeof(request); i++) {
+        testPort.rxBuffer[testPort.rxBufferHead] = request[i];
+        testPort.rxBufferHead = (testPort.rxBufferHead + 1) % testPort.rxBufferSize;
+    }
+}
+
+// Replies with replyLength bytes counting up from 0
+static mspResult_e testProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(mspPostProcessFn);
+
+    reply->cmd = cmd->cmd;
+    for (int i = 0; i < replyLength; i++) {
+        sbufWriteU8(&reply->buf, i);
+    }
+    return MSP_RESULT_ACK;
+}
+
+static void testProcessReply(mspPacket_t *cmd)
+{
+    UNUSED(cmd);
+}
+
+static void expectMspV1Reply(const std::vector<uint8_t> &frame, int dataLen)
+{
+    const bool jumbo = dataLen >= 255;
+    const int hdrLen = jumbo ? 7 : 5;
+    ASSERT_EQ(hdrLen + dataLen + 1, (int)frame.size());
+
+    EXPECT_EQ('$', frame[0]);
+    EXPECT_EQ('M', frame[1]);
+    EXPECT_EQ('>', frame[2]);
+    EXPECT_EQ(jumbo ? 255 : dataLen, frame[3]);
+    EXPECT_EQ(TEST_CMD, frame[4]);
+    if (jumbo) {
+        EXPECT_EQ(dataLen & 0xff, frame[5]);
+        EXPECT_EQ(dataLen >> 8, frame[6]);
+    }
+
+    uint8_t checksum = 0;
+    for (int i = 3; i < hdrLen; i++) {
+        checksum ^= frame[i];
+    }
+    for (int i = 0; i < dataLen; i++) {
+        EXPECT_EQ(i & 0xff, frame[hdrLen + i]);
+        checksum ^= frame[hdrLen + i];
+    }
+    EXPECT_EQ(checksum, frame[hdrLen + dataLen]);
+}
+
+static void processReply(int dataLen)
+{
+    replyLength = dataLen;
+    receiveMspV1Command(TEST_CMD);
+    mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand, testProcessReply);
+}
+
+TEST(MspSerialTest, TestReserveTxStopsAtWrap)
+{
+    int count;
+
+    // An empty buffer at the start keeps one byte back so full is not mistaken for empty
+    resetTestPort(256, 0);
+    EXPECT_EQ(&txStorage[0], serialReserveTx(&testPort, &count));
+    EXPECT_EQ(255, count);
+
+    // Head ahead of a non zero tail, the space runs to the end of the buffer
+    testPort.txBufferTail = 10;
+    testPort.txBufferHead = 200;
+    EXPECT_EQ(&txStorage[200], serialReserveTx(&testPort, &count));
+    EXPECT_EQ(56, count);
+
+    // Head behind the tail after a wrap, the space stops one byte short of the tail
+    testPort.txBufferTail = 100;
+    testPort.txBufferHead = 40;
+    EXPECT_EQ(&txStorage[40], serialReserveTx(&testPort, &count));
+    EXPECT_EQ(59, count);
+
+    // A port that can not commit is never written in place
+    testPort.vTable = &testVTableNoCommit;
+    EXPECT_EQ(NULL, serialReserveTx(&testPort, &count));
+    EXPECT_EQ(0, count);
+}
+
+TEST(MspSerialTest, TestCommitTxWrapsHead)
+{
+    int count;
+
+    resetTestPort(256, 250);
+    serialReserveTx(&testPort, &count);
+    EXPECT_EQ(6, count);
+
+    serialCommitTx(&testPort, 6);
+    EXPECT_EQ(0u, testPort.txBufferHead);
+    EXPECT_EQ(249u, serialTxBytesFree(&testPort));
+    EXPECT_EQ(6u, drainTx().size());
+}
+
+TEST(MspSerialTest, TestReplyCopiedInPlace)
+{
+    // A UART sized buffer can not hold the longest reply, the reply is still copied in place once its size is known
+    resetTestPort(256, 0);
+    mspSerialInit();
+
+    processReply(20);
+
+    EXPECT_EQ(1, commitTxCount);
+    EXPECT_EQ(0, serialWriteCount);
+    expectMspV1Reply(drainTx(), 20);
+}
+
+TEST(MspSerialTest, TestReplyFallsBackAtWrap)
+{
+    // Too little room before the buffer wraps, the frame is written a byte at a time around the wrap
+    resetTestPort(256, 240);
+    mspSerialInit();
+
+    processReply(20);
+
+    EXPECT_EQ(0, commitTxCount);
+    EXPECT_EQ(26, serialWriteCount);
+    EXPECT_EQ(10u, testPort.txBufferHead);
+    expectMspV1Reply(drainTx(), 20);
+}
+
+TEST(MspSerialTest, TestJumboReplyBuiltInPlace)
+{
+    // Room for the longest reply, it is built in place and moved up for the jumbo header
+    resetTestPort(TEST_TX_BUFFER_SIZE_MAX, 0);
+    mspSerialInit();
+
+    processReply(MSP_PORT_REPLY_SIZE_MAX);
+
+    EXPECT_EQ(1, commitTxCount);
+    EXPECT_EQ(0, serialWriteCount);
+    expectMspV1Reply(drainTx(), MSP_PORT_REPLY_SIZE_MAX);
+
+    // A short reply in the same buffer needs no move
+    processReply(20);
+
+    EXPECT_EQ(2, commitTxCount);
+    EXPECT_EQ(0, serialWriteCount);
+    expectMspV1Reply(drainTx(), 20);
+}
+
+// STUBS
+
+extern "C" {
+const uint32_t baudRates[] = { 0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000 };
+
+static serialPortConfig_t testPortConfig;
+
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function)
+{
+    UNUSED(function);
+    return &testPortConfig;
+}
+
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function)
+{
+    UNUSED(function);
+    return NULL;
+}
+
+serialPort_t *openSerialPort(serialPortIdentifier_e identifier, serialPortFunction_e function, serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData, uint32_t baudRate, portMode_e mode, portOptions_e options)
+{
+    UNUSED(identifier);
+    UNUSED(function);
+    UNUSED(rxCallback);
+    UNUSED(rxCallbackData);
+    UNUSED(baudRate);
+    UNUSED(mode);
+    UNUSED(options);
+    return &testPort;
+}
+
+void closeSerialPort(serialPort_t *serialPort)
+{
+    UNUSED(serialPort);
+}
+
+bool isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction)
+{
+    UNUSED(portConfig);
+    UNUSED(functionMask);
+    UNUSED(sharedWithFunction);
+    return false;
+}
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort)
+{
+    UNUSED(serialPort);
+}
+
+void systemResetToBootloader(void) {}
+
+timeMs_t millis(void)
+{
+    return 0;
+}
+}
@@ -0,0 +1,232 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/streambuf.h"
+
+    #include "interface/msp_setting.h"
+    #include "interface/settings.h"
+
+    #include "sensors/current.h"
+    #include "sensors/voltage.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// settings of every group read from and write to this, at their offset
+static uint8_t settingData[1024];
+static const clivalue_t *setVar;
+static uint32_t setValue;
+
+static uint16_t indexOf(const char *name)
+{
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        if (strcmp(valueTable[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return 0xFFFF;
+}
+
+static std::vector<uint8_t> byName(const char *name)
+{
+    std::vector<uint8_t> request = { MSP_SETTING_BY_NAME & 0xFF, MSP_SETTING_BY_NAME >> 8 };
+    request.insert(request.end(), name, name + strlen(name) + 1);
+    return request;
+}
+
+static std::vector<uint8_t> byIndex(uint16_t index)
+{
+    return { (uint8_t)(index & 0xFF), (uint8_t)(index >> 8) };
+}
+
+static mspResult_e run(mspResult_e (*command)(sbuf_t *, sbuf_t *), std::vector<uint8_t> request, std::vector<uint8_t> &reply)
+{
+    uint8_t replyBuffer[64];
+    sbuf_t src;
+    sbuf_t dst;
+    sbufInit(&src, request.data(), request.data() + request.size());
+    sbufInit(&dst, replyBuffer, replyBuffer + sizeof(replyBuffer));
+
+    const mspResult_e result = command(&dst, &src);
+    reply.assign(replyBuffer, dst.ptr);
+    return result;
+}
+
+class MspSettingTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        memset(settingData, 0, sizeof(settingData));
+        setVar = NULL;
+        setValue = 0;
+    }
+};
+
+TEST_F(MspSettingTest, TestGetByName)
+{
+    const uint16_t index = indexOf("gyro_lowpass_hz");
+    *(uint16_t *)&settingData[valueTable[index].offset] = 1234;
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ACK, run(mspSettingGet, byName("GYRO_LOWPASS_HZ"), reply));
+
+    const std::vector<uint8_t> expected = {
+        (uint8_t)(index & 0xFF), (uint8_t)(index >> 8),
+        valueTable[index].type,
+        1,
+        1234 & 0xFF, 1234 >> 8
+    };
+    EXPECT_EQ(expected, reply);
+}
+
+TEST_F(MspSettingTest, TestGetByIndex)
+{
+    const uint16_t index = indexOf("acc_calibration");
+    int16_t *calibration = (int16_t *)&settingData[valueTable[index].offset];
+    calibration[0] = -1;
+    calibration[1] = 2;
+    calibration[2] = 300;
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ACK, run(mspSettingGet, byIndex(index), reply));
+
+    const std::vector<uint8_t> expected = {
+        (uint8_t)(index & 0xFF), (uint8_t)(index >> 8),
+        valueTable[index].type,
+        3,
+        0xFF, 0xFF, 2, 0, 300 & 0xFF, 300 >> 8
+    };
+    EXPECT_EQ(expected, reply);
+}
+
+TEST_F(MspSettingTest, TestGetBitset)
+{
+    const uint16_t index = indexOf("blackbox_disable_rc");
+    *(uint16_t *)&settingData[valueTable[index].offset] = 1 << valueTable[index].config.bitpos;
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ACK, run(mspSettingGet, byIndex(index), reply));
+    ASSERT_EQ(5u, reply.size());
+    EXPECT_EQ(1, reply[3]);
+    EXPECT_EQ(1, reply[4]);
+}
+
+TEST_F(MspSettingTest, TestGetUnknown)
+{
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingGet, byName("gyro_lowpass"), reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingGet, byName("no_such_setting"), reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingGet, byIndex(valueTableEntryCount), reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingGet, { 0x01 }, reply));
+}
+
+TEST_F(MspSettingTest, TestSetInRange)
+{
+    const uint16_t index = indexOf("mid_rc");
+    std::vector<uint8_t> request = byName("mid_rc");
+    request.push_back(1500 & 0xFF);
+    request.push_back(1500 >> 8);
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ACK, run(mspSettingSet, request, reply));
+    EXPECT_EQ(byIndex(index), reply);
+    EXPECT_EQ(&valueTable[index], setVar);
+    EXPECT_EQ(1500u, setValue);
+}
+
+TEST_F(MspSettingTest, TestSetOutOfRange)
+{
+    // mid_rc is limited to 1200 to 1700
+    std::vector<uint8_t> request = byIndex(indexOf("mid_rc"));
+    request.push_back(1100 & 0xFF);
+    request.push_back(1100 >> 8);
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingSet, request, reply));
+    EXPECT_EQ(nullptr, setVar);
+
+    // a value short of the element size
+    request = byIndex(indexOf("mid_rc"));
+    request.push_back(0xDC);
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingSet, request, reply));
+    EXPECT_EQ(nullptr, setVar);
+}
+
+TEST_F(MspSettingTest, TestSetLookup)
+{
+    const uint16_t index = indexOf("yaw_motors_reversed");
+    std::vector<uint8_t> request = byIndex(index);
+    request.push_back(2);
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingSet, request, reply));
+    EXPECT_EQ(nullptr, setVar);
+
+    request.back() = 1;
+    EXPECT_EQ(MSP_RESULT_ACK, run(mspSettingSet, request, reply));
+    EXPECT_EQ(&valueTable[index], setVar);
+    EXPECT_EQ(1u, setValue);
+}
+
+TEST_F(MspSettingTest, TestSetArray)
+{
+    const uint16_t index = indexOf("acc_calibration");
+    std::vector<uint8_t> request = byName("acc_calibration");
+    const std::vector<uint8_t> values = { 0xFF, 0xFF, 2, 0, 300 & 0xFF, 300 >> 8 };
+    request.insert(request.end(), values.begin(), values.end() - 1);
+
+    std::vector<uint8_t> reply;
+    EXPECT_EQ(MSP_RESULT_ERROR, run(mspSettingSet, request, reply));
+
+    request.push_back(values.back());
+    EXPECT_EQ(MSP_RESULT_ACK, run(mspSettingSet, request, reply));
+    EXPECT_EQ(byIndex(index), reply);
+
+    const int16_t *calibration = (const int16_t *)&settingData[valueTable[index].offset];
+    EXPECT_EQ(-1, calibration[0]);
+    EXPECT_EQ(2, calibration[1]);
+    EXPECT_EQ(300, calibration[2]);
+}
+
+// STUBS
+extern "C" {
+const char * const debugModeNames[DEBUG_COUNT] = { "NONE" };
+const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { "NONE" };
+const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { "NONE" };
+
+void *cliGetValuePointer(const clivalue_t *value)
+{
+    return &settingData[value->offset];
+}
+
+void cliSetVar(const clivalue_t *var, const uint32_t value)
+{
+    setVar = var;
+    setValue = value;
+}
+}
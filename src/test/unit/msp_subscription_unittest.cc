@@ -0,0 +1,212 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <map>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+    #include "common/time.h"
+
+    #include "interface/msp_subscription.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FRAME_BUFFER_SIZE 256
+
+static timeUs_t simTimeUs;
+static int serializeCount;
+static uint8_t frameBuffer[FRAME_BUFFER_SIZE];
+
+// Each message is its command repeated, as many bytes as the low byte of the command says
+static bool fakeSerialize(int16_t cmd, sbuf_t *dst)
+{
+    serializeCount++;
+    if (cmd == 0) {
+        return false;
+    }
+    for (int i = 0; i < (cmd & 0xff); i++) {
+        sbufWriteU8(dst, cmd);
+    }
+    return true;
+}
+
+static mspResult_e fill(std::map<int, int> *messages, int frameSize = FRAME_BUFFER_SIZE)
+{
+    sbuf_t dst = { .ptr = frameBuffer, .end = frameBuffer + frameSize };
+    const mspResult_e result = mspSubscriptionFill(&dst);
+    if (result != MSP_RESULT_ACK) {
+        EXPECT_EQ(frameBuffer, dst.ptr);
+        return result;
+    }
+
+    sbuf_t src = { .ptr = frameBuffer, .end = dst.ptr };
+    EXPECT_EQ(simTimeUs, sbufReadU32(&src));
+    while (sbufBytesRemaining(&src)) {
+        const uint16_t cmd = sbufReadU16(&src);
+        const uint16_t size = sbufReadU16(&src);
+        EXPECT_EQ(cmd & 0xff, size);
+        for (int i = 0; i < size; i++) {
+            EXPECT_EQ(cmd & 0xff, sbufReadU8(&src));
+        }
+        (*messages)[cmd]++;
+    }
+    return result;
+}
+
+static void runFor(timeUs_t durationUs, timeUs_t tickUs, std::map<int, int> *messages, int *frames)
+{
+    for (timeUs_t t = 0; t < durationUs; t += tickUs) {
+        if (fill(messages) == MSP_RESULT_ACK) {
+            (*frames)++;
+        }
+        simTimeUs += tickUs;
+    }
+}
+
+class MspSubscriptionTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        simTimeUs = 1000;
+        serializeCount = 0;
+        mspSubscriptionInit(fakeSerialize);
+    }
+};
+
+TEST_F(MspSubscriptionTest, NoSubscriptionsEndsStream)
+{
+    std::map<int, int> messages;
+    EXPECT_FALSE(mspSubscriptionIsActive());
+    EXPECT_EQ(MSP_RESULT_ERROR, fill(&messages));
+}
+
+TEST_F(MspSubscriptionTest, MessagesArePackedAtTheirRates)
+{
+    EXPECT_TRUE(mspSubscriptionAdd(0x0108, 100));
+    EXPECT_TRUE(mspSubscriptionAdd(0x0210, 25));
+    EXPECT_TRUE(mspSubscriptionIsActive());
+
+    std::map<int, int> messages;
+    int frames = 0;
+    runFor(1000000, 1000, &messages, &frames);
+
+    EXPECT_EQ(100, messages[0x0108]);
+    EXPECT_EQ(25, messages[0x0210]);
+    // The slower message always rides along in a frame of the faster one
+    EXPECT_EQ(100, frames);
+}
+
+TEST_F(MspSubscriptionTest, LateTicksDoNotBurst)
+{
+    EXPECT_TRUE(mspSubscriptionAdd(0x0104, 100));
+
+    std::map<int, int> messages;
+    EXPECT_EQ(MSP_RESULT_ACK, fill(&messages));
+
+    // A stalled serial task must not be followed by a burst of the messages it missed
+    simTimeUs += 50000;
+    EXPECT_EQ(MSP_RESULT_ACK, fill(&messages));
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill(&messages));
+    simTimeUs += 5000;
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill(&messages));
+    simTimeUs += 5000;
+    EXPECT_EQ(MSP_RESULT_ACK, fill(&messages));
+    EXPECT_EQ(3, messages[0x0104]);
+}
+
+TEST_F(MspSubscriptionTest, RateChangeAndUnsubscribe)
+{
+    EXPECT_TRUE(mspSubscriptionAdd(0x0104, 10));
+    EXPECT_TRUE(mspSubscriptionAdd(0x0104, 50));
+    EXPECT_TRUE(mspSubscriptionAdd(0x0205, 50));
+
+    std::map<int, int> messages;
+    int frames = 0;
+    runFor(100000, 1000, &messages, &frames);
+    EXPECT_EQ(5, messages[0x0104]);
+    EXPECT_EQ(5, messages[0x0205]);
+
+    EXPECT_TRUE(mspSubscriptionAdd(0x0104, 0));
+    messages.clear();
+    runFor(100000, 1000, &messages, &frames);
+    EXPECT_EQ(0, messages[0x0104]);
+    EXPECT_EQ(5, messages[0x0205]);
+
+    EXPECT_TRUE(mspSubscriptionAdd(0x0205, 0));
+    EXPECT_FALSE(mspSubscriptionIsActive());
+    EXPECT_EQ(MSP_RESULT_ERROR, fill(&messages));
+}
+
+TEST_F(MspSubscriptionTest, TableFull)
+{
+    for (int i = 0; i < MSP_SUBSCRIPTION_MAX_ENTRIES; i++) {
+        EXPECT_TRUE(mspSubscriptionAdd(0x0101 + (i << 8), 10));
+    }
+    EXPECT_FALSE(mspSubscriptionAdd(0x7f01, 10));
+    // Changing an existing rate still works
+    EXPECT_TRUE(mspSubscriptionAdd(0x0101, 20));
+}
+
+TEST_F(MspSubscriptionTest, FullFrameDefersRemainingMessages)
+{
+    // Room for the time and two messages of the largest size
+    const int frameSize = sizeof(uint32_t) + 2 * (4 + MSP_SUBSCRIPTION_MESSAGE_SIZE_MAX);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(mspSubscriptionAdd(0x0120 + (i << 8), 10));
+    }
+
+    std::map<int, int> messages;
+    EXPECT_EQ(MSP_RESULT_ACK, fill(&messages, frameSize));
+    EXPECT_EQ(2, (int)messages.size());
+
+    // The one left out goes first on the next tick
+    messages.clear();
+    EXPECT_EQ(MSP_RESULT_ACK, fill(&messages, frameSize));
+    EXPECT_EQ(1, (int)messages.size());
+    EXPECT_EQ(1, messages[0x0320]);
+
+    messages.clear();
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill(&messages, frameSize));
+}
+
+TEST_F(MspSubscriptionTest, FailedMessageIsSkipped)
+{
+    EXPECT_TRUE(mspSubscriptionAdd(0, 100));
+
+    std::map<int, int> messages;
+    EXPECT_EQ(MSP_RESULT_NO_REPLY, fill(&messages));
+    EXPECT_EQ(1, serializeCount);
+
+    EXPECT_TRUE(mspSubscriptionAdd(0x0103, 100));
+    simTimeUs += 10000;
+    EXPECT_EQ(MSP_RESULT_ACK, fill(&messages));
+    EXPECT_EQ(1, messages[0x0103]);
+    EXPECT_EQ(0, messages.count(0));
+}
+
+// STUBS
+
+extern "C" {
+    timeUs_t micros(void) { return simTimeUs; }
+}
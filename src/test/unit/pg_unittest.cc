@@ -34,11 +34,19 @@ extern "C" {
 PG_REGISTER_WITH_RESET_TEMPLATE(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 1);
 
 PG_RESET_TEMPLATE(motorConfig_t, motorConfig,
+    .dev = {.motorPwmRate = 400},
     .minthrottle = 1150,
     .maxthrottle = 1850,
-    .mincommand = 1000,
-    .dev = {.motorPwmRate = 400}
+    .mincommand = 1000
 );
+
+typedef struct testConfig_s {
+    uint8_t value;
+} testConfig_t;
+
+PG_DECLARE(testConfig_t, testConfig);
+
+PG_REGISTER(testConfig_t, testConfig, PG_RESERVED_FOR_TESTING_1, 0);
 }
 
 
@@ -83,6 +91,24 @@ TEST(ParameterGroupsfTest, Test_pgFind)
     EXPECT_EQ(400, motorConfig3.dev.motorPwmRate);
 }
 
+TEST(ParameterGroupsfTest, Test_pgFindByPgn)
+{
+    const pgRegistry_t *motorRegistry = pgFind(PG_MOTOR_CONFIG);
+    ASSERT_NE(nullptr, motorRegistry);
+    EXPECT_EQ(PG_MOTOR_CONFIG, pgN(motorRegistry));
+    EXPECT_EQ(motorConfigMutable(), (motorConfig_t *)motorRegistry->address);
+
+    // PGNs past the last Betaflight one are found as well
+    const pgRegistry_t *testRegistry = pgFind(PG_RESERVED_FOR_TESTING_1);
+    ASSERT_NE(nullptr, testRegistry);
+    EXPECT_EQ(PG_RESERVED_FOR_TESTING_1, pgN(testRegistry));
+    EXPECT_EQ(testConfigMutable(), (testConfig_t *)testRegistry->address);
+
+    EXPECT_EQ(nullptr, pgFind(PG_GYRO_CONFIG));
+    EXPECT_EQ(nullptr, pgFind(PG_BETAFLIGHT_END));
+    EXPECT_EQ(nullptr, pgFind(PG_RESERVED_FOR_TESTING_2));
+}
+
 // STUBS
 
 extern "C" {
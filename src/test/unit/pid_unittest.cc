@@ -53,6 +53,7 @@ extern "C" {
     #include "fc/runtime_config.h"
 
     #include "flight/pid.h"
+    #include "flight/gain_schedule.h"
     #include "flight/imu.h"
     #include "flight/mixer.h"
 
@@ -68,6 +69,7 @@ extern "C" {
     launchControlMode_e unitLaunchControlMode = LAUNCH_CONTROL_MODE_NORMAL;
 
     float getThrottlePIDAttenuation(void) { return simulatedThrottlePIDAttenuation; }
+    float gainScheduleGetMultiplier(gainScheduleTerm_e) { return 1.0f; }
     float getMotorMixRange(void) { return simulatedMotorMixRange; }
     float getSetpointRate(int axis) { return simulatedSetpointRate[axis]; }
     bool isAirmodeActivated() { return simulatedAirmodeEnabled; }
@@ -776,3 +778,90 @@ TEST(pidControllerTest, testLaunchControl) {
     ASSERT_NEAR(44.84,  pidData[FD_YAW].P,   calculateTolerance(44.84));
     ASSERT_NEAR(1.56,   pidData[FD_YAW].I,  calculateTolerance(1.56));
 }
+
+typedef struct dtermReplayResult_s {
+    float noiseRms;
+    float delayMs;
+} dtermReplayResult_t;
+
+// Replays a 20Hz roll movement with optional 1900Hz motor noise through the PID loop, with 8kHz gyro and
+// 2kHz PID loop, and returns the D-term noise relative to a clean run and the D-term delay at 20Hz.
+static const float dtermReplaySignalHz = 20.0f;
+
+static void replayDterm(bool dtermGyroRate, bool withNoise, float *dterm, int count)
+{
+    const int denom = 4;
+    const float gyroFrequency = 8000.0f;
+    const float noiseHz = 1900.0f;
+
+    resetTest();
+    pidConfigMutable()->pid_process_denom = denom;
+    pidConfigMutable()->dterm_gyro_rate = dtermGyroRate;
+    gyro.targetLooptime = 125;
+    pidInit(pidProfile);
+    ENABLE_ARMING_FLAG(ARMED);
+    pidStabilisationState(PID_STABILISATION_ON);
+
+    loopIter = 0;
+    int pidLoop = 0;
+    for (int sample = 0; pidLoop < count; sample++) {
+        const float t = sample / gyroFrequency;
+        gyro.gyroADCf[FD_ROLL] = 100.0f * sinf(2 * M_PIf * dtermReplaySignalHz * t);
+        if (withNoise) {
+            gyro.gyroADCf[FD_ROLL] += 50.0f * sinf(2 * M_PIf * noiseHz * t);
+        }
+        pidUpdateDtermAtGyroRate();
+        if (sample % denom == 0) {
+            pidController(pidProfile, &rollAndPitchTrims, currentTestTime());
+            dterm[pidLoop++] = pidData[FD_ROLL].D;
+        }
+    }
+}
+
+static dtermReplayResult_t runDtermReplay(bool dtermGyroRate)
+{
+    const int count = 4000; // two seconds of PID loops
+    const int settle = 400;
+    const float pidFrequency = 2000.0f;
+    static float clean[4000];
+    static float noisy[4000];
+
+    replayDterm(dtermGyroRate, false, clean, count);
+    replayDterm(dtermGyroRate, true, noisy, count);
+
+    dtermReplayResult_t result;
+
+    float noiseSquareSum = 0;
+    for (int i = settle; i < count; i++) {
+        noiseSquareSum += (noisy[i] - clean[i]) * (noisy[i] - clean[i]);
+    }
+    result.noiseRms = sqrtf(noiseSquareSum / (count - settle));
+
+    // phase of the clean D-term relative to the ideal -cos() shaped derivative of the input
+    float inPhase = 0;
+    float quadrature = 0;
+    for (int i = settle; i < count; i++) {
+        const float phase = 2 * M_PIf * dtermReplaySignalHz * (i / pidFrequency);
+        inPhase += clean[i] * -cosf(phase);
+        quadrature += clean[i] * -sinf(phase);
+    }
+    const float phaseLag = atan2f(quadrature, inPhase);
+    result.delayMs = 1000.0f * phaseLag / (2 * M_PIf * dtermReplaySignalHz);
+
+    return result;
+}
+
+TEST(pidControllerTest, testDtermAtGyroRateReplay)
+{
+    const dtermReplayResult_t pidRate = runDtermReplay(false);
+    const dtermReplayResult_t gyroRate = runDtermReplay(true);
+
+    printf("D-term replay, 8kHz gyro / 2kHz PID, 1900Hz noise:\n");
+    printf("  PID rate:  noise rms %.3f, delay %.3f ms\n", pidRate.noiseRms, pidRate.delayMs);
+    printf("  gyro rate: noise rms %.3f, delay %.3f ms\n", gyroRate.noiseRms, gyroRate.delayMs);
+
+    // noise above the PID loop Nyquist frequency aliases into the D-term band unless it is filtered at gyro rate
+    EXPECT_LT(gyroRate.noiseRms, pidRate.noiseRms * 0.25f);
+    // for about the same delay
+    EXPECT_NEAR(pidRate.delayMs, gyroRate.delayMs, 0.5f);
+}
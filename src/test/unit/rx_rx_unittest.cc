@@ -27,7 +27,9 @@ extern "C" {
     #include "build/debug.h"
     #include "drivers/io.h"
     #include "rx/rx.h"
+    #include "fc/rc_controls.h"
     #include "fc/rc_modes.h"
+    #include "common/bitarray.h"
     #include "common/maths.h"
     #include "common/utils.h"
     #include "config/feature.h"
@@ -193,6 +195,148 @@ TEST(RxTest, TestInvalidFlightChannels)
 }
 #endif
 
+static uint8_t testFrameStatus;
+static uint16_t testChannelValue;
+
+// Reports a complete frame once per call to receiveFrame(), as a serial rx driver does
+static uint8_t testFrameStatusFn(rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
+
+    const uint8_t status = testFrameStatus;
+    testFrameStatus = RX_FRAME_PENDING;
+    return status;
+}
+
+static uint16_t testReadRawFn(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t channel)
+{
+    UNUSED(rxRuntimeConfig);
+    UNUSED(channel);
+
+    return testChannelValue;
+}
+
+static void receiveFrame(uint16_t channelValue)
+{
+    testChannelValue = channelValue;
+    testFrameStatus = RX_FRAME_COMPLETE;
+
+    uint16_t channels[RX_MAPPABLE_CHANNEL_COUNT];
+    for (int i = 0; i < RX_MAPPABLE_CHANNEL_COUNT; i++) {
+        channels[i] = channelValue;
+    }
+    rxSignalFrameReady(channels);
+}
+
+// What the scheduler does for TASK_RX, true if it processed the sticks
+static bool runRxTask(timeUs_t currentTimeUs)
+{
+    return rxUpdateCheck(currentTimeUs, 0) && calculateRxChannelsAndUpdateFailsafe(currentTimeUs);
+}
+
+TEST(RxTest, TestFastPathFrameCountedOnce)
+{
+    // given
+    memset(&testData, 0, sizeof(testData));
+    memset(&rcModeActivationMask, 0, sizeof(rcModeActivationMask));
+
+    rxConfigMutable()->rx_min_usec = 885;
+    rxConfigMutable()->rx_max_usec = 2115;
+    rxConfigMutable()->midrc = 1500;
+    for (int i = 0; i < NON_AUX_CHANNEL_COUNT; i++) {
+        rxChannelRangeConfigsMutable(i)->min = PWM_RANGE_MIN;
+        rxChannelRangeConfigsMutable(i)->max = PWM_RANGE_MAX;
+    }
+    for (int i = 0; i < MAX_SUPPORTED_RC_CHANNEL_COUNT; i++) {
+        rxFailsafeChannelConfigsMutable(i)->mode = RX_FAILSAFE_MODE_AUTO;
+    }
+
+    rxConfigMutable()->max_aux_channel = 0;
+    rxRuntimeConfig.channelCount = NON_AUX_CHANNEL_COUNT;
+
+    rxInit();
+    rxRuntimeConfig.rcFrameStatusFn = testFrameStatusFn;
+    rxRuntimeConfig.rcReadRawFn = testReadRawFn;
+
+    // and frames processed by TASK_RX alone until the link is up and the startup samples are skipped
+    timeUs_t currentTimeUs = 1000000;
+    for (int i = 0; i < 20; i++) {
+        currentTimeUs += 10000;
+        receiveFrame(1500);
+        EXPECT_TRUE(runRxTask(currentTimeUs));
+        EXPECT_FALSE(rxFastPathFrameApplied());
+    }
+
+    // when the PID loop picks a frame up before TASK_RX runs
+    currentTimeUs += 10000;
+    receiveFrame(1600);
+    EXPECT_TRUE(rxFastPathUpdate(currentTimeUs));
+    EXPECT_EQ(1600, rcData[ROLL]);
+
+    // and leaves the frame status to TASK_RX
+    EXPECT_EQ(RX_FRAME_COMPLETE, testFrameStatus);
+
+    // then TASK_RX processes the same frame without counting it again
+    EXPECT_TRUE(runRxTask(currentTimeUs + 500));
+    EXPECT_TRUE(rxFastPathFrameApplied());
+    EXPECT_TRUE(rxFastPathFrameDelivered());
+
+    // when TASK_RX sees the next frame before the PID loop does
+    currentTimeUs += 10000;
+    receiveFrame(1700);
+    EXPECT_TRUE(runRxTask(currentTimeUs));
+
+    // then it is a new frame, and the PID loop has nothing left to apply
+    EXPECT_FALSE(rxFastPathFrameApplied());
+    EXPECT_FALSE(rxFastPathFrameDelivered());
+    EXPECT_FALSE(rxFastPathUpdate(currentTimeUs + 500));
+    EXPECT_EQ(1700, rcData[ROLL]);
+
+    // when the fast path applies a frame and a newer one arrives before TASK_RX runs
+    currentTimeUs += 10000;
+    receiveFrame(1800);
+    EXPECT_TRUE(rxFastPathUpdate(currentTimeUs));
+    receiveFrame(1900);
+    EXPECT_TRUE(runRxTask(currentTimeUs + 500));
+
+    // then the newer frame is processed as new
+    EXPECT_FALSE(rxFastPathFrameApplied());
+    EXPECT_FALSE(rxFastPathFrameDelivered());
+    EXPECT_EQ(1900, rcData[ROLL]);
+    EXPECT_FALSE(rxFastPathUpdate(currentTimeUs + 1000));
+
+    // when failsafe is switched on after the fast path applied a frame
+    currentTimeUs += 10000;
+    receiveFrame(1600);
+    EXPECT_TRUE(rxFastPathUpdate(currentTimeUs));
+    bitArraySet(&rcModeActivationMask, BOXFAILSAFE);
+    EXPECT_TRUE(runRxTask(currentTimeUs + 500));
+
+    // then the changed sticks are applied again, but the frame is not counted again
+    EXPECT_TRUE(rxFastPathFrameApplied());
+    EXPECT_FALSE(rxFastPathFrameDelivered());
+    EXPECT_NE(1600, rcData[ROLL]);
+
+    // and the fast path stays out of the way while failsafe is on
+    currentTimeUs += 10000;
+    receiveFrame(1600);
+    EXPECT_FALSE(rxFastPathUpdate(currentTimeUs));
+    EXPECT_TRUE(runRxTask(currentTimeUs + 500));
+    EXPECT_FALSE(rxFastPathFrameApplied());
+
+    // when the receiver flags a frame as failsafe
+    memset(&rcModeActivationMask, 0, sizeof(rcModeActivationMask));
+    currentTimeUs += 10000;
+    receiveFrame(1500);
+    EXPECT_TRUE(runRxTask(currentTimeUs));
+    currentTimeUs += 10000;
+    testFrameStatus = RX_FRAME_COMPLETE | RX_FRAME_FAILSAFE;
+    rxSignalFrameReady(NULL);
+
+    // then it has no sticks for the fast path
+    EXPECT_FALSE(rxFastPathUpdate(currentTimeUs));
+}
+
 // STUBS
 
 extern "C" {
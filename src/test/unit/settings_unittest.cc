@@ -0,0 +1,101 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "interface/settings.h"
+
+    #include "sensors/current.h"
+    #include "sensors/voltage.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static const clivalue_t *findByName(const char *name)
+{
+    return settingGetByName(name, strlen(name));
+}
+
+TEST(SettingsUnittest, TestExactName)
+{
+    const clivalue_t *value = findByName("gyro_lowpass_hz");
+    ASSERT_NE(nullptr, value);
+    EXPECT_STREQ("gyro_lowpass_hz", value->name);
+
+    // only the given length is part of the name, as in "gyro_lowpass_hz = 100"
+    value = settingGetByName("gyro_lowpass_hz = 100", strlen("gyro_lowpass_hz"));
+    ASSERT_NE(nullptr, value);
+    EXPECT_STREQ("gyro_lowpass_hz", value->name);
+}
+
+TEST(SettingsUnittest, TestPrefixOnly)
+{
+    EXPECT_EQ(nullptr, findByName("gyro_lowpass"));
+    EXPECT_EQ(nullptr, findByName("g"));
+    EXPECT_EQ(nullptr, settingGetByName("gyro_lowpass_hz", strlen("gyro_lowpass_h")));
+
+    // a name that is itself a prefix of other names is still found
+    const clivalue_t *value = findByName("gyro_lowpass2_hz");
+    ASSERT_NE(nullptr, value);
+    EXPECT_STREQ("gyro_lowpass2_hz", value->name);
+}
+
+TEST(SettingsUnittest, TestNameCase)
+{
+    const clivalue_t *value = findByName("GYRO_LowPass_HZ");
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(findByName("gyro_lowpass_hz"), value);
+}
+
+TEST(SettingsUnittest, TestUnknownName)
+{
+    EXPECT_EQ(nullptr, findByName("no_such_setting"));
+    EXPECT_EQ(nullptr, findByName("gyro_lowpass_hzz"));
+    EXPECT_EQ(nullptr, findByName(""));
+    EXPECT_EQ(nullptr, findByName("zzz"));
+}
+
+TEST(SettingsUnittest, TestTableOrderedByName)
+{
+    // settingGetByName() relies on this, add new settings in their place rather than at the end of a group
+    for (unsigned i = 1; i < valueTableEntryCount; i++) {
+        EXPECT_LT(strcasecmp(valueTable[i - 1].name, valueTable[i].name), 0) << valueTable[i].name;
+    }
+}
+
+TEST(SettingsUnittest, TestEveryNameFound)
+{
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        EXPECT_EQ(&valueTable[i], findByName(valueTable[i].name)) << valueTable[i].name;
+    }
+}
+
+// STUBS
+extern "C" {
+const char * const debugModeNames[DEBUG_COUNT] = { "NONE" };
+const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { "NONE" };
+const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { "NONE" };
+}
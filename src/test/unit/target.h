@@ -25,6 +25,10 @@
 #define USE_FAKE_GYRO
 #define USE_BEEPER
 #define USE_BLACKBOX
+#define USE_BLACKBOX_BURST
+#define USE_BLACKBOX_COLUMNAR
+#define BLACKBOX_WORKSPACE_SIZE 12288
+#define USE_BLACKBOX_SERIAL_FRAMING
 #define USE_MAG
 #define USE_BARO
 #define USE_GPS
@@ -80,3 +84,10 @@
 #define TARGET_IO_PORTB         0xffff
 #define TARGET_IO_PORTC         0xffff
 
+
+#ifdef EEPROM_IN_RAM
+#define EEPROM_SIZE     2048
+extern uint8_t eepromData[EEPROM_SIZE];
+#define __config_start (*eepromData)
+#define __config_end (*ARRAYEND(eepromData))
+#endif